@@ -158,25 +158,49 @@ void Application::Run()
                     auto* preload_processor = dynamic_cast<decode::PreloadFileProcessor*>(file_processor_);
                     GFXRECON_ASSERT(preload_processor)
                     preload_processor->PreloadNextFrames(preload_frames_count);
+
+                    if (fps_info_->ShouldLoopMeasurementRange())
+                    {
+                        preload_processor->SaveResourceState();
+                    }
                 }
 
                 fps_info_->BeginFrame(frame_number);
             }
 
+            int64_t read_time = file_processor_->GetReadTime();
+
             // PlaySingleFrame() increments this->current_frame_number_ *if* there's an end-of-frame
             PlaySingleFrame();
 
             if (fps_info_ != nullptr)
             {
-                fps_info_->EndFrame(frame_number);
+                fps_info_->EndFrame(frame_number, file_processor_->GetReadTime() - read_time);
 
                 if (fps_info_->ShouldWaitIdleAfterFrame(frame_number))
                 {
                     file_processor_->WaitDecodersIdle();
                 }
+
+                if (fps_info_->ShouldRepeatMeasurementRange(frame_number))
+                {
+                    auto* preload_processor = dynamic_cast<decode::PreloadFileProcessor*>(file_processor_);
+                    GFXRECON_ASSERT(preload_processor)
+                    if (!preload_processor->RewindPreloadedFrames())
+                    {
+                        // Replay continues after the range with the loops that were completed.
+                        fps_info_->EndMeasurementRangeLoops();
+                    }
+                }
             }
         }
     }
+
+    if (fps_info_ != nullptr)
+    {
+        // Complete the GPU work of the replayed frames, so that their measured GPU times are available.
+        file_processor_->WaitDecodersIdle();
+    }
 }
 
 void Application::SetPaused(bool paused)
@@ -56,6 +56,11 @@ class ApiDecoder
 
     virtual void WaitIdle() = 0;
 
+    virtual void SaveResourceState() {}
+
+    // Returns false if the saved resource state cannot be restored.
+    virtual bool RestoreResourceState() { return true; }
+
     virtual bool IsComplete(uint64_t block_index) = 0;
 
     virtual bool SupportsApiCall(format::ApiCallId id) = 0;
@@ -199,6 +204,15 @@ class ApiDecoder
 
     virtual void SetCurrentApiCallId(format::ApiCallId api_call_id){};
 
+    // Returns true for calls that only record commands into the command buffer specified by their first parameter,
+    // which may be decoded on a different thread than the other calls.
+    virtual bool IsCommandRecordingCall(format::ApiCallId call_id) const { return false; }
+
+    // Returns the ID of the object that must be externally synchronized while commands are recorded to the command
+    // buffer, such as the pool that the command buffer was allocated from. Commands for command buffers with the same
+    // ID are never decoded on different threads at the same time.
+    virtual format::HandleId GetCommandRecordingSyncId(format::HandleId command_buffer_id) { return command_buffer_id; }
+
     virtual void DispatchSetTlasToBlasDependencyCommand(format::HandleId                     tlas,
                                                         const std::vector<format::HandleId>& blases){};
 
@@ -0,0 +1,420 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/block_read_ahead.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Blocks are passed to the reader in chunks of at least this size, to limit synchronization between the threads.
+const size_t kReadAheadChunkSize = 1024 * 1024;
+
+BlockReadAhead::BlockReadAhead(size_t max_queued_size) :
+    max_queued_size_(max_queued_size), file_(nullptr), active_(false),
+    compression_type_(format::CompressionType::kNone), queued_size_(0), stop_(false), finished_(false),
+    file_offset_(0), read_offset_(0), next_block_(0)
+{}
+
+BlockReadAhead::~BlockReadAhead()
+{
+    Stop();
+}
+
+void BlockReadAhead::Start(FILE* file, const std::string& filename, format::CompressionType compression_type)
+{
+    assert((file != nullptr) && !active_);
+
+    if ((compressor_ == nullptr) || (compression_type != compression_type_))
+    {
+        // The reader's compressor is not shared with the background thread.
+        compressor_.reset(format::CreateCompressor(compression_type));
+        compression_type_ = compression_type;
+    }
+
+    file_        = file;
+    filename_    = filename;
+    file_offset_ = util::platform::FileTell(file);
+    queued_size_ = 0;
+    stop_        = false;
+    finished_    = false;
+    read_offset_ = 0;
+    next_block_  = 0;
+    active_      = true;
+
+    thread_ = std::thread([this]() { ReadBlocks(); });
+}
+
+bool BlockReadAhead::Stop()
+{
+    if (!active_)
+    {
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    space_available_.notify_one();
+    thread_.join();
+
+    bool    success  = true;
+    int64_t position = GetReadPosition();
+
+    // When all of the data up to the end of the file was consumed, the file is left as is to preserve its EOF and
+    // error indicators.
+    if (position != file_offset_)
+    {
+        success = util::platform::FileSeek(file_, position, util::platform::FileSeekSet);
+    }
+
+    queue_.clear();
+    current_.reset();
+    file_   = nullptr;
+    active_ = false;
+
+    return success;
+}
+
+bool BlockReadAhead::Read(void* buffer, size_t buffer_size, size_t* file_bytes)
+{
+    uint8_t* destination = static_cast<uint8_t*>(buffer);
+
+    while (buffer_size > 0)
+    {
+        size_t size = Consume(destination, buffer_size, file_bytes);
+
+        if ((size == 0) && !NextChunk())
+        {
+            return false;
+        }
+
+        destination += size;
+        buffer_size -= size;
+    }
+
+    return true;
+}
+
+bool BlockReadAhead::Skip(size_t skip_size, size_t* file_bytes)
+{
+    while (skip_size > 0)
+    {
+        size_t size = Consume(nullptr, skip_size, file_bytes);
+
+        if ((size == 0) && !NextChunk())
+        {
+            return false;
+        }
+
+        skip_size -= size;
+    }
+
+    return true;
+}
+
+bool BlockReadAhead::HasData()
+{
+    return ((current_ != nullptr) && (read_offset_ < current_->data.size())) || NextChunk();
+}
+
+void BlockReadAhead::ReadBlocks()
+{
+    auto chunk   = std::make_unique<Chunk>();
+    bool success = true;
+
+    while (success)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (stop_)
+            {
+                break;
+            }
+        }
+
+        success = ReadBlock(chunk.get());
+
+        if (chunk->data.size() >= kReadAheadChunkSize)
+        {
+            QueueChunk(std::move(chunk));
+            chunk = std::make_unique<Chunk>();
+        }
+    }
+
+    QueueChunk(std::move(chunk));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+    }
+
+    data_available_.notify_one();
+}
+
+bool BlockReadAhead::ReadBlock(Chunk* chunk)
+{
+    format::BlockHeader block_header;
+
+    if (!util::platform::FileRead(&block_header, sizeof(block_header), file_))
+    {
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+    const size_t            block_size = static_cast<size_t>(block_header.size);
+    const size_t            data_start = chunk->data.size();
+    const format::BlockType base_type  = format::RemoveCompressedBlockBit(block_header.type);
+
+    // Size of the fields that precede the compressed data of a compressed call block.
+    size_t fields_size = 0;
+
+    if (format::IsBlockCompressed(block_header.type) && (compressor_ != nullptr))
+    {
+        if (base_type == format::BlockType::kFunctionCallBlock)
+        {
+            fields_size = sizeof(format::CompressedFunctionCallHeader) - sizeof(format::BlockHeader);
+        }
+        else if (base_type == format::BlockType::kMethodCallBlock)
+        {
+            fields_size = sizeof(format::CompressedMethodCallHeader) - sizeof(format::BlockHeader);
+        }
+    }
+
+    bool decompressed = false;
+    bool success      = true;
+
+    if ((fields_size > 0) && (block_size > fields_size))
+    {
+        decompressed = DecompressCallBlock(block_header, fields_size, chunk);
+        success      = decompressed || (chunk->data.size() > data_start);
+    }
+    else
+    {
+        const uint8_t* header_data = reinterpret_cast<const uint8_t*>(&block_header);
+        chunk->data.insert(chunk->data.end(), header_data, header_data + sizeof(block_header));
+        chunk->data.resize(data_start + sizeof(block_header) + block_size);
+
+        success = util::platform::FileRead(chunk->data.data() + data_start + sizeof(block_header), block_size, file_);
+    }
+
+    if (!success)
+    {
+        // Only the header of an incomplete block is provided, so that the reader fails to read the block data.
+        const uint8_t* header_data = reinterpret_cast<const uint8_t*>(&block_header);
+
+        chunk->data.resize(data_start);
+        chunk->data.insert(chunk->data.end(), header_data, header_data + sizeof(block_header));
+        chunk->blocks.push_back({ data_start, file_offset_, sizeof(block_header), false });
+
+        return false;
+    }
+
+    chunk->blocks.push_back({ data_start, file_offset_, sizeof(block_header) + block_size, decompressed });
+    file_offset_ += sizeof(block_header) + block_size;
+
+    return true;
+}
+
+bool BlockReadAhead::DecompressCallBlock(const format::BlockHeader& block_header, size_t fields_size, Chunk* chunk)
+{
+    const size_t block_size      = static_cast<size_t>(block_header.size);
+    const size_t compressed_size = block_size - fields_size;
+    const size_t data_start      = chunk->data.size();
+
+    // The uncompressed size is the last field of the compressed call headers.
+    uint8_t  fields[sizeof(format::CompressedMethodCallHeader)];
+    uint64_t uncompressed_size = 0;
+
+    assert(fields_size <= sizeof(fields));
+
+    if (compressed_buffer_.size() < compressed_size)
+    {
+        compressed_buffer_.resize(compressed_size);
+    }
+
+    if (!util::platform::FileRead(fields, fields_size, file_) ||
+        !util::platform::FileRead(compressed_buffer_.data(), compressed_size, file_))
+    {
+        return false;
+    }
+
+    util::platform::MemoryCopy(&uncompressed_size,
+                               sizeof(uncompressed_size),
+                               fields + fields_size - sizeof(uncompressed_size),
+                               sizeof(uncompressed_size));
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    if (uncompressed_buffer_.size() < uncompressed_size)
+    {
+        uncompressed_buffer_.resize(static_cast<size_t>(uncompressed_size));
+    }
+
+    size_t actual_size = compressor_->Decompress(
+        compressed_size, compressed_buffer_, static_cast<size_t>(uncompressed_size), &uncompressed_buffer_);
+
+    format::BlockHeader output_header = block_header;
+    const uint8_t*      data          = compressed_buffer_.data();
+    size_t              data_size     = compressed_size;
+    bool                decompressed  = (actual_size > 0) && (actual_size == uncompressed_size);
+
+    if (decompressed)
+    {
+        // Write the block as the equivalent uncompressed block, which has no uncompressed size field.
+        fields_size -= sizeof(uncompressed_size);
+        data         = uncompressed_buffer_.data();
+        data_size    = actual_size;
+
+        output_header.type = format::RemoveCompressedBlockBit(block_header.type);
+        output_header.size = fields_size + data_size;
+    }
+
+    // A block that fails to decompress is provided unchanged, for the reader to report the error.
+    const uint8_t* header_data = reinterpret_cast<const uint8_t*>(&output_header);
+
+    chunk->data.reserve(data_start + sizeof(output_header) + fields_size + data_size);
+    chunk->data.insert(chunk->data.end(), header_data, header_data + sizeof(output_header));
+    chunk->data.insert(chunk->data.end(), fields, fields + fields_size);
+    chunk->data.insert(chunk->data.end(), data, data + data_size);
+
+    return decompressed;
+}
+
+void BlockReadAhead::QueueChunk(std::unique_ptr<Chunk> chunk)
+{
+    if (chunk->data.empty())
+    {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // The queue always accepts a chunk when it is empty, so that a single large block cannot stall the reader.
+        space_available_.wait(lock, [this]() { return stop_ || queue_.empty() || (queued_size_ < max_queued_size_); });
+
+        queued_size_ += chunk->data.size();
+        queue_.emplace_back(std::move(chunk));
+    }
+
+    data_available_.notify_one();
+}
+
+bool BlockReadAhead::NextChunk()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    data_available_.wait(lock, [this]() { return finished_ || !queue_.empty(); });
+
+    if (queue_.empty())
+    {
+        return false;
+    }
+
+    current_ = std::move(queue_.front());
+    queue_.pop_front();
+
+    queued_size_ -= current_->data.size();
+    read_offset_  = 0;
+    next_block_   = 0;
+
+    lock.unlock();
+    space_available_.notify_one();
+
+    return true;
+}
+
+size_t BlockReadAhead::Consume(uint8_t* buffer, size_t size, size_t* file_bytes)
+{
+    if (current_ == nullptr)
+    {
+        return 0;
+    }
+
+    size = std::min(size, current_->data.size() - read_offset_);
+
+    // Account for the file size of each block when its first byte is consumed.
+    while ((next_block_ < current_->blocks.size()) &&
+           (current_->blocks[next_block_].data_offset < (read_offset_ + size)))
+    {
+        *file_bytes += current_->blocks[next_block_].file_size;
+        ++next_block_;
+    }
+
+    if (buffer != nullptr)
+    {
+        util::platform::MemoryCopy(buffer, size, current_->data.data() + read_offset_, size);
+    }
+
+    read_offset_ += size;
+
+    return size;
+}
+
+int64_t BlockReadAhead::GetReadPosition() const
+{
+    if ((current_ != nullptr) && (read_offset_ < current_->data.size()))
+    {
+        auto block = std::upper_bound(
+            current_->blocks.begin(), current_->blocks.end(), read_offset_, [](size_t offset, const BlockInfo& info) {
+                return offset < info.data_offset;
+            });
+
+        assert(block != current_->blocks.begin());
+        --block;
+
+        if (!block->decompressed)
+        {
+            return block->file_offset + static_cast<int64_t>(read_offset_ - block->data_offset);
+        }
+
+        if (read_offset_ != block->data_offset)
+        {
+            GFXRECON_LOG_WARNING("Read-ahead was stopped within a decompressed block, which will be skipped");
+            return block->file_offset + static_cast<int64_t>(block->file_size);
+        }
+
+        return block->file_offset;
+    }
+
+    if (!queue_.empty())
+    {
+        return queue_.front()->blocks.front().file_offset;
+    }
+
+    return file_offset_;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,136 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_BLOCK_READ_AHEAD_H
+#define GFXRECON_DECODE_BLOCK_READ_AHEAD_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads the blocks of a capture file on a background thread, ahead of the thread that decodes them. Compressed
+// function and method call blocks are decompressed by the background thread and provided to the reader as the
+// equivalent uncompressed blocks. All other blocks are provided unchanged.
+class BlockReadAhead
+{
+  public:
+    BlockReadAhead(size_t max_queued_size);
+
+    ~BlockReadAhead();
+
+    // Starts reading blocks from the current position of the file, which must be the start of a block. The file must
+    // not be accessed by the caller until Stop() is called.
+    void Start(FILE* file, const std::string& filename, format::CompressionType compression_type);
+
+    // Stops the background thread and moves the file position to the first byte that was not read with Read() or
+    // Skip(). Returns false if the file position could not be restored.
+    bool Stop();
+
+    bool IsActive() const { return active_; }
+
+    const std::string& GetFilename() const { return filename_; }
+
+    // Returns false if the end of the file or a read error was reached before buffer_size bytes were available.
+    // file_bytes receives the number of bytes of the file that the read data corresponds to.
+    bool Read(void* buffer, size_t buffer_size, size_t* file_bytes);
+
+    bool Skip(size_t skip_size, size_t* file_bytes);
+
+    // Waits for data to be available. Returns false if all of the data that was read from the file has been consumed
+    // and the background thread reached the end of the file.
+    bool HasData();
+
+  private:
+    struct BlockInfo
+    {
+        size_t  data_offset;  // Offset of the block in the chunk data.
+        int64_t file_offset;  // Offset of the block in the file.
+        size_t  file_size;    // Size of the block in the file, including the block header.
+        bool    decompressed; // Block data was decompressed and does not match the file data.
+    };
+
+    struct Chunk
+    {
+        std::vector<uint8_t>   data;
+        std::vector<BlockInfo> blocks;
+    };
+
+    void ReadBlocks();
+
+    bool ReadBlock(Chunk* chunk);
+
+    bool DecompressCallBlock(const format::BlockHeader& block_header, size_t fields_size, Chunk* chunk);
+
+    void QueueChunk(std::unique_ptr<Chunk> chunk);
+
+    bool NextChunk();
+
+    // Consumes up to size bytes of the current chunk, copying them to buffer when it is not null.
+    size_t Consume(uint8_t* buffer, size_t size, size_t* file_bytes);
+
+    int64_t GetReadPosition() const;
+
+  private:
+    const size_t                       max_queued_size_;
+    FILE*                              file_;
+    std::string                        filename_;
+    bool                               active_;
+    std::unique_ptr<util::Compressor>  compressor_;
+    format::CompressionType            compression_type_;
+    std::thread                        thread_;
+    std::mutex                         mutex_;
+    std::condition_variable            data_available_;
+    std::condition_variable            space_available_;
+    std::deque<std::unique_ptr<Chunk>> queue_;
+    size_t                             queued_size_;
+    bool                               stop_;
+    bool                               finished_;
+
+    // Background thread state.
+    int64_t              file_offset_;
+    std::vector<uint8_t> compressed_buffer_;
+    std::vector<uint8_t> uncompressed_buffer_;
+
+    // Reader state.
+    std::unique_ptr<Chunk> current_;
+    size_t                 read_offset_;
+    size_t                 next_block_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_READ_AHEAD_H
@@ -0,0 +1,223 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/command_recording_threads.h"
+#include "decode/decode_allocator.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Parameter data is copied to offsets with this alignment.
+const size_t kQueuedDataAlignment = 8;
+
+CommandRecordingThreads::CommandRecordingThreads(uint32_t thread_count, DecodeFunction decode_function) :
+    decode_function_(std::move(decode_function)), next_worker_(0)
+{
+    assert(thread_count > 0);
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+
+    for (auto& worker : workers_)
+    {
+        Worker* worker_ptr = worker.get();
+        worker->thread     = std::thread([this, worker_ptr]() { ProcessCalls(worker_ptr); });
+    }
+}
+
+CommandRecordingThreads::~CommandRecordingThreads()
+{
+    for (auto& worker : workers_)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->exit = true;
+        }
+
+        worker->work_available.notify_one();
+    }
+
+    for (auto& worker : workers_)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+void CommandRecordingThreads::QueueCall(format::ApiCallId  call_id,
+                                        const ApiCallInfo& call_info,
+                                        format::HandleId   sync_id,
+                                        const uint8_t*     parameter_buffer,
+                                        size_t             buffer_size)
+{
+    Worker* worker = workers_[GetWorkerIndex(call_info.thread_id, sync_id)].get();
+    bool    notify = false;
+
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+
+        size_t data_offset =
+            ((worker->queued_data.size() + kQueuedDataAlignment - 1) / kQueuedDataAlignment) * kQueuedDataAlignment;
+
+        worker->queued_data.resize(data_offset + buffer_size);
+        if (buffer_size > 0)
+        {
+            memcpy(worker->queued_data.data() + data_offset, parameter_buffer, buffer_size);
+        }
+
+        worker->queued_calls.push_back({ call_id, call_info, data_offset, buffer_size });
+
+        // The worker thread takes all of the queued calls when it wakes, so it only needs to be notified of the first.
+        notify = (worker->queued_calls.size() == 1);
+    }
+
+    if (notify)
+    {
+        worker->work_available.notify_one();
+    }
+}
+
+void CommandRecordingThreads::Wait()
+{
+    std::exception_ptr exception;
+
+    for (auto& worker : workers_)
+    {
+        Worker*                      worker_ptr = worker.get();
+        std::unique_lock<std::mutex> lock(worker_ptr->mutex);
+
+        worker_ptr->work_completed.wait(
+            lock, [worker_ptr]() { return worker_ptr->queued_calls.empty() && !worker_ptr->busy; });
+
+        if (worker_ptr->exception && !exception)
+        {
+            exception = worker_ptr->exception;
+        }
+
+        worker_ptr->exception = nullptr;
+    }
+
+    // Synchronization objects may be assigned to different workers after all of the workers are idle.
+    sync_object_workers_.clear();
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void CommandRecordingThreads::ProcessCalls(Worker* worker)
+{
+    std::vector<QueuedCall>      calls;
+    std::vector<uint8_t>         data;
+    std::unique_lock<std::mutex> lock(worker->mutex);
+
+    while (true)
+    {
+        worker->work_available.wait(lock, [worker]() { return !worker->queued_calls.empty() || worker->exit; });
+
+        if (worker->queued_calls.empty())
+        {
+            break;
+        }
+
+        // Swap the queued calls with the empty vectors from the previous batch, which retain their capacity.
+        calls.swap(worker->queued_calls);
+        data.swap(worker->queued_data);
+        worker->busy = true;
+
+        lock.unlock();
+
+        std::exception_ptr exception;
+
+        try
+        {
+            for (const auto& call : calls)
+            {
+                decode_function_(call.call_id, call.call_info, data.data() + call.data_offset, call.data_size);
+            }
+        }
+        catch (...)
+        {
+            // The exception is rethrown by the thread that waits for the calls to complete.
+            exception = std::current_exception();
+        }
+
+        calls.clear();
+        data.clear();
+
+        lock.lock();
+
+        worker->busy = false;
+
+        if (exception && !worker->exception)
+        {
+            worker->exception = exception;
+        }
+
+        if (worker->queued_calls.empty())
+        {
+            worker->work_completed.notify_all();
+        }
+    }
+
+    lock.unlock();
+
+    DecodeAllocator::DestroyInstance();
+}
+
+uint32_t CommandRecordingThreads::GetWorkerIndex(format::ThreadId thread_id, format::HandleId sync_id)
+{
+    auto sync_object_entry = sync_object_workers_.find(sync_id);
+    if (sync_object_entry != sync_object_workers_.end())
+    {
+        return sync_object_entry->second;
+    }
+
+    uint32_t index        = 0;
+    auto     thread_entry = thread_workers_.find(thread_id);
+    if (thread_entry != thread_workers_.end())
+    {
+        index = thread_entry->second;
+    }
+    else
+    {
+        // Capture threads are assigned to the worker threads in the order that they are first encountered.
+        index        = next_worker_;
+        next_worker_ = (next_worker_ + 1) % static_cast<uint32_t>(workers_.size());
+        thread_workers_.emplace(thread_id, index);
+    }
+
+    sync_object_workers_.emplace(sync_id, index);
+
+    return index;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,110 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_COMMAND_RECORDING_THREADS_H
+#define GFXRECON_DECODE_COMMAND_RECORDING_THREADS_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decodes command recording calls on a fixed set of worker threads. Each call is queued with the ID of the object that
+// must be externally synchronized while it is recorded, such as the command pool of the command buffer. Between two
+// calls to Wait(), all of the calls for a synchronization object are processed in order by a single worker thread, even
+// when the application recorded them from more than one thread. Synchronization objects are assigned to the worker of
+// the capture thread that first used them, so that command buffers recorded concurrently by the application are also
+// recorded concurrently by replay.
+class CommandRecordingThreads
+{
+  public:
+    typedef std::function<void(format::ApiCallId, const ApiCallInfo&, const uint8_t*, size_t)> DecodeFunction;
+
+  public:
+    CommandRecordingThreads(uint32_t thread_count, DecodeFunction decode_function);
+
+    ~CommandRecordingThreads();
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+    // Copies the parameter data and queues the call for the worker thread assigned to the synchronization object.
+    void QueueCall(format::ApiCallId  call_id,
+                   const ApiCallInfo& call_info,
+                   format::HandleId   sync_id,
+                   const uint8_t*     parameter_buffer,
+                   size_t             buffer_size);
+
+    // Waits for the worker threads to process all queued calls. Rethrows the first exception that was thrown by a
+    // worker thread while processing the calls.
+    void Wait();
+
+  private:
+    struct QueuedCall
+    {
+        format::ApiCallId call_id;
+        ApiCallInfo       call_info;
+        size_t            data_offset;
+        size_t            data_size;
+    };
+
+    struct Worker
+    {
+        std::thread             thread;
+        std::mutex              mutex;
+        std::condition_variable work_available;
+        std::condition_variable work_completed;
+        std::vector<QueuedCall> queued_calls;
+        std::vector<uint8_t>    queued_data;
+        std::exception_ptr      exception;
+        bool                    busy{ false };
+        bool                    exit{ false };
+    };
+
+    void ProcessCalls(Worker* worker);
+
+    uint32_t GetWorkerIndex(format::ThreadId thread_id, format::HandleId sync_id);
+
+  private:
+    DecodeFunction                                 decode_function_;
+    std::vector<std::unique_ptr<Worker>>           workers_;
+    std::unordered_map<format::ThreadId, uint32_t> thread_workers_;
+    std::unordered_map<format::HandleId, uint32_t> sync_object_workers_;
+    uint32_t                                       next_worker_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_COMMAND_RECORDING_THREADS_H
@@ -48,6 +48,14 @@ class CommonConsumerBase : public MetadataConsumerBase, public MarkerConsumerBas
 
     virtual void WaitDevicesIdle() {}
 
+    // Saves the content of the resources that can be written by the device, so that it can be restored to replay a
+    // range of frames again.
+    virtual void SaveResourceState() {}
+
+    // Restores the content of the resources that was saved by SaveResourceState(). Returns false if the content cannot
+    // be restored, because the replayed range changed the set of objects that the content belongs to.
+    virtual bool RestoreResourceState() { return true; }
+
     virtual bool IsComplete(uint64_t block_index) { return false; }
 
     virtual void SetCurrentBlockIndex(uint64_t block_index) override { block_index_ = block_index; }
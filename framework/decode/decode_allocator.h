@@ -55,15 +55,17 @@ class DecodeAllocator
     // Free system memory blocks. Must not be called between Begin and End
     static void FreeSystemMemory();
 
-    // Destroy the allocator instance. This will also frees all allocated memory.
+    // Destroy the allocator instance of the calling thread. This will also frees all allocated memory.
     static void DestroyInstance();
 
   private:
     DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false), end_can_clear_(true) {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t kAllocatorBlockSize{ 64 * 1024 };
+
+    // Each thread that decodes API calls has its own allocator instance.
+    static thread_local DecodeAllocator* instance_;
 
     util::MonotonicAllocator allocator_;
     bool                     can_allocate_;
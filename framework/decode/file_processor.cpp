@@ -28,12 +28,14 @@
 #include "format/format.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
 #include "util/file_path.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -44,6 +46,13 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // TODO GH #1195: frame numbering should be 1-based.
 const uint32_t kFirstFrame = 0;
 
+// Amount of data read ahead from the next segment of a segmented capture.
+const size_t kSegmentPrefetchSize      = 32 * 1024 * 1024;
+const size_t kSegmentPrefetchChunkSize = 1024 * 1024;
+
+// Maximum amount of data that is read ahead of the blocks that are being decoded.
+const size_t kReadAheadQueueSize = 64 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
     current_frame_number_(kFirstFrame), error_state_(kErrorInvalidFileDescriptor), bytes_read_(0),
     annotation_handler_(nullptr), compressor_(nullptr), block_index_(0), api_call_index_(0), block_limit_(0),
@@ -57,6 +66,17 @@ FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
 
 FileProcessor::~FileProcessor()
 {
+    // The recording threads are idle after block processing returns, and only need to be joined.
+    recording_threads_.reset();
+
+    if (prefetch_thread_.joinable())
+    {
+        prefetch_thread_.join();
+    }
+
+    // The read-ahead thread must be stopped before the files are closed.
+    read_ahead_.reset();
+
     if (nullptr != compressor_)
     {
         delete compressor_;
@@ -73,12 +93,37 @@ FileProcessor::~FileProcessor()
 
 void FileProcessor::WaitDecodersIdle()
 {
+    WaitRecordingThreads();
+
     for (auto decoder : decoders_)
     {
         decoder->WaitIdle();
     }
 };
 
+void FileProcessor::EnableReadAhead()
+{
+    if (read_ahead_ == nullptr)
+    {
+        read_ahead_ = std::make_unique<BlockReadAhead>(kReadAheadQueueSize);
+    }
+}
+
+void FileProcessor::EnableParallelRecording(uint32_t thread_count)
+{
+    if ((recording_threads_ == nullptr) && (thread_count > 0))
+    {
+        recording_threads_ = std::make_unique<CommandRecordingThreads>(
+            thread_count,
+            [this](format::ApiCallId  call_id,
+                   const ApiCallInfo& call_info,
+                   const uint8_t*     parameter_buffer,
+                   size_t             buffer_size) {
+                DispatchFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+            });
+    }
+}
+
 bool FileProcessor::Initialize(const std::string& filename)
 {
     bool success = OpenFile(filename);
@@ -137,7 +182,8 @@ bool FileProcessor::OpenFile(const std::string& filename)
 
 bool FileProcessor::ProcessNextFrame()
 {
-    bool success = IsFileValid();
+    // Data that was read ahead can remain to be processed after the end of the file was reached.
+    bool success = (IsReadAheadActive() && read_ahead_->HasData()) || IsFileValid();
 
     if (success)
     {
@@ -303,9 +349,18 @@ bool FileProcessor::ProcessBlocks()
         {
             success = ReadBlockHeader(&block_header);
 
-            for (auto decoder : decoders_)
+            // Blocks other than function calls are processed after the recording threads are idle. When recording
+            // threads are active, the block index of a function call is set by ProcessFunctionCall() for calls that are
+            // not processed by the recording threads.
+            if ((recording_threads_ == nullptr) || !success ||
+                (format::RemoveCompressedBlockBit(block_header.type) != format::BlockType::kFunctionCallBlock))
             {
-                decoder->SetCurrentBlockIndex(block_index_);
+                WaitRecordingThreads();
+
+                for (auto decoder : decoders_)
+                {
+                    decoder->SetCurrentBlockIndex(block_index_);
+                }
             }
 
             if (success)
@@ -408,27 +463,19 @@ bool FileProcessor::ProcessBlocks()
                 }
                 else if (block_header.type == format::BlockType::kAnnotation)
                 {
-                    if (annotation_handler_ != nullptr)
-                    {
-                        format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
+                    // Annotations are read even without an annotation handler, as the segment annotation of a
+                    // segmented capture is handled by the file processor.
+                    format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
 
-                        success = ReadBytes(&annotation_type, sizeof(annotation_type));
+                    success = ReadBytes(&annotation_type, sizeof(annotation_type));
 
-                        if (success)
-                        {
-                            success = ProcessAnnotation(block_header, annotation_type);
-                        }
-                        else
-                        {
-                            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read annotation block header");
-                        }
+                    if (success)
+                    {
+                        success = ProcessAnnotation(block_header, annotation_type);
                     }
                     else
                     {
-                        // If there is no annotation handler to process the annotation, we can skip the annotation
-                        // block.
-                        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
-                        success = SkipBytes(static_cast<size_t>(block_header.size));
+                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read annotation block header");
                     }
                 }
                 else
@@ -473,16 +520,50 @@ bool FileProcessor::ProcessBlocks()
         DecrementRemainingCommands();
     }
 
+    WaitRecordingThreads();
+
     DecrementRemainingCommands();
     return success;
 }
 
+// Adds the time that is spent in the scope to a read time counter when read time measurement is enabled.
+class ScopedReadTime
+{
+  public:
+    ScopedReadTime(bool enabled, int64_t* read_time) :
+        read_time_(enabled ? read_time : nullptr),
+        start_time_(enabled ? static_cast<int64_t>(util::datetime::GetTimestamp()) : 0)
+    {}
+
+    ~ScopedReadTime()
+    {
+        if (read_time_ != nullptr)
+        {
+            (*read_time_) += util::datetime::DiffTimestamps(start_time_,
+                                                            static_cast<int64_t>(util::datetime::GetTimestamp()));
+        }
+    }
+
+  private:
+    int64_t* read_time_;
+    int64_t  start_time_;
+};
+
 bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 {
     assert(block_header != nullptr);
 
+    ScopedReadTime scoped_read_time(measure_read_time_, &read_time_);
+
     bool success = false;
 
+    if ((read_ahead_ != nullptr) && !IsReadAheadActive())
+    {
+        // Read-ahead is started at the start of a block, and restarted after it was stopped to change files.
+        read_ahead_->Stop();
+        read_ahead_->Start(GetFileDescriptor(), file_stack_.back().filename, enabled_options_.compression_type);
+    }
+
     if (ReadBytes(block_header, sizeof(*block_header)))
     {
         success = true;
@@ -493,6 +574,8 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
 bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
 {
+    ScopedReadTime scoped_read_time(measure_read_time_, &read_time_);
+
     if (buffer_size > parameter_buffer_.size())
     {
         parameter_buffer_.resize(buffer_size);
@@ -508,6 +591,8 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
     // This should only be null if initialization failed.
     assert(compressor_ != nullptr);
 
+    ScopedReadTime scoped_read_time(measure_read_time_, &read_time_);
+
     if (compressed_buffer_size > compressed_parameter_buffer_.size())
     {
         compressed_parameter_buffer_.resize(compressed_buffer_size);
@@ -533,6 +618,16 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
+    if (IsReadAheadActive())
+    {
+        size_t file_bytes = 0;
+        bool   success    = read_ahead_->Read(buffer, buffer_size, &file_bytes);
+        bytes_read_ += file_bytes;
+        return success;
+    }
+
+    StopReadAhead();
+
     auto file_entry = active_files_.find(file_stack_.back().filename);
     assert(file_entry != active_files_.end());
 
@@ -546,6 +641,16 @@ bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
+    if (IsReadAheadActive())
+    {
+        size_t file_bytes = 0;
+        bool   success    = read_ahead_->Skip(skip_size, &file_bytes);
+        bytes_read_ += file_bytes;
+        return success;
+    }
+
+    StopReadAhead();
+
     auto file_entry = active_files_.find(file_stack_.back().filename);
     assert(file_entry != active_files_.end());
 
@@ -562,6 +667,8 @@ bool FileProcessor::SkipBytes(size_t skip_size)
 
 bool FileProcessor::SeekActiveFile(const std::string& filename, int64_t offset, util::platform::FileSeekOrigin origin)
 {
+    StopReadAhead();
+
     auto file_entry = active_files_.find(file_stack_.back().filename);
     assert(file_entry != active_files_.end());
 
@@ -610,8 +717,91 @@ bool FileProcessor::SetActiveFile(const std::string&             filename,
     }
 }
 
+bool FileProcessor::IsActiveFileAtEnd()
+{
+    StopReadAhead();
+
+    FILE* fd = GetFileDescriptor();
+    int   c  = fgetc(fd);
+
+    if (c == EOF)
+    {
+        return true;
+    }
+
+    ungetc(c, fd);
+    return false;
+}
+
+bool FileProcessor::ReplaceActiveFile(const std::string& filename, int64_t offset)
+{
+    // The previous file may be closed.
+    StopReadAhead();
+
+    ActiveFileContext& current_file  = GetCurrentFile();
+    std::string        previous_file = std::move(current_file.filename);
+
+    current_file.filename = filename;
+
+    if (previous_file != filename)
+    {
+        bool in_use = std::any_of(file_stack_.begin(), file_stack_.end(), [&previous_file](const auto& context) {
+            return context.filename == previous_file;
+        });
+
+        auto file_entry = active_files_.find(previous_file);
+        if (!in_use && (file_entry != active_files_.end()))
+        {
+            util::platform::FileClose(file_entry->second.fd);
+            active_files_.erase(file_entry);
+        }
+    }
+
+    GFXRECON_LOG_INFO("Continuing with capture file segment %s", filename.c_str());
+
+    return SeekActiveFile(filename, offset, util::platform::FileSeekSet);
+}
+
+void FileProcessor::PrefetchFile(const std::string& filename)
+{
+    if (prefetch_thread_.joinable())
+    {
+        prefetch_thread_.join();
+    }
+
+    prefetch_thread_ = std::thread([filename]() {
+        FILE* fd     = nullptr;
+        int   result = util::platform::FileOpen(&fd, filename.c_str(), "rb");
+        if ((result == 0) && (fd != nullptr))
+        {
+            std::vector<uint8_t> buffer(kSegmentPrefetchChunkSize);
+            size_t               total_read = 0;
+
+            while ((total_read < kSegmentPrefetchSize) &&
+                   util::platform::FileRead(buffer.data(), buffer.size(), fd))
+            {
+                total_read += buffer.size();
+            }
+
+            util::platform::FileClose(fd);
+        }
+    });
+}
+
+void FileProcessor::StopReadAhead()
+{
+    if ((read_ahead_ != nullptr) && !read_ahead_->Stop())
+    {
+        GFXRECON_LOG_ERROR("Failed to restore the file position after reading ahead");
+        error_state_ = kErrorReadingFile;
+    }
+}
+
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
+    // The EOF and error indicators of the file are only valid after read-ahead is stopped.
+    StopReadAhead();
+
     auto file_entry = active_files_.find(file_stack_.back().filename);
     assert(file_entry != active_files_.end());
 
@@ -636,7 +826,16 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     ApiCallInfo call_info{ block_index_ };
     bool        success = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
-    if (success)
+    if (success && skip_unsupported_blocks_ && !IsApiCallSupported(call_id))
+    {
+        success = SkipBytes(parameter_buffer_size - sizeof(call_info.thread_id));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip function call block data");
+        }
+    }
+    else if (success)
     {
         parameter_buffer_size -= sizeof(call_info.thread_id);
 
@@ -682,15 +881,40 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
-            for (auto decoder : decoders_)
+            if (IsParallelRecordingCall(call_id) && (parameter_buffer_size >= sizeof(format::HandleId)))
             {
-                if (decoder->SupportsApiCall(call_id))
+                // The command buffer is the first parameter of every recorded command.
+                format::HandleId command_buffer_id = format::kNullHandleId;
+                memcpy(&command_buffer_id, parameter_buffer_.data(), sizeof(command_buffer_id));
+
+                // The commands are assigned to a recording thread by the object that the application synchronized
+                // while recording them, such as the command pool.
+                format::HandleId sync_id = command_buffer_id;
+                for (auto decoder : decoders_)
                 {
-                    DecodeAllocator::Begin();
-                    decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
-                    DecodeAllocator::End();
+                    if (decoder->SupportsApiCall(call_id))
+                    {
+                        sync_id = decoder->GetCommandRecordingSyncId(command_buffer_id);
+                        break;
+                    }
+                }
+
+                recording_threads_->QueueCall(
+                    call_id, call_info, sync_id, parameter_buffer_.data(), parameter_buffer_size);
+            }
+            else
+            {
+                if (recording_threads_ != nullptr)
+                {
+                    WaitRecordingThreads();
+
+                    for (auto decoder : decoders_)
+                    {
+                        decoder->SetCurrentBlockIndex(block_index_);
+                    }
                 }
+
+                DispatchFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
             }
         }
     }
@@ -710,6 +934,97 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     return success;
 }
 
+void FileProcessor::DispatchFunctionCall(format::ApiCallId  call_id,
+                                         const ApiCallInfo& call_info,
+                                         const uint8_t*     parameter_buffer,
+                                         size_t             buffer_size)
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            DecodeAllocator::Begin();
+            decoder->SetCurrentApiCallId(call_id);
+            decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+            DecodeAllocator::End();
+        }
+    }
+}
+
+bool FileProcessor::IsParallelRecordingCall(format::ApiCallId call_id)
+{
+    if (recording_threads_ == nullptr)
+    {
+        return false;
+    }
+
+    // The call is only processed by a recording thread when every decoder that handles it reports it as a command
+    // recording call.
+    bool supported = false;
+
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            if (!decoder->IsCommandRecordingCall(call_id))
+            {
+                return false;
+            }
+
+            supported = true;
+        }
+    }
+
+    return supported;
+}
+
+bool FileProcessor::IsApiCallSupported(format::ApiCallId call_id) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileProcessor::IsSkippableMetaData(format::MetaDataId meta_data_id) const
+{
+    switch (format::GetMetaDataType(meta_data_id))
+    {
+        case format::MetaDataType::kFillMemoryCommand:
+        case format::MetaDataType::kFillMemoryResourceValueCommand:
+        case format::MetaDataType::kInitBufferCommand:
+        case format::MetaDataType::kInitImageCommand:
+        case format::MetaDataType::kInitSubresourceCommand:
+        case format::MetaDataType::kInitDx12AccelerationStructureCommand:
+            break;
+        default:
+            return false;
+    }
+
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataId(meta_data_id))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FileProcessor::WaitRecordingThreads()
+{
+    if (recording_threads_ != nullptr)
+    {
+        recording_threads_->Wait();
+    }
+}
+
 bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
                                       format::ApiCallId          call_id,
                                       bool&                      should_break)
@@ -722,7 +1037,16 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
     bool success = ReadBytes(&object_id, sizeof(object_id));
     success      = success && ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
-    if (success)
+    if (success && skip_unsupported_blocks_ && !IsApiCallSupported(call_id))
+    {
+        success = SkipBytes(parameter_buffer_size - (sizeof(object_id) + sizeof(call_info.thread_id)));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip method call block data");
+        }
+    }
+    else if (success)
     {
         parameter_buffer_size -= (sizeof(object_id) + sizeof(call_info.thread_id));
 
@@ -805,7 +1129,16 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
 
-    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    if (skip_unsupported_blocks_ && IsSkippableMetaData(meta_data_id))
+    {
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_data_id));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip meta-data block data");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
 
@@ -818,6 +1151,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
 
+            const uint8_t* data = nullptr;
+
             if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
@@ -827,10 +1162,17 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
+                data = parameter_buffer_.data();
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                // Fill memory data is often large, and is dispatched without a copy when it is already in memory.
+                data = ReadBytesInPlace(static_cast<size_t>(header.memory_size));
+                if (data == nullptr)
+                {
+                    success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                    data    = parameter_buffer_.data();
+                }
             }
 
             if (success)
@@ -839,11 +1181,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchFillMemoryCommand(header.thread_id,
-                                                           header.memory_id,
-                                                           header.memory_offset,
-                                                           header.memory_size,
-                                                           parameter_buffer_.data());
+                        decoder->DispatchFillMemoryCommand(
+                            header.thread_id, header.memory_id, header.memory_offset, header.memory_size, data);
                     }
                 }
             }
@@ -2061,6 +2400,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                         "ExecuteBlocksFromFile is referencing itself. Probably this is not intentional.");
                 }
 
+                // A block that executes another file to its end as the last block of a file that is also executed to
+                // its end links the segments of a segmented capture.
+                bool next_segment =
+                    (exec_from_file.n_blocks == 0) && GetCurrentFile().execute_till_eof && IsActiveFileAtEnd();
+
                 success = OpenFile(filename);
                 if (success)
                 {
@@ -2070,10 +2414,19 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                             exec_from_file.thread_id, exec_from_file.n_blocks, exec_from_file.offset, filename);
                     }
 
-                    SetActiveFile(
-                        filename, exec_from_file.offset, util::platform::FileSeekSet, exec_from_file.n_blocks == 0);
-                    // We need to add 1 because it will be decremented right after this function returns
-                    file_stack_.back().remaining_commands = exec_from_file.n_blocks + 1;
+                    if (next_segment)
+                    {
+                        success = ReplaceActiveFile(filename, exec_from_file.offset);
+                    }
+                    else
+                    {
+                        SetActiveFile(filename,
+                                      exec_from_file.offset,
+                                      util::platform::FileSeekSet,
+                                      exec_from_file.n_blocks == 0);
+                        // We need to add 1 because it will be decremented right after this function returns
+                        file_stack_.back().remaining_commands = exec_from_file.n_blocks + 1;
+                    }
                 }
             }
         }
@@ -2083,6 +2436,80 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockData, "Failed to read runtime info meta-data block");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kCommandBufferRecording)
+    {
+        format::CommandBufferRecording recording;
+
+        success = ReadBytes(&recording.thread_id, sizeof(recording.thread_id));
+        success = success && ReadBytes(&recording.command_buffer_id, sizeof(recording.command_buffer_id));
+        success = success && ReadBytes(&recording.recording_index, sizeof(recording.recording_index));
+        success = success && ReadBytes(&recording.recording_size, sizeof(recording.recording_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, recording.recording_size);
+
+            if (recording.recording_size > 0)
+            {
+                size_t recording_size = static_cast<size_t>(recording.recording_size);
+
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    size_t uncompressed_size = 0;
+                    size_t compressed_size   = static_cast<size_t>(block_header.size) -
+                                             (sizeof(recording) - sizeof(recording.meta_header.block_header));
+
+                    success = ReadCompressedParameterBuffer(compressed_size, recording_size, &uncompressed_size);
+                }
+                else
+                {
+                    success = ReadParameterBuffer(recording_size);
+                }
+
+                if (success)
+                {
+                    if (recording.recording_index != format::kUnreferencedCommandRecording)
+                    {
+                        if (recording.recording_index >= command_recordings_.size())
+                        {
+                            command_recordings_.resize(static_cast<size_t>(recording.recording_index) + 1);
+                        }
+
+                        command_recordings_[recording.recording_index].assign(
+                            parameter_buffer_.begin(), parameter_buffer_.begin() + recording_size);
+                    }
+
+                    success = ProcessCommandBufferRecording(
+                        recording.thread_id, recording.command_buffer_id, parameter_buffer_.data(), recording_size);
+                }
+                else
+                {
+                    HandleBlockReadError(format::IsBlockCompressed(block_header.type) ? kErrorReadingCompressedBlockData
+                                                                                      : kErrorReadingBlockData,
+                                         "Failed to read command buffer recording meta-data block");
+                }
+            }
+            else if ((recording.recording_index < command_recordings_.size()) &&
+                     !command_recordings_[recording.recording_index].empty())
+            {
+                std::vector<uint8_t>& recorded_blocks = command_recordings_[recording.recording_index];
+
+                success = ProcessCommandBufferRecording(
+                    recording.thread_id, recording.command_buffer_id, recorded_blocks.data(), recorded_blocks.size());
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Command buffer recording meta-data block references unknown recording %u",
+                                   recording.recording_index);
+                error_state_ = kErrorReadingBlockData;
+                success      = false;
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read command buffer recording meta-data header");
+        }
+    }
     else
     {
         if ((meta_data_type == format::MetaDataType::kReserved23) ||
@@ -2104,6 +2531,63 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     return success;
 }
 
+bool FileProcessor::ProcessCommandBufferRecording(format::ThreadId thread_id,
+                                                  format::HandleId command_buffer_id,
+                                                  uint8_t*         data,
+                                                  size_t           size)
+{
+    size_t offset = 0;
+
+    while ((offset + sizeof(format::FunctionCallHeader)) <= size)
+    {
+        format::FunctionCallHeader call_header;
+        memcpy(&call_header, data + offset, sizeof(call_header));
+
+        const size_t header_data_size = sizeof(call_header.api_call_id) + sizeof(call_header.thread_id);
+        const size_t block_end        = offset + sizeof(call_header.block_header) + call_header.block_header.size;
+
+        if ((call_header.block_header.type != format::BlockType::kFunctionCallBlock) ||
+            (call_header.block_header.size < (header_data_size + sizeof(command_buffer_id))) || (block_end > size))
+        {
+            break;
+        }
+
+        uint8_t* parameter_data = data + offset + sizeof(call_header);
+        size_t   parameter_size = static_cast<size_t>(call_header.block_header.size) - header_data_size;
+
+        // The command buffer is the first parameter of every recorded command.
+        memcpy(parameter_data, &command_buffer_id, sizeof(command_buffer_id));
+
+        // Each recorded command has its own block index, following the index of the recording block, as if the
+        // commands had been written as individual blocks.
+        ++block_index_;
+        PrintBlockInfo();
+
+        for (auto decoder : decoders_)
+        {
+            decoder->SetCurrentBlockIndex(block_index_);
+        }
+
+        ApiCallInfo call_info{ block_index_ };
+        call_info.thread_id = thread_id;
+
+        DispatchFunctionCall(call_header.api_call_id, call_info, parameter_data, parameter_size);
+
+        offset = block_end;
+    }
+
+    if (offset != size)
+    {
+        GFXRECON_LOG_ERROR("Invalid function call block in command buffer recording (frame %u block %" PRIu64 ")",
+                           current_frame_number_,
+                           block_index_);
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    return true;
+}
+
 bool FileProcessor::ProcessFrameMarker(const format::BlockHeader& block_header,
                                        format::MarkerType         marker_type,
                                        bool&                      should_break)
@@ -2234,8 +2718,15 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
                     data.assign(data_start, std::next(data_start, static_cast<size_t>(data_length)));
                 }
 
-                assert(annotation_handler_ != nullptr);
-                annotation_handler_->ProcessAnnotation(block_index_, annotation_type, label, data);
+                if ((label == format::kAnnotationLabelNextSegment) && !data.empty())
+                {
+                    PrefetchFile(util::filepath::Join(absolute_path_, data));
+                }
+
+                if (annotation_handler_ != nullptr)
+                {
+                    annotation_handler_->ProcessAnnotation(block_index_, annotation_type, label, data);
+                }
             }
             else
             {
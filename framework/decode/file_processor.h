@@ -28,6 +28,8 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_read_ahead.h"
+#include "decode/command_recording_threads.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
@@ -35,7 +37,9 @@
 #include <cstdint>
 #include <cstdio>
 #include <deque>
+#include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -88,6 +92,23 @@ class FileProcessor
 
     bool Initialize(const std::string& filename);
 
+    // Reads and decompresses the blocks of the capture file on a background thread, ahead of the blocks that are
+    // being decoded.
+    void EnableReadAhead();
+
+    // Processes the command recording calls of each capture thread on one of thread_count worker threads, so that
+    // command buffers that were recorded concurrently by the application are also recorded concurrently by replay.
+    // All other calls are processed after the queued command recording calls have completed.
+    void EnableParallelRecording(uint32_t thread_count);
+
+    // Measures the time that is spent to read and decompress the blocks of the capture file, which is returned by
+    // GetReadTime().
+    void EnableReadTimeMeasurement() { measure_read_time_ = true; }
+
+    // Skips the data of the function call blocks and the resource data meta-data blocks that are not supported by any
+    // of the decoders, without reading or decompressing it.  Only the block headers of the skipped blocks are read.
+    void EnableUnsupportedBlockSkipping() { skip_unsupported_blocks_ = true; }
+
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
     // occurred.  Use GetErrorState() to determine error condition.
     bool ProcessNextFrame();
@@ -105,6 +126,8 @@ class FileProcessor
 
     uint64_t GetNumBytesRead() const { return bytes_read_; }
 
+    int64_t GetReadTime() const { return read_time_; }
+
     Error GetErrorState() const { return error_state_; }
 
     bool EntireFileWasProcessed() const
@@ -136,12 +159,21 @@ class FileProcessor
 
     virtual bool ReadBytes(void* buffer, size_t buffer_size);
 
+    // Returns a pointer to the next buffer_size bytes of block data and advances past them when the data is already
+    // in memory, so that the data can be dispatched without being copied. Returns nullptr otherwise.
+    virtual const uint8_t* ReadBytesInPlace(size_t buffer_size) { return nullptr; }
+
     bool SkipBytes(size_t skip_size);
 
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
 
     bool ProcessMethodCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
 
+    void DispatchFunctionCall(format::ApiCallId  call_id,
+                              const ApiCallInfo& call_info,
+                              const uint8_t*     parameter_buffer,
+                              size_t             buffer_size);
+
     bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool IsFrameDelimiter(format::BlockType block_type, format::MarkerType marker_type) const;
@@ -230,6 +262,45 @@ class FileProcessor
 
     std::string ApplyAbsolutePath(const std::string& file);
 
+    // Returns true when no data follows the current position of the active file.
+    bool IsActiveFileAtEnd();
+
+    // Continues processing with the specified file in place of the active file, which is closed. Used for the
+    // ExecuteBlocksFromFile block that links a segment of a segmented capture to the next segment.
+    bool ReplaceActiveFile(const std::string& filename, int64_t offset);
+
+    // Reads the start of a capture file segment on a background thread, so that the data is cached by the operating
+    // system when processing continues with the segment.
+    void PrefetchFile(const std::string& filename);
+
+    // Stops the background read-ahead thread, which must be done before the position of a file is changed.
+    void StopReadAhead();
+
+    bool IsReadAheadActive() const
+    {
+        return (read_ahead_ != nullptr) && read_ahead_->IsActive() && !file_stack_.empty() &&
+               (read_ahead_->GetFilename() == file_stack_.back().filename);
+    }
+
+    // Returns true when the call can be processed by the recording threads.
+    bool IsParallelRecordingCall(format::ApiCallId call_id);
+
+    // Waits for the recording threads to process the queued command recording calls.
+    void WaitRecordingThreads();
+
+    // Returns true when the call is supported by at least one decoder.
+    bool IsApiCallSupported(format::ApiCallId call_id) const;
+
+    // Returns true for meta-data blocks that carry resource data and are not supported by any decoder.
+    bool IsSkippableMetaData(format::MetaDataId meta_data_id) const;
+
+    // Decodes the function call blocks of a command buffer recording, after patching the thread ID and the command
+    // buffer handle ID of the recording into the blocks. Each block is assigned the next block index.
+    bool ProcessCommandBufferRecording(format::ThreadId thread_id,
+                                       format::HandleId command_buffer_id,
+                                       uint8_t*         data,
+                                       size_t           size);
+
   private:
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
@@ -244,6 +315,9 @@ class FileProcessor
     int64_t                             block_index_from_{ 0 };
     int64_t                             block_index_to_{ 0 };
     bool                                loading_trimmed_capture_state_;
+    bool                                measure_read_time_{ false };
+    int64_t                             read_time_{ 0 };
+    bool                                skip_unsupported_blocks_{ false };
 
     struct ActiveFiles
     {
@@ -270,6 +344,15 @@ class FileProcessor
 
     std::string absolute_path_;
 
+    std::thread prefetch_thread_;
+
+    std::unique_ptr<BlockReadAhead> read_ahead_;
+
+    std::unique_ptr<CommandRecordingThreads> recording_threads_;
+
+    // Command buffer recordings that can be referenced by later CommandBufferRecording blocks, by recording index.
+    std::vector<std::vector<uint8_t>> command_recordings_;
+
   private:
     ActiveFileContext& GetCurrentFile()
     {
@@ -27,18 +27,59 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-PreloadFileProcessor::PreloadFileProcessor() : status_(PreloadStatus::kInactive) {}
+PreloadFileProcessor::PreloadFileProcessor() :
+    status_(PreloadStatus::kInactive), preload_frame_number_(0), preload_block_index_(0)
+{}
 
 void PreloadFileProcessor::PreloadNextFrames(size_t count)
 {
+    preload_frame_number_ = current_frame_number_;
+    preload_block_index_  = block_index_;
+
     status_ = PreloadStatus::kRecord;
-    while (--count != 0U)
+    for (size_t i = 0; i < count; ++i)
     {
         ProcessNextFrame();
     }
     status_ = PreloadStatus::kReplay;
 }
 
+void PreloadFileProcessor::SaveResourceState()
+{
+    WaitDecodersIdle();
+
+    for (auto* decoder : decoders_)
+    {
+        decoder->SaveResourceState();
+    }
+}
+
+bool PreloadFileProcessor::RewindPreloadedFrames()
+{
+    WaitDecodersIdle();
+
+    bool restored = true;
+    for (auto* decoder : decoders_)
+    {
+        if (!decoder->RestoreResourceState())
+        {
+            restored = false;
+        }
+    }
+
+    if (!restored)
+    {
+        return false;
+    }
+
+    preload_buffer_.Rewind();
+    status_               = PreloadStatus::kReplay;
+    current_frame_number_ = preload_frame_number_;
+    block_index_          = preload_block_index_;
+
+    return true;
+}
+
 PreloadFileProcessor::PreloadBuffer::PreloadBuffer() : replay_offset_(0) {}
 
 void PreloadFileProcessor::PreloadBuffer::Reserve(size_t size)
@@ -55,6 +96,18 @@ size_t PreloadFileProcessor::PreloadBuffer::Read(void* destination, size_t desti
     return read_size;
 }
 
+const uint8_t* PreloadFileProcessor::PreloadBuffer::ReadInPlace(size_t size)
+{
+    if (size > (container_.size() - replay_offset_))
+    {
+        return nullptr;
+    }
+
+    auto data = reinterpret_cast<const uint8_t*>(container_.data() + replay_offset_);
+    replay_offset_ += size;
+    return data;
+}
+
 void PreloadFileProcessor::PreloadBuffer::Reset()
 {
     container_.clear();
@@ -341,5 +394,25 @@ bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
     return bytes_read == buffer_size;
 }
 
+const uint8_t* PreloadFileProcessor::ReadBytesInPlace(size_t buffer_size)
+{
+    const uint8_t* data = nullptr;
+    if (status_ == PreloadStatus::kReplay)
+    {
+        data = preload_buffer_.ReadInPlace(buffer_size);
+        if (data != nullptr)
+        {
+            bytes_read_ += buffer_size;
+
+            if (preload_buffer_.ReplayFinished())
+            {
+                status_ = PreloadStatus::kInactive;
+            }
+        }
+    }
+
+    return data;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
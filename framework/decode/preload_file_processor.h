@@ -38,6 +38,14 @@ class PreloadFileProcessor : public FileProcessor
     // Preloads *count* frames to continuous, expandable memory buffer
     void PreloadNextFrames(size_t count);
 
+    // Saves the resource state of the decoders, which must be done before the preloaded frames are replayed
+    void SaveResourceState();
+
+    // Restores the resource state that was saved by SaveResourceState() and rewinds to the first preloaded frame, so
+    // that the preloaded frames are replayed again. Returns false without rewinding if the resource state cannot be
+    // restored
+    bool RewindPreloadedFrames();
+
   private:
     class PreloadBuffer
     {
@@ -51,6 +59,10 @@ class PreloadFileProcessor : public FileProcessor
         // Accounts for current replay position
         size_t Read(void* destination, size_t destination_size);
 
+        // Returns a pointer to *size* bytes of preloaded data at the current replay position, and advances the replay
+        // position. Returns nullptr if less than *size* bytes remain
+        const uint8_t* ReadInPlace(size_t size);
+
         // Copies provided object of type T into the preload buffer
         // Returns a pointer to inserted object in the container
         template <typename T>
@@ -67,6 +79,9 @@ class PreloadFileProcessor : public FileProcessor
         // Indicates whether the preloaded calls have been replayed in full
         inline bool ReplayFinished() { return !container_.empty() && replay_offset_ >= container_.size(); }
 
+        // Restarts the replay of the preloaded calls
+        inline void Rewind() { replay_offset_ = 0; }
+
         // Clears the preload buffer, resets internal state
         void Reset();
 
@@ -83,6 +98,10 @@ class PreloadFileProcessor : public FileProcessor
         kReplay
     } status_;
 
+    // Frame number and block index of the first preloaded frame
+    uint64_t preload_frame_number_;
+    uint64_t preload_block_index_;
+
     template <typename T>
     bool ReadParameterBytes(format::BlockHeader& block_header, T& data, PreloadBuffer& preload_buffer)
     {
@@ -106,6 +125,8 @@ class PreloadFileProcessor : public FileProcessor
     bool ProcessBlocks() override;
 
     bool ReadBytes(void* buffer, size_t buffer_size) override;
+
+    const uint8_t* ReadBytesInPlace(size_t buffer_size) override;
 };
 
 GFXRECON_END_NAMESPACE(decode)
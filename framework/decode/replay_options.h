@@ -31,7 +31,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-static constexpr char kDefaultScreenshotFilePrefix[] = "screenshot";
+static constexpr char kDefaultScreenshotFilePrefix[]    = "screenshot";
+static constexpr char kDefaultScreenshotCompareReport[] = "screenshot_compare.json";
 
 struct ScreenshotRange
 {
@@ -68,6 +69,8 @@ struct ReplayOptions
     std::string                  screenshot_dir;
     std::string                  screenshot_file_prefix{ kDefaultScreenshotFilePrefix };
     uint32_t                     screenshot_width, screenshot_height;
+    std::string                  screenshot_compare_dir;
+    std::string                  screenshot_compare_report{ kDefaultScreenshotCompareReport };
     int32_t                      num_pipeline_creation_jobs{ 0 };
     std::string                  asset_file_path;
     std::string                  dump_resources_output_dir;
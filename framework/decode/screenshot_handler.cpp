@@ -48,7 +48,7 @@ inline void WriteImageFile(const std::string&     filename,
     switch (file_format)
     {
         default:
-            GFXRECON_LOG_ERROR("Screenshot format invalid!  Expected BMP or PNG, falling back to BMP.");
+            GFXRECON_LOG_ERROR("Screenshot format invalid!  Expected BMP, PNG, QOI or ZSTD, falling back to BMP.");
             // Intentional fall-through
         case util::ScreenshotFormat::kBmp:
             if (!util::imagewriter::WriteBmpImage(filename + ".bmp", width, height, size, data))
@@ -64,6 +64,20 @@ inline void WriteImageFile(const std::string&     filename,
             }
             break;
 #endif // GFXRECON_ENABLE_PNG_SCREENSHOT
+        case util::ScreenshotFormat::kQoi:
+            if (!util::imagewriter::WriteQoiImage(filename + ".qoi", width, height, size, data))
+            {
+                GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write QOI file %s", filename.c_str());
+            }
+            break;
+#ifdef GFXRECON_ENABLE_ZSTD_COMPRESSION
+        case util::ScreenshotFormat::kZstd:
+            if (!util::imagewriter::WriteZstdImage(filename + ".zst", width, height, size, data))
+            {
+                GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write ZSTD file %s", filename.c_str());
+            }
+            break;
+#endif // GFXRECON_ENABLE_ZSTD_COMPRESSION
     }
 }
 
@@ -405,12 +419,16 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                 1, &invalidate_range, &copy_resource.buffer_memory_data);
                         }
 
-                        WriteImageFile(filename_prefix,
-                                       screenshot_format_,
-                                       copy_width,
-                                       copy_height,
-                                       copy_resource.buffer_size,
-                                       data);
+                        // When comparing against reference images, only screenshots that differ are written.
+                        if (!IsCompareEnabled() || !CompareImage(filename_prefix, copy_width, copy_height, data))
+                        {
+                            WriteImageFile(filename_prefix,
+                                           screenshot_format_,
+                                           copy_width,
+                                           copy_height,
+                                           copy_resource.buffer_size,
+                                           data);
+                        }
 
                         allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
                     }
@@ -22,10 +22,13 @@
 
 #include "decode/screenshot_handler_base.h"
 
+#include "util/file_path.h"
+#include "util/image_reader.h"
 #include "util/image_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <cinttypes>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -43,6 +46,91 @@ ScreenshotHandlerBase::ScreenshotHandlerBase(util::ScreenshotFormat         scre
     screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0)
 {}
 
+ScreenshotHandlerBase::~ScreenshotHandlerBase()
+{
+    if (IsCompareEnabled() && !compare_report_file_.empty())
+    {
+        size_t identical_count = 0;
+        for (const auto& entry : compare_entries_)
+        {
+            if (entry.reference_found && entry.test_found && entry.result.IsIdentical())
+            {
+                ++identical_count;
+            }
+        }
+
+        GFXRECON_LOG_INFO("Screenshot comparison: %" PRIuPTR " of %" PRIuPTR " screenshots match the reference images",
+                          identical_count,
+                          compare_entries_.size());
+
+        util::imagecompare::WriteJsonReport(compare_report_file_, compare_entries_);
+    }
+}
+
+void ScreenshotHandlerBase::SetCompareOptions(const std::string& reference_dir, const std::string& report_file)
+{
+    compare_dir_         = reference_dir;
+    compare_report_file_ = report_file;
+}
+
+bool ScreenshotHandlerBase::CompareImage(const std::string& filename_prefix,
+                                         uint32_t           width,
+                                         uint32_t           height,
+                                         const void*        data)
+{
+    util::imagecompare::CompareEntry entry;
+    entry.name           = util::filepath::GetFilename(filename_prefix);
+    entry.reference_file = util::imagecompare::FindImageFile(compare_dir_, entry.name);
+    entry.test_found     = true;
+
+    if (entry.reference_file.empty())
+    {
+        GFXRECON_LOG_WARNING("Screenshot comparison: no reference image found for %s in %s",
+                             entry.name.c_str(),
+                             compare_dir_.c_str());
+    }
+    else
+    {
+        util::imagereader::ImageData reference;
+        util::imagereader::ImageData screenshot;
+
+        entry.reference_found = util::imagereader::ReadImage(entry.reference_file, &reference);
+
+        if (entry.reference_found &&
+            util::imagereader::ConvertImageData(
+                width, height, data, width * 4, util::imagewriter::kFormat_BGRA, false, &screenshot))
+        {
+            util::imagecompare::CompareImages(reference, screenshot, &entry.result);
+
+            if (!entry.result.IsIdentical())
+            {
+                GFXRECON_LOG_WARNING("Screenshot comparison: %s differs from the reference image (%" PRIu64
+                                     " pixels, max error %u)",
+                                     entry.name.c_str(),
+                                     entry.result.mismatched_pixels,
+                                     entry.result.max_error);
+            }
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Screenshot comparison: failed to read reference image %s",
+                               entry.reference_file.c_str());
+        }
+    }
+
+    bool identical = entry.reference_found && entry.result.IsIdentical();
+
+    if (!identical)
+    {
+        // The screenshot is written to disk by the caller for inspection.
+        entry.test_file = filename_prefix;
+    }
+
+    compare_entries_.emplace_back(std::move(entry));
+
+    return identical;
+}
+
 void ScreenshotHandlerBase::EndFrame()
 {
     if (current_range_index_ < screenshot_ranges_.size())
@@ -24,6 +24,7 @@
 #define GFXRECON_DECODE_SCREENSHOT_HANDLER_BASE_H
 
 #include "util/defines.h"
+#include "util/image_compare.h"
 #include "util/options.h"
 
 #include "decode/replay_options.h"
@@ -43,17 +44,36 @@ class ScreenshotHandlerBase
 
     ScreenshotHandlerBase(util::ScreenshotFormat screenshot_format, std::vector<ScreenshotRange>&& screenshot_ranges);
 
+    virtual ~ScreenshotHandlerBase();
+
+    // Enables comparison of screenshots against reference images from reference_dir. The comparison results are
+    // written to report_file when the handler is destroyed.
+    void SetCompareOptions(const std::string& reference_dir, const std::string& report_file);
+
+    bool IsCompareEnabled() const { return !compare_dir_.empty(); }
+
     uint32_t GetCurrentFrame() const { return current_frame_number_; }
 
     void EndFrame();
 
     bool IsScreenshotFrame() const;
 
+  protected:
+    // Compares BGRA8 screenshot data against the reference image with the same file name as filename_prefix and
+    // records the result for the report. Returns true when the reference exists and the images are identical, in which
+    // case the screenshot does not need to be written to disk.
+    bool CompareImage(const std::string& filename_prefix, uint32_t width, uint32_t height, const void* data);
+
   protected:
     uint32_t                     current_frame_number_;
     util::ScreenshotFormat       screenshot_format_;
     std::vector<ScreenshotRange> screenshot_ranges_;
     size_t                       current_range_index_;
+
+  private:
+    std::string                                   compare_dir_;
+    std::string                                   compare_report_file_;
+    std::vector<util::imagecompare::CompareEntry> compare_entries_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -51,9 +51,10 @@ class StatDecoderBase : public ApiDecoder
 
     void AddConsumer(StatConsumerBase* consumer) { consumers_.push_back(consumer); }
 
-    virtual bool SupportsApiCall(format::ApiCallId id) override { return true; }
+    // Only the state markers are processed, which are dispatched to all decoders.
+    virtual bool SupportsApiCall(format::ApiCallId id) override { return false; }
 
-    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return true; }
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return false; }
 
     virtual void DecodeFunctionCall(format::ApiCallId  id,
                                     const ApiCallInfo& call_info,
@@ -93,6 +93,13 @@ class VulkanConsumerBase : public CommonConsumerBase
 
     virtual void ProcessSetTlasToBlasRelationCommand(format::HandleId tlas, const std::vector<format::HandleId>& blases)
     {}
+
+    // Returns the ID of the command pool that the command buffer was allocated from, or kNullHandleId when it is not
+    // known.
+    virtual format::HandleId GetCommandBufferPoolId(format::HandleId command_buffer_id) const
+    {
+        return format::kNullHandleId;
+    }
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -40,6 +40,16 @@ struct GfxToCppPlatformMap
     std::string      platform_str;
 };
 
+// Size of the stdio buffer used for each generated frame file, to write the generated code in large blocks.
+static constexpr size_t kFrameFileBufferSize = 1024 * 1024;
+
+// Alignment of the blocks in the data pack file, so that generated code can use pointers into the mapped file directly.
+static constexpr uint64_t kDataPackAlignment = 16;
+
+// Android opens the data pack assets in AASSET_MODE_BUFFER, which can read a compressed asset into memory in full, so
+// the binary data is split into pack files of about this size instead of a single file.
+static constexpr uint64_t kAndroidDataPackSizeLimit = 40 * 1024 * 1024;
+
 const GfxToCppPlatform GetGfxToCppPlatform(const std::string& format_str);
 const std::string      GfxToCppPlatformToString(GfxToCppPlatform platform);
 
@@ -424,7 +434,13 @@ bool VulkanCppConsumerBase::Initialize(const std::string&      filename,
         exit(-1);
     }
 
-    data_packer_.Initialize(out_dir_, util::filepath::Join(bin_out_dir_, "dataPack"), "bin", 40 * 1024 * 1024);
+    // The binary data goes into a single pack file, which the generated code maps into memory once, except on Android.
+    data_packer_.Initialize(out_dir_,
+                            util::filepath::Join(bin_out_dir_, "dataPack"),
+                            "bin",
+                            (platform_ == GfxToCppPlatform::PLATFORM_ANDROID) ? kAndroidDataPackSizeLimit
+                                                                              : DataFilePacker::kNoSizeLimit,
+                            kDataPackAlignment);
     // All spv files should be separate ones
     spv_saver_.Initialize(out_dir_, util::filepath::Join(spv_out_dir_, "shader"), "spv", 0);
 
@@ -432,6 +448,7 @@ bool VulkanCppConsumerBase::Initialize(const std::string&      filename,
     frame_number_          = 0;
     frame_split_number_    = 0;
     frame_api_call_number_ = 0;
+    file_api_call_number_  = 0;
     api_call_number_       = 0;
     NewFrameFile(frame_number_, frame_split_number_);
 
@@ -453,6 +470,9 @@ void VulkanCppConsumerBase::Destroy()
 {
     EndFrameFile(frame_number_, frame_split_number_);
 
+    data_packer_.Close();
+    spv_saver_.Close();
+
     if (main_file_ != nullptr)
     {
         PrintOutGlobalVar();
@@ -487,21 +507,40 @@ void VulkanCppConsumerBase::NewFrameFile(uint32_t frameNumber, uint32_t frameSpl
         exit(-1);
     }
 
+    setvbuf(frame_file_, nullptr, _IOFBF, kFrameFileBufferSize);
+
     fprintf(frame_file_, "%s\n", sCommonFrameSourceHeader);
 
-    std::string frameFunctionName = "void " + new_frame_filename + "()";
-    fprintf(frame_file_, "%s {\n", frameFunctionName.c_str());
+    file_api_call_number_ = 0;
+
+    NewFrameFunction(frameNumber, frameSplitNumber);
 }
 
 void VulkanCppConsumerBase::EndFrameFile(uint32_t frameNumber, uint32_t frameSplitNumber)
 {
     assert(frame_file_ != nullptr);
-    assert(main_file_ != nullptr);
 
-    // Write out closing data for previous frame file.
-    fprintf(frame_file_, "%s", sCommonFrameSourceFooter);
+    EndFrameFunction(frameNumber, frameSplitNumber);
+
     util::platform::FileClose(frame_file_);
     frame_file_ = nullptr;
+}
+
+void VulkanCppConsumerBase::NewFrameFunction(uint32_t frameNumber, uint32_t frameSplitNumber)
+{
+    assert(frame_file_ != nullptr);
+
+    std::string frameFunctionName = "void " + GenFrameName(frameNumber, frameSplitNumber, 4) + "()";
+    fprintf(frame_file_, "%s {\n", frameFunctionName.c_str());
+}
+
+void VulkanCppConsumerBase::EndFrameFunction(uint32_t frameNumber, uint32_t frameSplitNumber)
+{
+    assert(frame_file_ != nullptr);
+    assert(main_file_ != nullptr);
+
+    // Write out closing data for the frame function.
+    fprintf(frame_file_, "%s", sCommonFrameSourceFooter);
 
     // The 'struct tracking' mechanism's restricted for every frame call.
     struct_map_.clear();
@@ -516,7 +555,7 @@ void VulkanCppConsumerBase::EndFrameFile(uint32_t frameNumber, uint32_t frameSpl
 
 void VulkanCppConsumerBase::NextFrame(bool isSplit)
 {
-    EndFrameFile(frame_number_, frame_split_number_);
+    EndFrameFunction(frame_number_, frame_split_number_);
     frame_api_call_number_ = 0;
     frame_split_temp_memory_.clear();
     if (isSplit)
@@ -528,7 +567,21 @@ void VulkanCppConsumerBase::NextFrame(bool isSplit)
         frame_split_number_ = 0;
         frame_number_++;
     }
-    NewFrameFile(frame_number_, frame_split_number_);
+
+    // Frame functions are grouped into translation units of about max_command_limit_ API calls, so that captures
+    // with many small frames don't produce thousands of tiny source files that each parse the common headers, and
+    // the generated project builds in parallel from evenly sized files.
+    if (file_api_call_number_ >= max_command_limit_)
+    {
+        util::platform::FileClose(frame_file_);
+        frame_file_ = nullptr;
+
+        NewFrameFile(frame_number_, frame_split_number_);
+    }
+    else
+    {
+        NewFrameFunction(frame_number_, frame_split_number_);
+    }
 }
 
 void VulkanCppConsumerBase::Post_APICall(format::ApiCallId callId)
@@ -547,6 +600,7 @@ void VulkanCppConsumerBase::Post_APICall(format::ApiCallId callId)
     if (callId != format::ApiCallId::ApiCall_vkAcquireNextImageKHR)
     {
         frame_api_call_number_++;
+        file_api_call_number_++;
         api_call_number_++;
     }
 }
@@ -563,6 +617,14 @@ void VulkanCppConsumerBase::GenerateLoadData(
             size);
 }
 
+std::string VulkanCppConsumerBase::GenerateGetData(const SavedFileInfo& file_info, const std::string& type)
+{
+    std::stringstream get_data;
+    get_data << "(const " << type << "*)GetBinaryData(\"" << file_info.file_path << "\", " << file_info.byte_offset
+             << ", " << file_info.data_size << ", appdata)";
+    return get_data.str();
+}
+
 FILE* VulkanCppConsumerBase::GetFrameFile()
 {
     return frame_file_;
@@ -1543,8 +1605,11 @@ void VulkanCppConsumerBase::Generate_vkCreateShaderModule(
 
     fprintf(file, "\t{\n");
 
-    fprintf(file, "\t\tuint8_t *%s = new uint8_t[%zu];\n\t", code_var_name.c_str(), struct_info->codeSize);
-    GenerateLoadData(file_info.file_path, file_info.byte_offset, code_var_name, 0, struct_info->codeSize);
+    // The SPIR-V is used directly from the mapped file, without copying it to a temporary buffer.
+    fprintf(file,
+            "\t\tconst uint32_t* %s = %s;\n",
+            code_var_name.c_str(),
+            GenerateGetData(file_info, "uint32_t").c_str());
 
     std::string create_info_struct_name = "pCreateInfo_" + std::to_string(VulkanCppConsumerBase::GetNextId());
 
@@ -1554,7 +1619,7 @@ void VulkanCppConsumerBase::Generate_vkCreateShaderModule(
     out_struct << "\t\t" << struct_info->pNext << ", // pNext" << std::endl;
     out_struct << "\t\t" << util::ToString<VkShaderModuleCreateFlags>(struct_info->flags) << ", // flags" << std::endl;
     out_struct << "\t\t" << struct_info->codeSize << ", // codeSize" << std::endl;
-    out_struct << "\t\t(const uint32_t*)" << code_var_name << " // pCode" << std::endl;
+    out_struct << "\t\t" << code_var_name << " // pCode" << std::endl;
     out_struct << "\t\t};" << std::endl;
     fprintf(file, "%s", out_struct.str().c_str());
 
@@ -1573,8 +1638,36 @@ void VulkanCppConsumerBase::Generate_vkCreateShaderModule(
             shader_module_name.c_str(),
             util::ToString<VkResult>(returnValue).c_str());
 
-    // emit delete the allocated spv data.
-    fprintf(file, "\t\tdelete [] %s;\n\n", code_var_name.c_str());
+    fprintf(file, "\t}\n");
+}
+
+void VulkanCppConsumerBase::Generate_vkCmdUpdateBuffer(format::HandleId         commandBuffer,
+                                                       format::HandleId         dstBuffer,
+                                                       VkDeviceSize             dstOffset,
+                                                       VkDeviceSize             dataSize,
+                                                       PointerDecoder<uint8_t>* pData)
+{
+    FILE* file = GetFrameFile();
+
+    // The update data is stored in the data pack instead of being emitted as an array initializer, which keeps the
+    // generated sources small and lets the command read the data directly from the mapped pack file.
+    std::string pdata_value = "NULL";
+    if ((dataSize > 0) && (pData->GetPointer() != nullptr))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, dataSize);
+        const SavedFileInfo file_info =
+            data_packer_.AddFileContents(pData->GetPointer(), static_cast<size_t>(dataSize));
+        pdata_value = GenerateGetData(file_info, "uint8_t");
+    }
+
+    fprintf(file, "\t{\n");
+    fprintf(file,
+            "\t\tvkCmdUpdateBuffer(%s, %s, %" PRIu64 "UL, %" PRIu64 "UL, %s);\n",
+            GetHandle(commandBuffer).c_str(),
+            GetHandle(dstBuffer).c_str(),
+            dstOffset,
+            dataSize,
+            pdata_value.c_str());
     fprintf(file, "\t}\n");
 }
 
@@ -74,6 +74,9 @@ class VulkanCppConsumerBase : public VulkanConsumer
                           uint64_t           offset,
                           uint64_t           size);
 
+    // Returns an expression that evaluates to a pointer of the given type to the data stored in a data file.
+    std::string GenerateGetData(const SavedFileInfo& file_info, const std::string& type);
+
     bool IsValid() const { return (main_file_ != nullptr); }
 
     const std::string& GetFilename() const { return filename_; }
@@ -266,6 +269,12 @@ class VulkanCppConsumerBase : public VulkanConsumer
                                        StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
                                        HandlePointerDecoder<VkShaderModule>*                   pShaderModule);
 
+    void Generate_vkCmdUpdateBuffer(format::HandleId         commandBuffer,
+                                    format::HandleId         dstBuffer,
+                                    VkDeviceSize             dstOffset,
+                                    VkDeviceSize             dataSize,
+                                    PointerDecoder<uint8_t>* pData);
+
     void Generate_vkCreatePipelineCache(VkResult                                                 returnValue,
                                         format::HandleId                                         device,
                                         StructPointerDecoder<Decoded_VkPipelineCacheCreateInfo>* pCreateInfo,
@@ -679,6 +688,8 @@ class VulkanCppConsumerBase : public VulkanConsumer
 
     void NewFrameFile(uint32_t frameNumber, uint32_t frameSplitNumber);
     void EndFrameFile(uint32_t frameNumber, uint32_t frameSplitNumber);
+    void NewFrameFunction(uint32_t frameNumber, uint32_t frameSplitNumber);
+    void EndFrameFunction(uint32_t frameNumber, uint32_t frameSplitNumber);
     void NextFrame(bool isSplit);
 
     void Post_APICall(format::ApiCallId callId);
@@ -744,6 +755,7 @@ class VulkanCppConsumerBase : public VulkanConsumer
     uint32_t                                           frame_number_;
     uint32_t                                           frame_split_number_;
     uint32_t                                           frame_api_call_number_;
+    uint32_t                                           file_api_call_number_;
     uint32_t                                           api_call_number_;
     std::vector<FrameTempMemory>                       frame_split_temp_memory_;
     FILE*                                              frame_file_;
@@ -202,6 +202,10 @@ extern void LogVkError(const char* function,
                        const char* file,
                        int line,
                        VkResult capturedReturnValue);
+extern const uint8_t* GetBinaryData(const char* filename,
+                                    size_t file_offset,
+                                    size_t data_size,
+                                    struct XCBApp& appdata);
 extern size_t LoadBinaryData(const char* filename,
                              size_t file_offset,
                              void* buffer,
@@ -211,6 +215,10 @@ extern size_t LoadBinaryData(const char* filename,
 )";
 
 static const char* sXcbOutputOverrideMethod = R"(
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 void OverrideVkXcbSurfaceCreateInfoKHR(VkXcbSurfaceCreateInfoKHR* createInfo,
                                        struct XCBApp& appdata) {
     // Open the connection to the X server
@@ -285,28 +293,61 @@ void UpdateWindowSize(uint32_t width,
     appdata.height = height;
 }
 
-size_t LoadBinaryData(const char* filename,
-                      size_t file_offset,
-                      void* buffer,
-                      size_t offset,
-                      size_t data_size,
-                      struct XCBApp& appdata) {
+struct MappedBinaryFile {
+    const uint8_t* data { nullptr };
+    size_t size { 0 };
+};
+
+// Data files are mapped once and stay mapped until the application exits, so that their contents can be passed to
+// Vulkan commands without reading the file again.
+const uint8_t* GetBinaryData(const char* filename,
+                             size_t file_offset,
+                             size_t data_size,
+                             struct XCBApp& appdata) {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr) {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
+    static std::unordered_map<std::string, MappedBinaryFile> mapped_files;
+
+    MappedBinaryFile& mapped_file = mapped_files[filename];
+    if (mapped_file.data == nullptr) {
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        struct stat file_stat;
+        if ((fstat(fd, &file_stat) != 0) || (file_stat.st_size == 0)) {
+            close(fd);
+            throw std::runtime_error("Error while reading file: " + std::string(filename));
+        }
+
+        void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        mapped_file.data = (const uint8_t*)data;
+        mapped_file.size = file_stat.st_size;
     }
 
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t*)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size) {
-        fclose(fp);
+    if ((file_offset + data_size) > mapped_file.size) {
         throw std::runtime_error("Error while reading file: " + std::string(filename));
     }
 
-    fclose(fp);
-    return read_size;
+    return mapped_file.data + file_offset;
+}
+
+size_t LoadBinaryData(const char* filename,
+                      size_t file_offset,
+                      void* buffer,
+                      size_t offset,
+                      size_t data_size,
+                      struct XCBApp& appdata) {
+    const uint8_t* data = GetBinaryData(filename, file_offset, data_size, appdata);
+    memcpy((uint8_t*)buffer + offset, data, data_size);
+    return data_size;
 }
 
 XCBApp appdata(%d, %d);
@@ -389,6 +430,10 @@ extern void LogVkError(const char* function,
                        const char* file,
                        int line,
                        VkResult capturedReturnValue);
+extern const uint8_t* GetBinaryData(const char* filename,
+                                    size_t file_offset,
+                                    size_t data_size,
+                                    struct WaylandApp& appdata);
 extern size_t LoadBinaryData(const char* filename,
                              size_t file_offset,
                              void* buffer,
@@ -401,6 +446,7 @@ static const char* sWaylandOutputOverrideMethod = R"(
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -548,31 +594,68 @@ void UpdateWindowSize(uint32_t width, uint32_t height, uint32_t pretransform, Wa
     appdata.height = height;
 }
 
-size_t LoadBinaryData(const char* filename,
-                      size_t file_offset,
-                      void* buffer,
-                      size_t offset,
-                      size_t data_size,
-                      WaylandApp& appdata)
+struct MappedBinaryFile {
+    const uint8_t* data { nullptr };
+    size_t size { 0 };
+};
+
+// Data files are mapped once and stay mapped until the application exits, so that their contents can be passed to
+// Vulkan commands without reading the file again.
+const uint8_t* GetBinaryData(const char* filename,
+                             size_t file_offset,
+                             size_t data_size,
+                             WaylandApp& appdata)
 {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr)
+    static std::unordered_map<std::string, MappedBinaryFile> mapped_files;
+
+    MappedBinaryFile& mapped_file = mapped_files[filename];
+    if (mapped_file.data == nullptr)
     {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        struct stat file_stat;
+        if ((fstat(fd, &file_stat) != 0) || (file_stat.st_size == 0))
+        {
+            close(fd);
+            throw std::runtime_error("Error while reading file: " + std::string(filename));
+        }
+
+        void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        mapped_file.data = (const uint8_t*)data;
+        mapped_file.size = file_stat.st_size;
     }
 
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t *)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size)
+    if ((file_offset + data_size) > mapped_file.size)
     {
-        fclose(fp);
         throw std::runtime_error("Error while reading file: " + std::string(filename));
     }
 
-    fclose(fp);
-    return read_size;
+    return mapped_file.data + file_offset;
+}
+
+size_t LoadBinaryData(const char* filename,
+                      size_t file_offset,
+                      void* buffer,
+                      size_t offset,
+                      size_t data_size,
+                      WaylandApp& appdata)
+{
+    const uint8_t* data = GetBinaryData(filename, file_offset, data_size, appdata);
+    memcpy((uint8_t*)buffer + offset, data, data_size);
+    return data_size;
 }
 
 WaylandApp appdata(%d, %d);
@@ -616,7 +699,9 @@ static const char* sAndroidOutputGlobalSource = R"(
 #include "VulkanMain.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <string>
+#include <unordered_map>
 #include <vulkan/vulkan.h>
 
 void OverrideVkAndroidSurfaceCreateInfoKHR(VkAndroidSurfaceCreateInfoKHR* createInfo, struct android_app* appdata)
@@ -627,6 +712,43 @@ void OverrideVkAndroidSurfaceCreateInfoKHR(VkAndroidSurfaceCreateInfoKHR* create
     createInfo->window = appdata->window;
 }
 
+// Only the data file that was used last is kept open in buffer mode, so that the data of consecutive commands, which
+// is stored consecutively, can be passed to Vulkan commands without reading the asset again. The asset manager maps
+// uncompressed assets into memory, and reads compressed assets into memory in full, so the data is split into pack
+// files of at most about 40 MB, and only one of them is held in memory. The returned pointer is valid until data from
+// another file is requested.
+const uint8_t* GetBinaryData(const char* filename, size_t file_offset, size_t data_size, android_app* app)
+{
+    static std::string opened_filename;
+    static AAsset*     opened_file = nullptr;
+
+    if ((opened_file == nullptr) || (opened_filename != filename))
+    {
+        if (opened_file != nullptr)
+        {
+            AAsset_close(opened_file);
+            opened_file = nullptr;
+        }
+
+        opened_file = AAssetManager_open(app->activity->assetManager, filename, AASSET_MODE_BUFFER);
+        if (!opened_file)
+        {
+            throw std::runtime_error("Can't open file: " + std::string(filename));
+        }
+
+        opened_filename = filename;
+    }
+
+    const uint8_t* data = (const uint8_t*)AAsset_getBuffer(opened_file);
+    if ((data == nullptr) || ((file_offset + data_size) > (size_t)AAsset_getLength64(opened_file)))
+    {
+        throw std::runtime_error("Error while reading file: " + std::string(filename));
+    }
+
+    return data + file_offset;
+}
+
+// The data is read from the asset into the destination buffer, without holding the asset in memory.
 void LoadBinaryData(
     const char* filename, size_t file_offset, void* buffer, size_t offset, size_t data_size, android_app* app)
 {
@@ -637,12 +759,21 @@ void LoadBinaryData(
     }
 
     AAsset_seek64(file, file_offset, SEEK_SET);
-    int read_size = AAsset_read(file, (uint8_t*)buffer + offset, data_size);
-    if (read_size < 0)
+
+    uint8_t* dst = (uint8_t*)buffer + offset;
+    while (data_size > 0)
     {
-        AAsset_close(file);
-        throw std::runtime_error("Error while reading file: " + std::string(filename));
+        int read_size = AAsset_read(file, dst, data_size);
+        if (read_size <= 0)
+        {
+            AAsset_close(file);
+            throw std::runtime_error("Error while reading file: " + std::string(filename));
+        }
+
+        dst += read_size;
+        data_size -= read_size;
     }
+
     AAsset_close(file);
 }
 
@@ -839,6 +970,10 @@ static const char* sAndroidOutputHeader = R"(
 
 extern void OverrideVkAndroidSurfaceCreateInfoKHR(VkAndroidSurfaceCreateInfoKHR* createInfo,
                                                   struct android_app* appdata);
+extern const uint8_t* GetBinaryData(const char* filename,
+                                    size_t file_offset,
+                                    size_t data_size,
+                                    android_app* app);
 extern void LoadBinaryData(const char* filename,
                            size_t file_offset,
                            void* buffer,
@@ -936,6 +1071,10 @@ extern void LogVkError(const char* function,
                        const char* file,
                        int line,
                        VkResult capturedReturnValue);
+extern const uint8_t* GetBinaryData(const char* filename,
+                                    size_t file_offset,
+                                    size_t data_size,
+                                    struct Win32App& appdata);
 extern size_t LoadBinaryData(const char* filename,
                              size_t file_offset,
                              void* buffer,
@@ -979,29 +1118,69 @@ void UpdateWindowSize(uint32_t width,
     appdata.height = height;
 }
 
-size_t LoadBinaryData(const char* filename,
-                      size_t file_offset,
-                      void* buffer,
-                      size_t offset,
-                      size_t data_size,
-                      struct Win32App& appdata)
+struct MappedBinaryFile {
+    const uint8_t* data { nullptr };
+    size_t size { 0 };
+};
+
+// Data files are mapped once and stay mapped until the application exits, so that their contents can be passed to
+// Vulkan commands without reading the file again.
+const uint8_t* GetBinaryData(const char* filename,
+                             size_t file_offset,
+                             size_t data_size,
+                             struct Win32App& appdata)
 {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr) {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
+    static std::unordered_map<std::string, MappedBinaryFile> mapped_files;
+
+    MappedBinaryFile& mapped_file = mapped_files[filename];
+    if (mapped_file.data == nullptr) {
+        HANDLE file = CreateFileA(
+            filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || (file_size.QuadPart == 0)) {
+            CloseHandle(file);
+            throw std::runtime_error("Error while reading file: " + std::string(filename));
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (data == nullptr) {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        mapped_file.data = (const uint8_t*)data;
+        mapped_file.size = (size_t)file_size.QuadPart;
     }
 
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t*)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size) {
-        fclose(fp);
+    if ((file_offset + data_size) > mapped_file.size) {
         throw std::runtime_error("Error while reading file: " + std::string(filename));
     }
 
-    fclose(fp);
-    return read_size;
+    return mapped_file.data + file_offset;
+}
+
+size_t LoadBinaryData(const char* filename,
+                      size_t file_offset,
+                      void* buffer,
+                      size_t offset,
+                      size_t data_size,
+                      struct Win32App& appdata)
+{
+    const uint8_t* data = GetBinaryData(filename, file_offset, data_size, appdata);
+    memcpy((uint8_t*)buffer + offset, data, data_size);
+    return data_size;
 }
 
 Win32App appdata(%d, %d);
@@ -15,6 +15,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <functional>
 
 #include "decode/vulkan_cpp_util_datapack.h"
@@ -26,72 +27,113 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+DataFilePacker::~DataFilePacker()
+{
+    Close();
+}
+
 void DataFilePacker::Initialize(const std::string& outDir,
                                 const std::string& prefix,
                                 const std::string& suffix,
-                                uint32_t           sizeLimitInBytes)
+                                uint64_t           sizeLimitInBytes,
+                                uint64_t           alignment)
 {
     out_dir_             = outDir;
     prefix_              = prefix;
     suffix_              = suffix;
     size_limit_in_bytes_ = sizeLimitInBytes;
+    alignment_           = (alignment > 0) ? alignment : 1;
 
     NewTargetFile();
 }
 
 const SavedFileInfo DataFilePacker::AddFileContents(const uint8_t* data, const size_t dataSize)
 {
-    const uint64_t hash_value = util::hash::GenerateCheckSum<uint64_t>(data, dataSize);
-    SavedFileInfo& data_entry = data_file_map_[hash_value];
+    const uint64_t              hash_value   = util::hash::GenerateCheckSum<uint64_t>(data, dataSize);
+    std::vector<SavedFileInfo>& data_entries = data_file_map_[hash_value];
 
-    if (data_entry.file_path.empty())
+    for (const SavedFileInfo& data_entry : data_entries)
     {
-        // The binary contents is not found in any previous chunk.
-        if (current_data_file_.current_size > size_limit_in_bytes_)
+        if (data_entry.data_size == dataSize)
         {
-            // Reached the current file size limit, create a new data chunk.
-            NewTargetFile();
+            // The binary contents were already stored by a previous call.
+            return data_entry;
         }
+    }
+
+    if (current_data_file_.current_size > size_limit_in_bytes_)
+    {
+        // Reached the current file size limit, create a new data chunk.
+        NewTargetFile();
+    }
 
-        data_entry.file_path   = current_data_file_.file_path;
-        data_entry.byte_offset = current_data_file_.current_size;
+    // Pad the data file so that each block starts at a multiple of the alignment, which allows the generated code to
+    // use pointers into the mapped data file directly.
+    const uint64_t padding = (alignment_ - (current_data_file_.current_size % alignment_)) % alignment_;
+    if (padding > 0)
+    {
+        static const uint8_t kZeroPadding[64] = {};
 
-        WriteContentsToFile(
-            util::filepath::Join(out_dir_, data_entry.file_path), data_entry.byte_offset, dataSize, data);
+        uint64_t remaining = padding;
+        while (remaining > 0)
+        {
+            const uint64_t chunk_size = std::min<uint64_t>(remaining, sizeof(kZeroPadding));
+            WriteContents(chunk_size, kZeroPadding);
+            remaining -= chunk_size;
+        }
 
-        current_data_file_.current_size += dataSize;
+        current_data_file_.current_size += padding;
     }
 
+    SavedFileInfo data_entry{ current_data_file_.file_path, current_data_file_.current_size, dataSize };
+
+    WriteContents(dataSize, data);
+    current_data_file_.current_size += dataSize;
+
+    data_entries.push_back(data_entry);
+
     return data_entry;
 }
 
+void DataFilePacker::Close()
+{
+    if (current_file_ != nullptr)
+    {
+        util::platform::FileClose(current_file_);
+        current_file_ = nullptr;
+    }
+}
+
 void DataFilePacker::NewTargetFile(void)
 {
+    Close();
+
     current_data_file_ = SavedFile{ prefix_ + std::to_string(++data_file_counter_) + "." + suffix_, 0 };
 }
 
-void DataFilePacker::WriteContentsToFile(const std::string& file_path,
-                                         uint64_t           fileOffset,
-                                         uint64_t           size,
-                                         const uint8_t*     data)
+bool DataFilePacker::WriteContents(uint64_t size, const uint8_t* data)
 {
-    FILE*   fp     = nullptr;
-    int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "ab");
-
-    if (result != 0)
+    if (current_file_ == nullptr)
     {
-        fprintf(stderr, "Error while opening file: %s\n", file_path.c_str());
-        return;
-    }
+        // The file stays open until the next data file is started, to avoid reopening it for every block.
+        const std::string file_path = util::filepath::Join(out_dir_, current_data_file_.file_path);
+        int32_t           result    = util::platform::FileOpen(&current_file_, file_path.c_str(), "wb");
 
-    util::platform::FileSeek(fp, fileOffset, util::platform::FileSeekCurrent);
+        if ((result != 0) || (current_file_ == nullptr))
+        {
+            fprintf(stderr, "Error while opening file: %s\n", file_path.c_str());
+            current_file_ = nullptr;
+            return false;
+        }
+    }
 
-    if (!util::platform::FileWrite(data, size, fp))
+    if (!util::platform::FileWrite(data, static_cast<size_t>(size), current_file_))
     {
-        fprintf(stderr, "Error while saving data into %s\n", file_path.c_str());
+        fprintf(stderr, "Error while saving data into %s\n", current_data_file_.file_path.c_str());
+        return false;
     }
 
-    util::platform::FileClose(fp);
+    return true;
 }
 
 GFXRECON_END_NAMESPACE(decode)
@@ -18,8 +18,11 @@
 #ifndef GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 #define GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 
-#include <unordered_map>
+#include <cstdio>
+#include <limits>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "util/defines.h"
 
@@ -30,22 +33,34 @@ struct SavedFileInfo
 {
     std::string file_path;
     uint64_t    byte_offset;
+    uint64_t    data_size;
 };
 
+// Writes binary data blocks into data files and returns the file and offset where each block can be found.
+// Identical blocks are only stored once. With a size limit of kNoSizeLimit all blocks are stored in a single pack file
+// that the generated code maps into memory once, instead of opening and reading a file for every block.
 class DataFilePacker
 {
   public:
-    DataFilePacker() : data_file_counter_(0) {}
+    static constexpr uint64_t kNoSizeLimit = std::numeric_limits<uint64_t>::max();
+
+    DataFilePacker() : size_limit_in_bytes_(0), alignment_(1), data_file_counter_(0), current_file_(nullptr) {}
+
+    ~DataFilePacker();
 
     void                Initialize(const std::string& outDir,
                                    const std::string& prefix,
                                    const std::string& suffix,
-                                   uint32_t           sizeLimitInBytes);
+                                   uint64_t           sizeLimitInBytes,
+                                   uint64_t           alignment = 1);
     const SavedFileInfo AddFileContents(const uint8_t* data, const size_t dataSize);
 
+    // Closes the data file that is currently being written.
+    void Close();
+
   private:
     void NewTargetFile(void);
-    void WriteContentsToFile(const std::string& filePath, uint64_t fileOffset, uint64_t size, const uint8_t* data);
+    bool WriteContents(uint64_t size, const uint8_t* data);
 
     struct SavedFile
     {
@@ -56,11 +71,14 @@ class DataFilePacker
     std::string out_dir_;
     std::string prefix_;
     std::string suffix_;
-    uint32_t    size_limit_in_bytes_;
+    uint64_t    size_limit_in_bytes_;
+    uint64_t    alignment_;
     uint32_t    data_file_counter_;
 
-    std::unordered_map<uint64_t, SavedFileInfo> data_file_map_;
-    SavedFile                                   current_data_file_;
+    // Blocks are indexed by content hash. Blocks with the same hash but a different size are stored separately.
+    std::unordered_map<uint64_t, std::vector<SavedFileInfo>> data_file_map_;
+    SavedFile                                                current_data_file_;
+    FILE*                                                    current_file_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
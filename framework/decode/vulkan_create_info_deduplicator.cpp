@@ -0,0 +1,455 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/vulkan_create_info_deduplicator.h"
+
+#include <cstring>
+#include <type_traits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Appends the values of create info structures to a deduplication key. Array sizes and the presence of optional
+// structures are written with the values, so that different structures cannot produce the same key.
+class DeduplicationKeyWriter
+{
+  public:
+    explicit DeduplicationKeyWriter(std::string* key) : key_(key) { key_->clear(); }
+
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value,
+                      "Only scalar values and handles can be written to a deduplication key");
+        key_->append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void WriteArray(const T* values, size_t count)
+    {
+        Write(count);
+        if ((values != nullptr) && (count > 0))
+        {
+            key_->append(reinterpret_cast<const char*>(values), count * sizeof(T));
+        }
+    }
+
+    void WriteBytes(const void* data, size_t size) { WriteArray(reinterpret_cast<const uint8_t*>(data), size); }
+
+    void WriteString(const char* value)
+    {
+        Write(value != nullptr);
+        if (value != nullptr)
+        {
+            WriteBytes(value, strlen(value));
+        }
+    }
+
+    // Writes whether an optional structure is present, and returns true if it is.
+    bool WritePresence(const void* value)
+    {
+        Write(value != nullptr);
+        return value != nullptr;
+    }
+
+  private:
+    std::string* key_;
+};
+
+static bool WriteShaderModuleCreateInfo(DeduplicationKeyWriter* writer, const VkShaderModuleCreateInfo& create_info);
+
+// Only pNext structures that do not return data and that are commonly used with shader modules and pipelines are
+// supported. Any other structure prevents deduplication.
+static bool WriteNextChain(DeduplicationKeyWriter* writer, const void* next)
+{
+    auto current = reinterpret_cast<const VkBaseInStructure*>(next);
+
+    while (current != nullptr)
+    {
+        writer->Write(current->sType);
+
+        switch (current->sType)
+        {
+            case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
+                if (!WriteShaderModuleCreateInfo(writer, *reinterpret_cast<const VkShaderModuleCreateInfo*>(current)))
+                {
+                    return false;
+                }
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            {
+                auto rendering_info = reinterpret_cast<const VkPipelineRenderingCreateInfo*>(current);
+                writer->Write(rendering_info->viewMask);
+                writer->WriteArray(rendering_info->pColorAttachmentFormats, rendering_info->colorAttachmentCount);
+                writer->Write(rendering_info->depthAttachmentFormat);
+                writer->Write(rendering_info->stencilAttachmentFormat);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+                writer->Write(
+                    reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo*>(current)
+                        ->requiredSubgroupSize);
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
+            {
+                auto depth_clip_info =
+                    reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT*>(current);
+                writer->Write(depth_clip_info->flags);
+                writer->Write(depth_clip_info->depthClipEnable);
+                break;
+            }
+            default:
+                return false;
+        }
+
+        current = current->pNext;
+    }
+
+    return true;
+}
+
+static bool WriteShaderModuleCreateInfo(DeduplicationKeyWriter* writer, const VkShaderModuleCreateInfo& create_info)
+{
+    writer->Write(create_info.flags);
+    writer->WriteBytes(create_info.pCode, create_info.codeSize);
+    return WriteNextChain(writer, create_info.pNext);
+}
+
+static bool WriteShaderStageCreateInfo(DeduplicationKeyWriter*                        writer,
+                                       const Decoded_VkPipelineShaderStageCreateInfo& stage_meta,
+                                       const SharedShaderModuleIdFunction&            get_shared_module_id)
+{
+    const VkPipelineShaderStageCreateInfo& stage = *stage_meta.decoded_value;
+
+    writer->Write(stage.flags);
+    writer->Write(stage.stage);
+
+    // Modules that share a deduplicated driver object are identified by the shared object, so that pipelines created
+    // from identical modules are also deduplicated.
+    uint64_t shared_module_id = 0;
+    if (get_shared_module_id(stage_meta.module, &shared_module_id))
+    {
+        writer->Write(true);
+        writer->Write(shared_module_id);
+    }
+    else
+    {
+        writer->Write(false);
+        writer->Write(stage_meta.module);
+    }
+
+    writer->WriteString(stage.pName);
+
+    if (writer->WritePresence(stage.pSpecializationInfo))
+    {
+        const VkSpecializationInfo* specialization_info = stage.pSpecializationInfo;
+        writer->Write(specialization_info->mapEntryCount);
+        if (specialization_info->pMapEntries != nullptr)
+        {
+            for (uint32_t i = 0; i < specialization_info->mapEntryCount; ++i)
+            {
+                writer->Write(specialization_info->pMapEntries[i].constantID);
+                writer->Write(specialization_info->pMapEntries[i].offset);
+                writer->Write(specialization_info->pMapEntries[i].size);
+            }
+        }
+        writer->WriteBytes(specialization_info->pData, specialization_info->dataSize);
+    }
+
+    return WriteNextChain(writer, stage.pNext);
+}
+
+static void WriteStencilOpState(DeduplicationKeyWriter* writer, const VkStencilOpState& state)
+{
+    writer->Write(state.failOp);
+    writer->Write(state.passOp);
+    writer->Write(state.depthFailOp);
+    writer->Write(state.compareOp);
+    writer->Write(state.compareMask);
+    writer->Write(state.writeMask);
+    writer->Write(state.reference);
+}
+
+static bool WriteVertexInputState(DeduplicationKeyWriter* writer, const VkPipelineVertexInputStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+
+    writer->Write(state.vertexBindingDescriptionCount);
+    if (state.pVertexBindingDescriptions != nullptr)
+    {
+        for (uint32_t i = 0; i < state.vertexBindingDescriptionCount; ++i)
+        {
+            writer->Write(state.pVertexBindingDescriptions[i].binding);
+            writer->Write(state.pVertexBindingDescriptions[i].stride);
+            writer->Write(state.pVertexBindingDescriptions[i].inputRate);
+        }
+    }
+
+    writer->Write(state.vertexAttributeDescriptionCount);
+    if (state.pVertexAttributeDescriptions != nullptr)
+    {
+        for (uint32_t i = 0; i < state.vertexAttributeDescriptionCount; ++i)
+        {
+            writer->Write(state.pVertexAttributeDescriptions[i].location);
+            writer->Write(state.pVertexAttributeDescriptions[i].binding);
+            writer->Write(state.pVertexAttributeDescriptions[i].format);
+            writer->Write(state.pVertexAttributeDescriptions[i].offset);
+        }
+    }
+
+    return WriteNextChain(writer, state.pNext);
+}
+
+static bool WriteViewportState(DeduplicationKeyWriter* writer, const VkPipelineViewportStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+
+    writer->Write(state.viewportCount);
+    if (writer->WritePresence(state.pViewports))
+    {
+        for (uint32_t i = 0; i < state.viewportCount; ++i)
+        {
+            writer->Write(state.pViewports[i].x);
+            writer->Write(state.pViewports[i].y);
+            writer->Write(state.pViewports[i].width);
+            writer->Write(state.pViewports[i].height);
+            writer->Write(state.pViewports[i].minDepth);
+            writer->Write(state.pViewports[i].maxDepth);
+        }
+    }
+
+    writer->Write(state.scissorCount);
+    if (writer->WritePresence(state.pScissors))
+    {
+        for (uint32_t i = 0; i < state.scissorCount; ++i)
+        {
+            writer->Write(state.pScissors[i].offset.x);
+            writer->Write(state.pScissors[i].offset.y);
+            writer->Write(state.pScissors[i].extent.width);
+            writer->Write(state.pScissors[i].extent.height);
+        }
+    }
+
+    return WriteNextChain(writer, state.pNext);
+}
+
+static bool WriteRasterizationState(DeduplicationKeyWriter*                       writer,
+                                    const VkPipelineRasterizationStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+    writer->Write(state.depthClampEnable);
+    writer->Write(state.rasterizerDiscardEnable);
+    writer->Write(state.polygonMode);
+    writer->Write(state.cullMode);
+    writer->Write(state.frontFace);
+    writer->Write(state.depthBiasEnable);
+    writer->Write(state.depthBiasConstantFactor);
+    writer->Write(state.depthBiasClamp);
+    writer->Write(state.depthBiasSlopeFactor);
+    writer->Write(state.lineWidth);
+    return WriteNextChain(writer, state.pNext);
+}
+
+static bool WriteMultisampleState(DeduplicationKeyWriter* writer, const VkPipelineMultisampleStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+    writer->Write(state.rasterizationSamples);
+    writer->Write(state.sampleShadingEnable);
+    writer->Write(state.minSampleShading);
+
+    if (writer->WritePresence(state.pSampleMask))
+    {
+        // The sample mask has one bit per sample, stored in 32-bit words.
+        writer->WriteArray(state.pSampleMask, (static_cast<size_t>(state.rasterizationSamples) + 31) / 32);
+    }
+
+    writer->Write(state.alphaToCoverageEnable);
+    writer->Write(state.alphaToOneEnable);
+    return WriteNextChain(writer, state.pNext);
+}
+
+static bool WriteDepthStencilState(DeduplicationKeyWriter* writer, const VkPipelineDepthStencilStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+    writer->Write(state.depthTestEnable);
+    writer->Write(state.depthWriteEnable);
+    writer->Write(state.depthCompareOp);
+    writer->Write(state.depthBoundsTestEnable);
+    writer->Write(state.stencilTestEnable);
+    WriteStencilOpState(writer, state.front);
+    WriteStencilOpState(writer, state.back);
+    writer->Write(state.minDepthBounds);
+    writer->Write(state.maxDepthBounds);
+    return WriteNextChain(writer, state.pNext);
+}
+
+static bool WriteColorBlendState(DeduplicationKeyWriter* writer, const VkPipelineColorBlendStateCreateInfo& state)
+{
+    writer->Write(state.flags);
+    writer->Write(state.logicOpEnable);
+    writer->Write(state.logicOp);
+
+    writer->Write(state.attachmentCount);
+    if (state.pAttachments != nullptr)
+    {
+        for (uint32_t i = 0; i < state.attachmentCount; ++i)
+        {
+            const VkPipelineColorBlendAttachmentState& attachment = state.pAttachments[i];
+            writer->Write(attachment.blendEnable);
+            writer->Write(attachment.srcColorBlendFactor);
+            writer->Write(attachment.dstColorBlendFactor);
+            writer->Write(attachment.colorBlendOp);
+            writer->Write(attachment.srcAlphaBlendFactor);
+            writer->Write(attachment.dstAlphaBlendFactor);
+            writer->Write(attachment.alphaBlendOp);
+            writer->Write(attachment.colorWriteMask);
+        }
+    }
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        writer->Write(state.blendConstants[i]);
+    }
+
+    return WriteNextChain(writer, state.pNext);
+}
+
+bool GetDeduplicationKey(format::HandleId device_id, const VkShaderModuleCreateInfo& create_info, std::string* key)
+{
+    DeduplicationKeyWriter writer(key);
+    writer.Write(device_id);
+    return WriteShaderModuleCreateInfo(&writer, create_info);
+}
+
+bool GetDeduplicationKey(format::HandleId                            device_id,
+                         const Decoded_VkGraphicsPipelineCreateInfo& create_info_meta,
+                         const SharedShaderModuleIdFunction&         get_shared_module_id,
+                         std::string*                                key)
+{
+    const VkGraphicsPipelineCreateInfo& create_info = *create_info_meta.decoded_value;
+
+    DeduplicationKeyWriter writer(key);
+    writer.Write(device_id);
+    writer.Write(create_info.flags);
+
+    writer.Write(create_info.stageCount);
+    if (create_info.pStages != nullptr)
+    {
+        const Decoded_VkPipelineShaderStageCreateInfo* stages_meta = create_info_meta.pStages->GetMetaStructPointer();
+        for (uint32_t i = 0; i < create_info.stageCount; ++i)
+        {
+            if (!WriteShaderStageCreateInfo(&writer, stages_meta[i], get_shared_module_id))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (writer.WritePresence(create_info.pVertexInputState) &&
+        !WriteVertexInputState(&writer, *create_info.pVertexInputState))
+    {
+        return false;
+    }
+
+    if (writer.WritePresence(create_info.pInputAssemblyState))
+    {
+        writer.Write(create_info.pInputAssemblyState->flags);
+        writer.Write(create_info.pInputAssemblyState->topology);
+        writer.Write(create_info.pInputAssemblyState->primitiveRestartEnable);
+
+        if (!WriteNextChain(&writer, create_info.pInputAssemblyState->pNext))
+        {
+            return false;
+        }
+    }
+
+    if (writer.WritePresence(create_info.pTessellationState))
+    {
+        writer.Write(create_info.pTessellationState->flags);
+        writer.Write(create_info.pTessellationState->patchControlPoints);
+
+        if (!WriteNextChain(&writer, create_info.pTessellationState->pNext))
+        {
+            return false;
+        }
+    }
+
+    if ((writer.WritePresence(create_info.pViewportState) &&
+         !WriteViewportState(&writer, *create_info.pViewportState)) ||
+        (writer.WritePresence(create_info.pRasterizationState) &&
+         !WriteRasterizationState(&writer, *create_info.pRasterizationState)) ||
+        (writer.WritePresence(create_info.pMultisampleState) &&
+         !WriteMultisampleState(&writer, *create_info.pMultisampleState)) ||
+        (writer.WritePresence(create_info.pDepthStencilState) &&
+         !WriteDepthStencilState(&writer, *create_info.pDepthStencilState)) ||
+        (writer.WritePresence(create_info.pColorBlendState) &&
+         !WriteColorBlendState(&writer, *create_info.pColorBlendState)))
+    {
+        return false;
+    }
+
+    if (writer.WritePresence(create_info.pDynamicState))
+    {
+        writer.Write(create_info.pDynamicState->flags);
+        writer.WriteArray(create_info.pDynamicState->pDynamicStates, create_info.pDynamicState->dynamicStateCount);
+
+        if (!WriteNextChain(&writer, create_info.pDynamicState->pNext))
+        {
+            return false;
+        }
+    }
+
+    writer.Write(create_info_meta.layout);
+    writer.Write(create_info_meta.renderPass);
+    writer.Write(create_info.subpass);
+    writer.Write(create_info_meta.basePipelineHandle);
+    writer.Write(create_info.basePipelineIndex);
+
+    return WriteNextChain(&writer, create_info.pNext);
+}
+
+bool GetDeduplicationKey(format::HandleId                           device_id,
+                         const Decoded_VkComputePipelineCreateInfo& create_info_meta,
+                         const SharedShaderModuleIdFunction&        get_shared_module_id,
+                         std::string*                               key)
+{
+    const VkComputePipelineCreateInfo& create_info = *create_info_meta.decoded_value;
+
+    DeduplicationKeyWriter writer(key);
+    writer.Write(device_id);
+    writer.Write(create_info.flags);
+
+    if (!WriteShaderStageCreateInfo(&writer, *create_info_meta.stage, get_shared_module_id))
+    {
+        return false;
+    }
+
+    writer.Write(create_info_meta.layout);
+    writer.Write(create_info_meta.basePipelineHandle);
+    writer.Write(create_info.basePipelineIndex);
+
+    return WriteNextChain(&writer, create_info.pNext);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
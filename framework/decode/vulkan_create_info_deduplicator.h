@@ -0,0 +1,139 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_CREATE_INFO_DEDUPLICATOR_H
+#define GFXRECON_DECODE_VULKAN_CREATE_INFO_DEDUPLICATOR_H
+
+#include "decode/vulkan_object_info.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns true and sets shared_id when the shader module with the specified capture ID shares a deduplicated driver
+// object, which is then identified by the unique ID of the shared object.
+using SharedShaderModuleIdFunction = std::function<bool(format::HandleId module_id, uint64_t* shared_id)>;
+
+// Build a key that uniquely identifies the object that a create info structure creates on the specified device. The
+// key contains every value of the structure, including the content of referenced arrays and SPIR-V code, and the
+// structures of supported pNext chains. Referenced objects are identified by their capture IDs, which are never reused,
+// as the replay handle of a destroyed object can be reused by the driver for an object with different content. Returns
+// false if the structure cannot be deduplicated, such as when its pNext chain contains an unsupported structure.
+bool GetDeduplicationKey(format::HandleId device_id, const VkShaderModuleCreateInfo& create_info, std::string* key);
+
+bool GetDeduplicationKey(format::HandleId                            device_id,
+                         const Decoded_VkGraphicsPipelineCreateInfo& create_info,
+                         const SharedShaderModuleIdFunction&         get_shared_module_id,
+                         std::string*                                key);
+
+bool GetDeduplicationKey(format::HandleId                           device_id,
+                         const Decoded_VkComputePipelineCreateInfo& create_info,
+                         const SharedShaderModuleIdFunction&        get_shared_module_id,
+                         std::string*                               key);
+
+// Tracks the driver objects created for unique create info structures, so that objects created with identical create
+// info can share the same driver object. The tracker does not own the shared objects, which are released with the
+// last object info that references them.
+template <typename T>
+class VulkanCreateInfoDeduplicator
+{
+  public:
+    using SharedObject = std::shared_ptr<VulkanDeduplicatedObject<T>>;
+
+    // Returns the live object that was created with the specified key, or nullptr.
+    SharedObject Find(const std::string& key) const
+    {
+        SharedObject object;
+
+        auto entry = objects_.find(key);
+        if (entry != objects_.end())
+        {
+            object = entry->second.lock();
+        }
+
+        return object;
+    }
+
+    SharedObject Add(VkDevice device, T handle, std::string&& key)
+    {
+        auto object       = std::make_shared<VulkanDeduplicatedObject<T>>();
+        object->device    = device;
+        object->handle    = handle;
+        object->unique_id = next_unique_id_++;
+
+        auto entry = objects_.insert_or_assign(std::move(key), object).first;
+
+        // The key is stored once, by the map, as it can be as large as the SPIR-V code of a shader module.
+        object->key = &entry->first;
+
+        return object;
+    }
+
+    void Remove(VulkanDeduplicatedObject<T>* object)
+    {
+        if (object->key != nullptr)
+        {
+            objects_.erase(*object->key);
+            object->key = nullptr;
+        }
+    }
+
+    void RemoveDevice(VkDevice device)
+    {
+        for (auto entry = objects_.begin(); entry != objects_.end();)
+        {
+            auto object = entry->second.lock();
+            if ((object == nullptr) || (object->device == device))
+            {
+                if (object != nullptr)
+                {
+                    object->key = nullptr;
+                }
+
+                entry = objects_.erase(entry);
+            }
+            else
+            {
+                ++entry;
+            }
+        }
+    }
+
+  private:
+    std::unordered_map<std::string, std::weak_ptr<VulkanDeduplicatedObject<T>>> objects_;
+    uint64_t                                                                     next_unique_id_{ 1 };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_CREATE_INFO_DEDUPLICATOR_H
@@ -38,6 +38,27 @@ void VulkanDecoderBase::WaitIdle()
     }
 }
 
+void VulkanDecoderBase::SaveResourceState()
+{
+    for (auto consumer : consumers_)
+    {
+        consumer->SaveResourceState();
+    }
+}
+
+bool VulkanDecoderBase::RestoreResourceState()
+{
+    bool restored = true;
+    for (auto consumer : consumers_)
+    {
+        if (!consumer->RestoreResourceState())
+        {
+            restored = false;
+        }
+    }
+    return restored;
+}
+
 void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
 {
     for (auto consumer : consumers_)
@@ -551,6 +572,20 @@ void VulkanDecoderBase::DispatchSetTlasToBlasDependencyCommand(format::HandleId
     }
 }
 
+format::HandleId VulkanDecoderBase::GetCommandRecordingSyncId(format::HandleId command_buffer_id)
+{
+    for (auto consumer : consumers_)
+    {
+        format::HandleId pool_id = consumer->GetCommandBufferPoolId(command_buffer_id);
+        if (pool_id != format::kNullHandleId)
+        {
+            return pool_id;
+        }
+    }
+
+    return command_buffer_id;
+}
+
 void VulkanDecoderBase::DispatchSetEnvironmentVariablesCommand(format::SetEnvironmentVariablesCommand& header,
                                                                const char*                             env_string)
 {
@@ -57,6 +57,10 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual void WaitIdle() override;
 
+    virtual void SaveResourceState() override;
+
+    virtual bool RestoreResourceState() override;
+
     virtual bool IsComplete(uint64_t block_index) override
     {
         return decode::IsComplete<VulkanConsumer*>(consumers_, block_index);
@@ -185,6 +189,9 @@ class VulkanDecoderBase : public ApiDecoder
     virtual void DispatchSetTlasToBlasDependencyCommand(format::HandleId                     tlas,
                                                         const std::vector<format::HandleId>& blases) override;
 
+    // Returns the ID of the command pool that the command buffer was allocated from.
+    virtual format::HandleId GetCommandRecordingSyncId(format::HandleId command_buffer_id) override;
+
     virtual void DispatchInitDx12AccelerationStructureCommand(
         const format::InitDx12AccelerationStructureCommandHeader&       command_header,
         std::vector<format::InitDx12AccelerationStructureGeometryDesc>& geometry_descs,
@@ -26,6 +26,7 @@
 #include "decode/vulkan_object_info.h"
 #include "generated/generated_vulkan_struct_decoders.h"
 #include "util/platform.h"
+#include "util/streaming_memory_copy.h"
 
 #include <cassert>
 
@@ -521,7 +522,15 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
 
             size_t copy_size = static_cast<size_t>(size);
 
-            util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            if ((memory_alloc_info->property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) == 0)
+            {
+                // Memory that is not host cached is typically write-combined.
+                util::StreamingMemoryCopy(memory_alloc_info->mapped_pointer + offset, data, copy_size);
+            }
+            else
+            {
+                util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            }
 
             result = VK_SUCCESS;
         }
@@ -0,0 +1,502 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/vulkan_gpu_frame_timer.h"
+#include "generated/generated_vulkan_enum_to_string.h"
+#include "util/logging.h"
+
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns false for submissions with extension structures that describe the command buffers of the submission, which
+// would no longer match the command buffers when the timestamp command buffers are added.
+static bool CanAddCommandBuffers(const void* next)
+{
+    auto current = reinterpret_cast<const VkBaseInStructure*>(next);
+    while (current != nullptr)
+    {
+        if ((current->sType == VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO) ||
+            (current->sType == VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO))
+        {
+            return false;
+        }
+
+        current = current->pNext;
+    }
+
+    return true;
+}
+
+const VkSubmitInfo* VulkanGpuFrameTimer::AddTimestamps(const VulkanDeviceInfo*            device_info,
+                                                       const VulkanQueueInfo*             queue_info,
+                                                       const encode::VulkanInstanceTable* instance_table,
+                                                       const encode::VulkanDeviceTable*   device_table,
+                                                       uint32_t                           submit_count,
+                                                       const VkSubmitInfo*                submit_infos)
+{
+    VkCommandBuffer begin_command_buffer = VK_NULL_HANDLE;
+    VkCommandBuffer end_command_buffer   = VK_NULL_HANDLE;
+
+    if ((submit_count == 0) || !CanAddCommandBuffers(submit_infos[0].pNext) ||
+        !CanAddCommandBuffers(submit_infos[submit_count - 1].pNext) ||
+        !BeginSubmission(
+            device_info, queue_info, instance_table, device_table, &begin_command_buffer, &end_command_buffer))
+    {
+        return submit_infos;
+    }
+
+    submit_infos_.assign(submit_infos, submit_infos + submit_count);
+
+    VkSubmitInfo& first = submit_infos_.front();
+    VkSubmitInfo& last  = submit_infos_.back();
+
+    first_command_buffers_.assign(1, begin_command_buffer);
+    first_command_buffers_.insert(
+        first_command_buffers_.end(), first.pCommandBuffers, first.pCommandBuffers + first.commandBufferCount);
+
+    if (submit_count == 1)
+    {
+        first_command_buffers_.push_back(end_command_buffer);
+    }
+    else
+    {
+        last_command_buffers_.assign(last.pCommandBuffers, last.pCommandBuffers + last.commandBufferCount);
+        last_command_buffers_.push_back(end_command_buffer);
+
+        last.commandBufferCount = static_cast<uint32_t>(last_command_buffers_.size());
+        last.pCommandBuffers    = last_command_buffers_.data();
+    }
+
+    first.commandBufferCount = static_cast<uint32_t>(first_command_buffers_.size());
+    first.pCommandBuffers    = first_command_buffers_.data();
+
+    return submit_infos_.data();
+}
+
+const VkSubmitInfo2* VulkanGpuFrameTimer::AddTimestamps(const VulkanDeviceInfo*            device_info,
+                                                        const VulkanQueueInfo*             queue_info,
+                                                        const encode::VulkanInstanceTable* instance_table,
+                                                        const encode::VulkanDeviceTable*   device_table,
+                                                        uint32_t                           submit_count,
+                                                        const VkSubmitInfo2*               submit_infos)
+{
+    VkCommandBuffer begin_command_buffer = VK_NULL_HANDLE;
+    VkCommandBuffer end_command_buffer   = VK_NULL_HANDLE;
+
+    if ((submit_count == 0) || ((submit_infos[0].flags & VK_SUBMIT_PROTECTED_BIT) != 0) ||
+        ((submit_infos[submit_count - 1].flags & VK_SUBMIT_PROTECTED_BIT) != 0) ||
+        !BeginSubmission(
+            device_info, queue_info, instance_table, device_table, &begin_command_buffer, &end_command_buffer))
+    {
+        return submit_infos;
+    }
+
+    submit_infos2_.assign(submit_infos, submit_infos + submit_count);
+
+    VkSubmitInfo2& first = submit_infos2_.front();
+    VkSubmitInfo2& last  = submit_infos2_.back();
+
+    VkCommandBufferSubmitInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO };
+    begin_info.commandBuffer             = begin_command_buffer;
+
+    VkCommandBufferSubmitInfo end_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO };
+    end_info.commandBuffer             = end_command_buffer;
+
+    first_command_buffer_infos_.assign(1, begin_info);
+    first_command_buffer_infos_.insert(first_command_buffer_infos_.end(),
+                                       first.pCommandBufferInfos,
+                                       first.pCommandBufferInfos + first.commandBufferInfoCount);
+
+    if (submit_count == 1)
+    {
+        first_command_buffer_infos_.push_back(end_info);
+    }
+    else
+    {
+        last_command_buffer_infos_.assign(last.pCommandBufferInfos,
+                                          last.pCommandBufferInfos + last.commandBufferInfoCount);
+        last_command_buffer_infos_.push_back(end_info);
+
+        last.commandBufferInfoCount = static_cast<uint32_t>(last_command_buffer_infos_.size());
+        last.pCommandBufferInfos    = last_command_buffer_infos_.data();
+    }
+
+    first.commandBufferInfoCount = static_cast<uint32_t>(first_command_buffer_infos_.size());
+    first.pCommandBufferInfos    = first_command_buffer_infos_.data();
+
+    return submit_infos2_.data();
+}
+
+void VulkanGpuFrameTimer::EndSubmission(VkQueue queue, VkResult result)
+{
+    if (submission_device_ == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    auto& device_resources = device_resources_[submission_device_];
+    auto& submission       = device_resources.pending_submissions.back();
+
+    submission_device_ = VK_NULL_HANDLE;
+
+    if (result == VK_SUCCESS)
+    {
+        // The fence signal operation happens after all commands previously submitted to the queue have completed.
+        result = device_resources.device_table->QueueSubmit(
+            queue, 0, nullptr, device_resources.fences[submission.query_pair]);
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING_ONCE("Failed to submit the fence for GPU frame timing (%s)",
+                                      util::ToString<VkResult>(result).c_str());
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        // Release the query pair of the submission, which has no GPU time.
+        fps_info_->EndGpuTime(submission.frame_index, 0);
+        device_resources.next_query_pair = submission.query_pair;
+        device_resources.pending_submissions.pop_back();
+    }
+}
+
+void VulkanGpuFrameTimer::ReportGpuTimes(bool wait)
+{
+    for (auto& entry : device_resources_)
+    {
+        while (!entry.second.pending_submissions.empty() && ReportGpuTime(entry.first, &entry.second, wait))
+        {
+        }
+    }
+}
+
+void VulkanGpuFrameTimer::DestroyDeviceResources(VkDevice device, const encode::VulkanDeviceTable* device_table)
+{
+    auto entry = device_resources_.find(device);
+    if (entry != device_resources_.end())
+    {
+        auto& device_resources = entry->second;
+
+        while (!device_resources.pending_submissions.empty() && ReportGpuTime(device, &device_resources, true))
+        {
+        }
+
+        if (device_table != nullptr)
+        {
+            for (const auto& queue_family : device_resources.queue_families)
+            {
+                device_table->DestroyCommandPool(device, queue_family.second.command_pool, nullptr);
+            }
+
+            for (VkFence fence : device_resources.fences)
+            {
+                device_table->DestroyFence(device, fence, nullptr);
+            }
+
+            device_table->DestroyQueryPool(device, device_resources.query_pool, nullptr);
+        }
+
+        device_resources_.erase(entry);
+    }
+}
+
+bool VulkanGpuFrameTimer::BeginSubmission(const VulkanDeviceInfo*            device_info,
+                                          const VulkanQueueInfo*             queue_info,
+                                          const encode::VulkanInstanceTable* instance_table,
+                                          const encode::VulkanDeviceTable*   device_table,
+                                          VkCommandBuffer*                   begin_command_buffer,
+                                          VkCommandBuffer*                   end_command_buffer)
+{
+    assert((device_info != nullptr) && (queue_info != nullptr));
+
+    if (!fps_info_->IsMeasuringGpuTime())
+    {
+        return false;
+    }
+
+    VkDevice device           = device_info->handle;
+    auto     device_resources = GetDeviceResources(device_info, instance_table, device_table);
+    if (device_resources == nullptr)
+    {
+        return false;
+    }
+
+    auto queue_family = GetQueueFamilyResources(
+        device, device_info->parent, instance_table, queue_info->family_index, device_resources);
+    if (queue_family == nullptr)
+    {
+        return false;
+    }
+
+    // Report the submissions that have completed, and make the query pair of the oldest submission available when
+    // all query pairs are in use.
+    auto& pending_submissions = device_resources->pending_submissions;
+    while (!pending_submissions.empty() && ReportGpuTime(device, device_resources, false))
+    {
+    }
+
+    if (pending_submissions.size() == kQueryPairCount)
+    {
+        ReportGpuTime(device, device_resources, true);
+    }
+
+    PendingSubmission submission;
+    submission.query_pair     = device_resources->next_query_pair;
+    submission.timestamp_mask = queue_family->timestamp_mask;
+    submission.frame_index    = fps_info_->BeginGpuTime();
+
+    device_resources->next_query_pair = (submission.query_pair + 1) % kQueryPairCount;
+    pending_submissions.push_back(submission);
+    submission_device_ = device;
+
+    (*begin_command_buffer) = queue_family->begin_command_buffers[submission.query_pair];
+    (*end_command_buffer)   = queue_family->end_command_buffers[submission.query_pair];
+
+    return true;
+}
+
+VulkanGpuFrameTimer::DeviceResources*
+VulkanGpuFrameTimer::GetDeviceResources(const VulkanDeviceInfo*            device_info,
+                                        const encode::VulkanInstanceTable* instance_table,
+                                        const encode::VulkanDeviceTable*   device_table)
+{
+    VkDevice device = device_info->handle;
+
+    auto entry = device_resources_.find(device);
+    if (entry == device_resources_.end())
+    {
+        DeviceResources device_resources;
+        device_resources.device_table = device_table;
+
+        VkPhysicalDeviceProperties properties;
+        instance_table->GetPhysicalDeviceProperties(device_info->parent, &properties);
+        device_resources.timestamp_period = properties.limits.timestampPeriod;
+
+        VkQueryPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        create_info.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        create_info.queryCount            = kQueryPairCount * 2;
+
+        VkResult result = device_table->CreateQueryPool(device, &create_info, nullptr, &device_resources.query_pool);
+
+        VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        for (uint32_t i = 0; (i < kQueryPairCount) && (result == VK_SUCCESS); ++i)
+        {
+            VkFence fence = VK_NULL_HANDLE;
+            result        = device_table->CreateFence(device, &fence_info, nullptr, &fence);
+            if (result == VK_SUCCESS)
+            {
+                device_resources.fences.push_back(fence);
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            // The device is not timed, which is also recorded to avoid further attempts.
+            GFXRECON_LOG_WARNING("Failed to create the timestamp query pool for GPU frame timing (%s)",
+                                 util::ToString<VkResult>(result).c_str());
+
+            for (VkFence fence : device_resources.fences)
+            {
+                device_table->DestroyFence(device, fence, nullptr);
+            }
+
+            device_table->DestroyQueryPool(device, device_resources.query_pool, nullptr);
+            device_resources.fences.clear();
+            device_resources.query_pool = VK_NULL_HANDLE;
+        }
+
+        entry = device_resources_.emplace(device, std::move(device_resources)).first;
+    }
+
+    return (entry->second.query_pool != VK_NULL_HANDLE) ? &entry->second : nullptr;
+}
+
+VulkanGpuFrameTimer::QueueFamilyResources*
+VulkanGpuFrameTimer::GetQueueFamilyResources(VkDevice                           device,
+                                             VkPhysicalDevice                   physical_device,
+                                             const encode::VulkanInstanceTable* instance_table,
+                                             uint32_t                           queue_family_index,
+                                             DeviceResources*                   device_resources)
+{
+    auto entry = device_resources->queue_families.find(queue_family_index);
+    if (entry == device_resources->queue_families.end())
+    {
+        QueueFamilyResources queue_family;
+
+        uint32_t family_count = 0;
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, nullptr);
+
+        std::vector<VkQueueFamilyProperties> family_properties(family_count);
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(
+            physical_device, &family_count, family_properties.data());
+
+        uint32_t valid_bits = 0;
+        if (queue_family_index < family_count)
+        {
+            // Query pools can only be reset by graphics and compute queues.
+            const VkQueueFlags queue_flags = family_properties[queue_family_index].queueFlags;
+            if ((queue_flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) != 0)
+            {
+                valid_bits = family_properties[queue_family_index].timestampValidBits;
+            }
+        }
+
+        if (valid_bits > 0)
+        {
+            uint64_t mask = (valid_bits < 64) ? ((uint64_t{ 1 } << valid_bits) - 1) : ~uint64_t{ 0 };
+
+            const encode::VulkanDeviceTable* device_table = device_resources->device_table;
+            VkQueryPool                      query_pool   = device_resources->query_pool;
+
+            VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+            pool_info.queueFamilyIndex        = queue_family_index;
+
+            VkResult result = device_table->CreateCommandPool(device, &pool_info, nullptr, &queue_family.command_pool);
+
+            std::vector<VkCommandBuffer> command_buffers(kQueryPairCount * 2);
+            if (result == VK_SUCCESS)
+            {
+                VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+                allocate_info.commandPool                 = queue_family.command_pool;
+                allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+                allocate_info.commandBufferCount          = kQueryPairCount * 2;
+
+                result = device_table->AllocateCommandBuffers(device, &allocate_info, command_buffers.data());
+            }
+
+            // The command buffers are recorded once, and are submitted again each time their query pair is reused.
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+
+            for (uint32_t i = 0; (i < kQueryPairCount) && (result == VK_SUCCESS); ++i)
+            {
+                VkCommandBuffer begin_command_buffer = command_buffers[i * 2];
+                VkCommandBuffer end_command_buffer   = command_buffers[(i * 2) + 1];
+
+                result = device_table->BeginCommandBuffer(begin_command_buffer, &begin_info);
+                if (result == VK_SUCCESS)
+                {
+                    device_table->CmdResetQueryPool(begin_command_buffer, query_pool, i * 2, 2);
+                    device_table->CmdWriteTimestamp(
+                        begin_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, query_pool, i * 2);
+                    result = device_table->EndCommandBuffer(begin_command_buffer);
+                }
+
+                if (result == VK_SUCCESS)
+                {
+                    result = device_table->BeginCommandBuffer(end_command_buffer, &begin_info);
+                }
+
+                if (result == VK_SUCCESS)
+                {
+                    device_table->CmdWriteTimestamp(
+                        end_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, (i * 2) + 1);
+                    result = device_table->EndCommandBuffer(end_command_buffer);
+                }
+
+                queue_family.begin_command_buffers.push_back(begin_command_buffer);
+                queue_family.end_command_buffers.push_back(end_command_buffer);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                queue_family.timestamp_mask = mask;
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to create the timestamp command buffers for GPU frame timing (%s)",
+                                     util::ToString<VkResult>(result).c_str());
+            }
+        }
+
+        entry = device_resources->queue_families.emplace(queue_family_index, std::move(queue_family)).first;
+    }
+
+    // Submissions to queue families without timestamp support are not timed.
+    return (entry->second.timestamp_mask != 0) ? &entry->second : nullptr;
+}
+
+bool VulkanGpuFrameTimer::ReportGpuTime(VkDevice device, DeviceResources* device_resources, bool wait)
+{
+    assert(!device_resources->pending_submissions.empty());
+
+    const PendingSubmission&         submission   = device_resources->pending_submissions.front();
+    const encode::VulkanDeviceTable* device_table = device_resources->device_table;
+    VkFence                          fence        = device_resources->fences[submission.query_pair];
+
+    // The queries are reset by the submission, so they are read after the submission has completed. Until then, they
+    // can be uninitialized or hold the timestamps of the previous submission with the same query pair.
+    VkResult result = VK_SUCCESS;
+    if (wait)
+    {
+        result = device_table->WaitForFences(device, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+    else
+    {
+        result = device_table->GetFenceStatus(device, fence);
+    }
+
+    if (result == VK_NOT_READY)
+    {
+        return false;
+    }
+
+    uint64_t timestamps[2] = { 0, 0 };
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->GetQueryPoolResults(device,
+                                                   device_resources->query_pool,
+                                                   submission.query_pair * 2,
+                                                   2,
+                                                   sizeof(timestamps),
+                                                   timestamps,
+                                                   sizeof(uint64_t),
+                                                   VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    }
+
+    device_table->ResetFences(device, 1, &fence);
+
+    int64_t duration = 0;
+    if (result == VK_SUCCESS)
+    {
+        uint64_t ticks = (timestamps[1] - timestamps[0]) & submission.timestamp_mask;
+        duration       = static_cast<int64_t>(static_cast<double>(ticks) * device_resources->timestamp_period);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING_ONCE("Failed to read the timestamps for GPU frame timing (%s)",
+                                  util::ToString<VkResult>(result).c_str());
+    }
+
+    fps_info_->EndGpuTime(submission.frame_index, duration);
+    device_resources->pending_submissions.pop_front();
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,146 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_GPU_FRAME_TIMER_H
+#define GFXRECON_DECODE_VULKAN_GPU_FRAME_TIMER_H
+
+#include "decode/vulkan_object_info.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "graphics/fps_info.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Measures the GPU time of the frames of the measurement range with timestamp queries. The command buffers of each
+// queue submission are enclosed by command buffers that write a timestamp before and after them, and the difference
+// between the timestamps is added to the GPU time of the frame in which the submission was made. The timestamps of a
+// submission are read once a fence that is submitted after it has signaled, as the queries are reset by the GPU when
+// the submission starts.
+class VulkanGpuFrameTimer
+{
+  public:
+    VulkanGpuFrameTimer(graphics::FpsInfo* fps_info) : fps_info_(fps_info) {}
+
+    // Returns a copy of the submit infos with the timestamp command buffers added to the first and last submit info,
+    // or the original submit infos when the submission is not timed. The returned pointer is valid until the next
+    // call.
+    const VkSubmitInfo* AddTimestamps(const VulkanDeviceInfo*            device_info,
+                                      const VulkanQueueInfo*             queue_info,
+                                      const encode::VulkanInstanceTable* instance_table,
+                                      const encode::VulkanDeviceTable*   device_table,
+                                      uint32_t                           submit_count,
+                                      const VkSubmitInfo*                submit_infos);
+
+    const VkSubmitInfo2* AddTimestamps(const VulkanDeviceInfo*            device_info,
+                                       const VulkanQueueInfo*             queue_info,
+                                       const encode::VulkanInstanceTable* instance_table,
+                                       const encode::VulkanDeviceTable*   device_table,
+                                       uint32_t                           submit_count,
+                                       const VkSubmitInfo2*               submit_infos);
+
+    // Completes the submission made with the submit infos returned by the last call to AddTimestamps, by submitting the
+    // fence that signals when its timestamps are available. The submission is not timed when its result is an error.
+    void EndSubmission(VkQueue queue, VkResult result);
+
+    // Reports the GPU time of the timed submissions that have completed. When wait is true, waits for all timed
+    // submissions to complete.
+    void ReportGpuTimes(bool wait);
+
+    void DestroyDeviceResources(VkDevice device, const encode::VulkanDeviceTable* device_table);
+
+  private:
+    // Number of submissions per device that can be timed before the timestamps of the oldest submission are read.
+    static constexpr uint32_t kQueryPairCount = 256;
+
+    struct QueueFamilyResources
+    {
+        VkCommandPool                command_pool{ VK_NULL_HANDLE };
+        uint64_t                     timestamp_mask{ 0 };
+        std::vector<VkCommandBuffer> begin_command_buffers;
+        std::vector<VkCommandBuffer> end_command_buffers;
+    };
+
+    struct PendingSubmission
+    {
+        uint32_t query_pair{ 0 };
+        uint64_t timestamp_mask{ 0 };
+        size_t   frame_index{ 0 };
+    };
+
+    struct DeviceResources
+    {
+        const encode::VulkanDeviceTable*                   device_table{ nullptr };
+        VkQueryPool                                        query_pool{ VK_NULL_HANDLE };
+        std::vector<VkFence>                               fences;
+        double                                             timestamp_period{ 1.0 };
+        uint32_t                                           next_query_pair{ 0 };
+        std::unordered_map<uint32_t, QueueFamilyResources> queue_families;
+        std::deque<PendingSubmission>                      pending_submissions;
+    };
+
+  private:
+    // Assigns a query pair to a timed submission and returns its timestamp command buffers. Returns false when the
+    // submission cannot be timed.
+    bool BeginSubmission(const VulkanDeviceInfo*            device_info,
+                         const VulkanQueueInfo*             queue_info,
+                         const encode::VulkanInstanceTable* instance_table,
+                         const encode::VulkanDeviceTable*   device_table,
+                         VkCommandBuffer*                   begin_command_buffer,
+                         VkCommandBuffer*                   end_command_buffer);
+
+    DeviceResources* GetDeviceResources(const VulkanDeviceInfo*            device_info,
+                                        const encode::VulkanInstanceTable* instance_table,
+                                        const encode::VulkanDeviceTable*   device_table);
+
+    QueueFamilyResources* GetQueueFamilyResources(VkDevice                           device,
+                                                  VkPhysicalDevice                   physical_device,
+                                                  const encode::VulkanInstanceTable* instance_table,
+                                                  uint32_t                           queue_family_index,
+                                                  DeviceResources*                   device_resources);
+
+    bool ReportGpuTime(VkDevice device, DeviceResources* device_resources, bool wait);
+
+  private:
+    graphics::FpsInfo*                            fps_info_;
+    VkDevice                                      submission_device_{ VK_NULL_HANDLE };
+    std::unordered_map<VkDevice, DeviceResources> device_resources_;
+    std::vector<VkSubmitInfo>                     submit_infos_;
+    std::vector<VkSubmitInfo2>                    submit_infos2_;
+    std::vector<VkCommandBuffer>                  first_command_buffers_;
+    std::vector<VkCommandBuffer>                  last_command_buffers_;
+    std::vector<VkCommandBufferSubmitInfo>        first_command_buffer_infos_;
+    std::vector<VkCommandBufferSubmitInfo>        last_command_buffer_infos_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_GPU_FRAME_TIMER_H
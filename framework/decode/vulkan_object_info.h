@@ -35,12 +35,14 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 #include <future>
 #include <optional>
@@ -170,6 +172,47 @@ struct VulkanReplayDeviceInfo
     std::optional<VkPhysicalDeviceAccelerationStructurePropertiesKHR> acceleration_structure_properties;
 };
 
+// Replay time array counts for the array parameters of an object's query calls, indexed by the array index values
+// defined above. Objects only track a few counts, so they are stored in a flat array instead of a hash map, which
+// would allocate a bucket array and a node per entry.
+class VulkanArrayCounts
+{
+  public:
+    using Entry          = std::pair<uint32_t, size_t>;
+    using const_iterator = std::vector<Entry>::const_iterator;
+
+    size_t& operator[](uint32_t index)
+    {
+        for (auto& entry : entries_)
+        {
+            if (entry.first == index)
+            {
+                return entry.second;
+            }
+        }
+
+        entries_.emplace_back(index, 0);
+        return entries_.back().second;
+    }
+
+    const_iterator find(uint32_t index) const
+    {
+        return std::find_if(
+            entries_.begin(), entries_.end(), [index](const Entry& entry) { return entry.first == index; });
+    }
+
+    const_iterator begin() const { return entries_.begin(); }
+
+    const_iterator end() const { return entries_.end(); }
+
+    size_t size() const { return entries_.size(); }
+
+    size_t capacity() const { return entries_.capacity(); }
+
+  private:
+    std::vector<Entry> entries_;
+};
+
 template <typename T>
 struct VulkanObjectInfo
 {
@@ -196,6 +239,17 @@ struct VulkanObjectInfoAsync : public VulkanObjectInfo<T>
     uint32_t                                      future_handle_index = 0;
 };
 
+// Driver object shared by the objects that were created with identical create info when create info deduplication is
+// enabled. The driver object is destroyed with the last object that references it.
+template <typename T>
+struct VulkanDeduplicatedObject
+{
+    VkDevice           device{ VK_NULL_HANDLE };
+    T                  handle{ VK_NULL_HANDLE };
+    uint64_t           unique_id{ 0 }; // Never reused, unlike the handle value.
+    const std::string* key{ nullptr }; // Owned by VulkanCreateInfoDeduplicator.
+};
+
 // Info for a pool object which other objects will be allocated from.
 template <typename T>
 struct VulkanPoolInfo : public VulkanObjectInfo<T>
@@ -253,9 +307,9 @@ typedef VulkanObjectInfo<VkIndirectExecutionSetEXT>   VulkanIndirectExecutionSet
 
 struct VulkanInstanceInfo : public VulkanObjectInfo<VkInstance>
 {
-    uint32_t                             api_version{ VK_MAKE_VERSION(1, 0, 0) };
-    std::vector<std::string>             enabled_extensions;
-    std::unordered_map<uint32_t, size_t> array_counts;
+    uint32_t                 api_version{ VK_MAKE_VERSION(1, 0, 0) };
+    std::vector<std::string> enabled_extensions;
+    VulkanArrayCounts        array_counts;
 
     // Capture and replay devices sorted in the order that they were originally retrieved from
     // vkEnumeratePhysicalDevices.
@@ -267,10 +321,10 @@ struct VulkanInstanceInfo : public VulkanObjectInfo<VkInstance>
 
 struct VulkanPhysicalDeviceInfo : public VulkanObjectInfo<VkPhysicalDevice>
 {
-    VkInstance                           parent{ VK_NULL_HANDLE };
-    uint32_t                             parent_api_version{ 0 };
-    std::vector<std::string>             parent_enabled_extensions;
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VkInstance               parent{ VK_NULL_HANDLE };
+    uint32_t                 parent_api_version{ 0 };
+    std::vector<std::string> parent_enabled_extensions;
+    VulkanArrayCounts        array_counts;
 
     // Capture device properties.
     uint32_t                         capture_api_version{ 0 };
@@ -303,12 +357,14 @@ struct VulkanDeviceInfo : public VulkanObjectInfo<VkDevice>
 {
     VkPhysicalDevice                         parent{ VK_NULL_HANDLE };
     std::unique_ptr<VulkanResourceAllocator> allocator;
-    std::unordered_map<uint32_t, size_t>     array_counts;
+    VulkanArrayCounts                        array_counts;
 
+    // Capture replay data that is only needed to create its object. Entries are released once the object has been
+    // created, unless the measurement range is replayed more than once.
     std::unordered_map<format::HandleId, uint64_t> opaque_addresses;
 
     // Map pipeline ID to ray tracing shader group handle capture replay data.
-    std::unordered_map<format::HandleId, const std::vector<uint8_t>> shader_group_handles;
+    std::unordered_map<format::HandleId, std::vector<uint8_t>> shader_group_handles;
 
     // The following values are only used when loading the initial state for trimmed files.
     std::vector<std::string>                   extensions;
@@ -325,10 +381,10 @@ struct VulkanDeviceInfo : public VulkanObjectInfo<VkDevice>
 
 struct VulkanQueueInfo : public VulkanObjectInfo<VkQueue>
 {
-    VkDevice                             parent{ VK_NULL_HANDLE };
-    std::unordered_map<uint32_t, size_t> array_counts;
-    uint32_t                             family_index;
-    uint32_t                             queue_index;
+    VkDevice          parent{ VK_NULL_HANDLE };
+    VulkanArrayCounts array_counts;
+    uint32_t          family_index;
+    uint32_t          queue_index;
 };
 
 struct VulkanSemaphoreInfo : public VulkanObjectInfo<VkSemaphore>
@@ -369,6 +425,9 @@ struct VulkanBufferInfo : public VulkanObjectInfo<VkBuffer>
     // This is only used when loading the initial state for trimmed files.
     VkMemoryPropertyFlags memory_property_flags{ 0 };
 
+    // Capture ID of the memory that is bound to the buffer.
+    format::HandleId memory_id{ format::kNullHandleId };
+
     VkBufferUsageFlags usage{ 0 };
     VkDeviceSize       size{ 0 };
     uint32_t           queue_family_index{ 0 };
@@ -381,7 +440,7 @@ struct VulkanBufferViewInfo : public VulkanObjectInfo<VkBufferView>
 
 struct VulkanImageInfo : public VulkanObjectInfo<VkImage>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 
     bool is_swapchain_image{ false };
 
@@ -394,6 +453,9 @@ struct VulkanImageInfo : public VulkanObjectInfo<VkImage>
     // This is only used when loading the initial state for trimmed files.
     VkMemoryPropertyFlags memory_property_flags{ 0 };
 
+    // Capture ID of the memory that is bound to the image.
+    format::HandleId memory_id{ format::kNullHandleId };
+
     VkImageUsageFlags     usage{ 0 };
     VkImageType           type{};
     VkFormat              format{};
@@ -409,15 +471,16 @@ struct VulkanImageInfo : public VulkanObjectInfo<VkImage>
     VkImageLayout intermediate_layout{ VK_IMAGE_LAYOUT_UNDEFINED };
 };
 
+// Cache data blobs are shared between the pipeline cache infos that retrieved identical capture time data.
 struct VulkanPipelineCacheData
 {
-    std::vector<uint8_t> capture_cache_data;
-    std::vector<uint8_t> replay_cache_data;
+    std::shared_ptr<const std::vector<uint8_t>> capture_cache_data;
+    std::shared_ptr<const std::vector<uint8_t>> replay_cache_data;
 };
 
 struct VulkanPipelineCacheInfo : public VulkanObjectInfo<VkPipelineCache>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 
     // hash id of capture time pipeline cache data to capture and replay time pipeline cache data map;
     std::unordered_map<uint32_t, std::vector<VulkanPipelineCacheData>> pipeline_cache_data;
@@ -465,11 +528,14 @@ struct VulkanShaderModuleInfo : public VulkanObjectInfo<VkShaderModule>
     using ShaderDescriptorSetsInfos = std::map<uint32_t, ShaderDescriptorSetInfo>;
 
     ShaderDescriptorSetsInfos used_descriptors_info;
+
+    // Driver object shared with other shader modules when create info deduplication is enabled.
+    std::shared_ptr<VulkanDeduplicatedObject<VkShaderModule>> deduplicated_object;
 };
 
 struct VulkanPipelineInfo : public VulkanObjectInfoAsync<VkPipeline>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 
     // The following information is populated and used only when the
     // dump resources feature is in use
@@ -504,6 +570,9 @@ struct VulkanPipelineInfo : public VulkanObjectInfoAsync<VkPipeline>
 
     // map capture- to replay-time shader-group-handles
     std::unordered_map<graphics::shader_group_handle_t, graphics::shader_group_handle_t> shader_group_handle_map;
+
+    // Driver object shared with other pipelines when create info deduplication is enabled.
+    std::shared_ptr<VulkanDeduplicatedObject<VkPipeline>> deduplicated_object;
 };
 
 struct VulkanDescriptorPoolInfo : public VulkanPoolInfo<VkDescriptorPool>
@@ -523,14 +592,14 @@ struct VulkanDescriptorUpdateTemplateInfo : public VulkanObjectInfo<VkDescriptor
 
 struct VulkanDisplayKHRInfo : public VulkanObjectInfo<VkDisplayKHR>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 };
 
 struct VulkanSurfaceKHRInfo : public VulkanObjectInfo<VkSurfaceKHR>
 {
-    Window*                              window{ nullptr };
-    std::unordered_map<uint32_t, size_t> array_counts;
-    bool                                 surface_creation_skipped{ false };
+    Window*           window{ nullptr };
+    VulkanArrayCounts array_counts;
+    bool              surface_creation_skipped{ false };
 
     std::unordered_map<VkPhysicalDevice, VkSurfaceCapabilitiesKHR> surface_capabilities;
 };
@@ -544,7 +613,7 @@ struct VulkanSwapchainKHRInfo : public VulkanObjectInfo<VkSwapchainKHR>
     uint32_t             height{ 0 };
     VkFormat             format{ VK_FORMAT_UNDEFINED };
     std::vector<VkImage> images; // This image could be virtual or real according to if it uses VirtualSwapchain.
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts    array_counts;
 
     // The acquired_indices value and the remapping performed with it.
     struct AcquiredData
@@ -574,7 +643,7 @@ struct VulkanSwapchainKHRInfo : public VulkanObjectInfo<VkSwapchainKHR>
 
 struct VulkanValidationCacheEXTInfo : public VulkanObjectInfo<VkValidationCacheEXT>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 };
 
 struct VulkanImageViewInfo : public VulkanObjectInfo<VkImageView>
@@ -584,9 +653,9 @@ struct VulkanImageViewInfo : public VulkanObjectInfo<VkImageView>
 
 struct VulkanFramebufferInfo : public VulkanObjectInfo<VkFramebuffer>
 {
-    VkFramebufferCreateFlags             framebuffer_flags{ 0 };
-    std::unordered_map<uint32_t, size_t> array_counts;
-    std::vector<format::HandleId>        attachment_image_view_ids;
+    VkFramebufferCreateFlags      framebuffer_flags{ 0 };
+    VulkanArrayCounts             array_counts;
+    std::vector<format::HandleId> attachment_image_view_ids;
 };
 
 struct VulkanDeferredOperationKHRInfo : public VulkanObjectInfo<VkDeferredOperationKHR>
@@ -602,7 +671,7 @@ struct VulkanDeferredOperationKHRInfo : public VulkanObjectInfo<VkDeferredOperat
 
 struct VulkanVideoSessionKHRInfo : VulkanObjectInfo<VkVideoSessionKHR>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 
     // The following values are only used for memory portability.
     std::vector<VulkanResourceAllocator::ResourceData> allocator_datas;
@@ -615,7 +684,7 @@ struct VulkanVideoSessionKHRInfo : VulkanObjectInfo<VkVideoSessionKHR>
 
 struct VulkanShaderEXTInfo : VulkanObjectInfoAsync<VkShaderEXT>
 {
-    std::unordered_map<uint32_t, size_t> array_counts;
+    VulkanArrayCounts array_counts;
 };
 
 struct VulkanCommandBufferInfo : public VulkanPoolObjectInfo<VkCommandBuffer>
@@ -25,6 +25,11 @@
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_H
 
 #include "generated/generated_vulkan_object_info_table_base2.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -55,6 +60,38 @@ class VulkanObjectInfoTable : public VulkanObjectInfoTableBase2
             }
         }
     }
+
+    // Logs the estimated memory used by the info structures of each object type, largest first.
+    void LogMemoryUsage() const
+    {
+        if (!util::Log::WillOutputMessage(util::Log::kDebugSeverity))
+        {
+            return;
+        }
+
+        std::vector<ObjectInfoMemoryUsage> usage;
+        GetMemoryUsage(&usage);
+
+        std::sort(usage.begin(), usage.end(), [](const ObjectInfoMemoryUsage& lhs, const ObjectInfoMemoryUsage& rhs) {
+            return lhs.memory_size > rhs.memory_size;
+        });
+
+        size_t total_size = 0;
+        for (const auto& type_usage : usage)
+        {
+            total_size += type_usage.memory_size;
+        }
+
+        GFXRECON_LOG_DEBUG("Object info memory usage: %" PRIuPTR " bytes", total_size);
+
+        for (const auto& type_usage : usage)
+        {
+            GFXRECON_LOG_DEBUG("    %s: %" PRIuPTR " objects, %" PRIuPTR " bytes",
+                               type_usage.type_name,
+                               type_usage.object_count,
+                               type_usage.memory_size);
+        }
+    }
 };
 
 GFXRECON_END_NAMESPACE(decode)
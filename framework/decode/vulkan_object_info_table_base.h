@@ -32,8 +32,10 @@
 
 #include <cassert>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -116,9 +118,144 @@ struct ObjectInfoGetter<VulkanPhysicalDeviceInfo> : public ObjectInfoGetterBase
     }
 };
 
+// Estimated memory used by the info structures of one object type.
+struct ObjectInfoMemoryUsage
+{
+    const char* type_name{ nullptr };
+    size_t      object_count{ 0 };
+    size_t      memory_size{ 0 }; // Includes the heap memory owned by the info structures.
+};
+
+// Utilities to estimate the heap memory owned by an info structure. The estimates assume node based hash maps with one
+// allocation per element plus a bucket array, and count blobs that are shared between info structures once.
+template <typename Map>
+size_t GetHashMapHeapSize(const Map& map)
+{
+    return (map.size() * (sizeof(typename Map::value_type) + sizeof(void*))) + (map.bucket_count() * sizeof(void*));
+}
+
+template <typename T>
+size_t GetVectorHeapSize(const std::vector<T>& vector)
+{
+    return vector.capacity() * sizeof(T);
+}
+
+template <typename T>
+size_t GetSharedBlobHeapSize(const std::shared_ptr<const std::vector<T>>& blob)
+{
+    return (blob != nullptr) ? (GetVectorHeapSize(*blob) / blob.use_count()) : 0;
+}
+
+inline size_t GetArrayCountsHeapSize(const VulkanArrayCounts& array_counts)
+{
+    return array_counts.capacity() * sizeof(VulkanArrayCounts::Entry);
+}
+
+template <typename T, typename = int>
+struct has_array_counts : std::false_type
+{};
+
+template <typename T>
+struct has_array_counts<T, decltype((void)T::array_counts, 0)> : std::true_type
+{};
+
+template <typename T>
+size_t GetObjectInfoHeapSize(const T& info)
+{
+    size_t heap_size = 0;
+
+    if constexpr (has_array_counts<T>::value)
+    {
+        heap_size += GetArrayCountsHeapSize(info.array_counts);
+    }
+
+    return heap_size;
+}
+
+inline size_t GetObjectInfoHeapSize(const VulkanDeviceInfo& info)
+{
+    size_t heap_size = GetArrayCountsHeapSize(info.array_counts) + GetHashMapHeapSize(info.opaque_addresses) +
+                       GetHashMapHeapSize(info.shader_group_handles);
+
+    for (const auto& entry : info.shader_group_handles)
+    {
+        heap_size += GetVectorHeapSize(entry.second);
+    }
+
+    return heap_size;
+}
+
+inline size_t GetObjectInfoHeapSize(const VulkanPipelineCacheInfo& info)
+{
+    size_t heap_size = GetArrayCountsHeapSize(info.array_counts) + GetHashMapHeapSize(info.pipeline_cache_data);
+
+    for (const auto& entry : info.pipeline_cache_data)
+    {
+        heap_size += GetVectorHeapSize(entry.second);
+
+        for (const auto& cache_data : entry.second)
+        {
+            heap_size += GetSharedBlobHeapSize(cache_data.capture_cache_data);
+            heap_size += GetSharedBlobHeapSize(cache_data.replay_cache_data);
+        }
+    }
+
+    return heap_size;
+}
+
+inline size_t GetObjectInfoHeapSize(const VulkanPipelineInfo& info)
+{
+    return GetArrayCountsHeapSize(info.array_counts) + GetHashMapHeapSize(info.shaders) +
+           GetHashMapHeapSize(info.vertex_input_binding_map) + GetHashMapHeapSize(info.vertex_input_attribute_map) +
+           GetHashMapHeapSize(info.shader_group_handle_map);
+}
+
+inline size_t GetObjectInfoHeapSize(const VulkanCommandBufferInfo& info)
+{
+    return GetVectorHeapSize(info.frame_buffer_ids) + GetHashMapHeapSize(info.image_layout_barriers) +
+           GetVectorHeapSize(info.push_constant_data);
+}
+
+inline size_t GetObjectInfoHeapSize(const VulkanDescriptorSetInfo& info)
+{
+    size_t heap_size = GetHashMapHeapSize(info.descriptors);
+
+    for (const auto& entry : info.descriptors)
+    {
+        heap_size += GetVectorHeapSize(entry.second.image_info) + GetVectorHeapSize(entry.second.buffer_info) +
+                     GetVectorHeapSize(entry.second.texel_buffer_view_info) +
+                     GetVectorHeapSize(entry.second.inline_uniform_block);
+    }
+
+    return heap_size;
+}
+
 class VulkanObjectInfoTableBase
 {
   protected:
+    template <typename T>
+    void AddMemoryUsage(const char*                                    type_name,
+                        const std::unordered_map<format::HandleId, T>& map,
+                        std::vector<ObjectInfoMemoryUsage>*            usage) const
+    {
+        assert(usage != nullptr);
+
+        if (!map.empty())
+        {
+            ObjectInfoMemoryUsage type_usage;
+            type_usage.type_name    = type_name;
+            type_usage.object_count = map.size();
+            type_usage.memory_size  = GetHashMapHeapSize(map);
+
+            for (const auto& entry : map)
+            {
+                type_usage.memory_size += GetObjectInfoHeapSize(entry.second);
+            }
+
+            usage->push_back(type_usage);
+        }
+    }
+
     template <typename T>
     void AddVkObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
     {
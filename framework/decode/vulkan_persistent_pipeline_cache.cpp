@@ -0,0 +1,310 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/vulkan_persistent_pipeline_cache.h"
+#include "generated/generated_vulkan_enum_to_string.h"
+#include "util/file_path.h"
+#include "util/hash.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Returns a temporary file name in the directory of the specified file, which is unique to this process and call.
+static std::string GetTempFilename(const std::string& filename)
+{
+    std::random_device random;
+    char               suffix[64];
+    snprintf(suffix,
+             sizeof(suffix),
+             ".%" PRIu64 ".%08x%08x.tmp",
+             static_cast<uint64_t>(util::platform::GetCurrentProcessId()),
+             static_cast<uint32_t>(random()),
+             static_cast<uint32_t>(random()));
+    return filename + suffix;
+}
+
+// Amount of data hashed at the start and at the end of the capture file.
+static constexpr size_t kCaptureHashSampleSize = 1024 * 1024;
+
+// Identifies the capture file by its size and the data at its start and end, instead of hashing the full file, which
+// would read the whole capture before replay starts. The driver validates the entries of the pipeline cache data, so a
+// collision only affects the cache hit rate.
+static std::string GetCaptureHash(const std::string& capture_filename)
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, capture_filename.c_str(), "rb");
+    if (result != 0)
+    {
+        GFXRECON_LOG_WARNING("Failed to open capture file '%s' to compute the pipeline cache file name",
+                             capture_filename.c_str());
+        return {};
+    }
+
+    util::platform::FileSeek(file, 0, util::platform::FileSeekEnd);
+    int64_t  file_size = util::platform::FileTell(file);
+    uint64_t hash      = static_cast<uint64_t>(std::max<int64_t>(file_size, 0));
+
+    std::vector<uint8_t> sample(static_cast<size_t>(std::min<uint64_t>(hash, kCaptureHashSampleSize)));
+    if (!sample.empty())
+    {
+        util::platform::FileSeek(file, 0, util::platform::FileSeekSet);
+        if (util::platform::FileRead(sample.data(), sample.size(), file))
+        {
+            hash = util::hash::GenerateDataHash(sample.data(), sample.size(), hash);
+        }
+
+        util::platform::FileSeek(file, file_size - static_cast<int64_t>(sample.size()), util::platform::FileSeekSet);
+        if (util::platform::FileRead(sample.data(), sample.size(), file))
+        {
+            hash = util::hash::GenerateDataHash(sample.data(), sample.size(), hash);
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    char hash_string[17];
+    snprintf(hash_string, sizeof(hash_string), "%016" PRIx64, hash);
+    return hash_string;
+}
+
+VulkanPersistentPipelineCache::VulkanPersistentPipelineCache(const std::string& directory,
+                                                             const std::string& capture_filename) :
+    directory_(directory),
+    capture_hash_(GetCaptureHash(capture_filename))
+{
+    if (!util::filepath::Exists(directory_) && !util::filepath::MakeDirectory(directory_))
+    {
+        GFXRECON_LOG_WARNING("Failed to create pipeline cache directory '%s'", directory_.c_str());
+    }
+}
+
+void VulkanPersistentPipelineCache::AddDevice(VkDevice                         device,
+                                              const VulkanPhysicalDeviceInfo*  physical_device_info,
+                                              const encode::VulkanDeviceTable* device_table)
+{
+    GFXRECON_ASSERT(device_table != nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    DeviceCaches& device_caches = device_caches_[device];
+    device_caches.device_table  = device_table;
+
+    // Cache data is only valid for the driver that produced it, which is identified by the pipeline cache UUID.
+    std::string uuid_string;
+    if ((physical_device_info != nullptr) && (physical_device_info->replay_device_info != nullptr) &&
+        physical_device_info->replay_device_info->properties)
+    {
+        for (uint8_t value : physical_device_info->replay_device_info->properties->pipelineCacheUUID)
+        {
+            char value_string[3];
+            snprintf(value_string, sizeof(value_string), "%02x", value);
+            uuid_string += value_string;
+        }
+    }
+
+    device_caches.filename = util::filepath::Join(directory_, capture_hash_ + "_" + uuid_string + ".pipeline_cache");
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, device_caches.filename.c_str(), "rb");
+    if (result == 0)
+    {
+        util::platform::FileSeek(file, 0, util::platform::FileSeekEnd);
+        int64_t file_size = util::platform::FileTell(file);
+        util::platform::FileSeek(file, 0, util::platform::FileSeekSet);
+
+        if (file_size > 0)
+        {
+            device_caches.initial_data.resize(static_cast<size_t>(file_size));
+            if (!util::platform::FileRead(device_caches.initial_data.data(), device_caches.initial_data.size(), file))
+            {
+                device_caches.initial_data.clear();
+            }
+        }
+
+        util::platform::FileClose(file);
+
+        GFXRECON_LOG_INFO("Loaded %" PRIu64 " bytes of pipeline cache data from '%s'",
+                          static_cast<uint64_t>(device_caches.initial_data.size()),
+                          device_caches.filename.c_str());
+    }
+}
+
+VkPipelineCache VulkanPersistentPipelineCache::GetPipelineCache(VkDevice device)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto device_entry = device_caches_.find(device);
+    if (device_entry == device_caches_.end())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    DeviceCaches& device_caches = device_entry->second;
+
+    auto entry = device_caches.thread_caches.emplace(std::this_thread::get_id(), VK_NULL_HANDLE);
+    if (entry.second)
+    {
+        VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+        create_info.initialDataSize           = device_caches.initial_data.size();
+        create_info.pInitialData              = device_caches.initial_data.data();
+
+        VkResult result =
+            device_caches.device_table->CreatePipelineCache(device, &create_info, nullptr, &entry.first->second);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to create a pipeline cache from '%s' (error = %s)",
+                                 device_caches.filename.c_str(),
+                                 util::ToString<VkResult>(result).c_str());
+            entry.first->second = VK_NULL_HANDLE;
+        }
+    }
+
+    return entry.first->second;
+}
+
+void VulkanPersistentPipelineCache::DestroyDeviceResources(VkDevice device)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto entry = device_caches_.find(device);
+    if (entry != device_caches_.end())
+    {
+        SaveDeviceCaches(device, &entry->second);
+        device_caches_.erase(entry);
+    }
+}
+
+void VulkanPersistentPipelineCache::DestroyAllResources()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& entry : device_caches_)
+    {
+        SaveDeviceCaches(entry.first, &entry.second);
+    }
+
+    device_caches_.clear();
+}
+
+void VulkanPersistentPipelineCache::SaveDeviceCaches(VkDevice device, DeviceCaches* device_caches)
+{
+    const encode::VulkanDeviceTable* device_table = device_caches->device_table;
+
+    std::vector<VkPipelineCache> caches;
+    for (const auto& entry : device_caches->thread_caches)
+    {
+        if (entry.second != VK_NULL_HANDLE)
+        {
+            caches.push_back(entry.second);
+        }
+    }
+
+    if (caches.empty())
+    {
+        return;
+    }
+
+    VkPipelineCache merged_cache = caches[0];
+    VkResult        result       = VK_SUCCESS;
+    if (caches.size() > 1)
+    {
+        result = device_table->MergePipelineCaches(
+            device, merged_cache, static_cast<uint32_t>(caches.size() - 1), caches.data() + 1);
+    }
+
+    std::vector<uint8_t> data;
+    size_t               data_size = 0;
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->GetPipelineCacheData(device, merged_cache, &data_size, nullptr);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        data.resize(data_size);
+        result = device_table->GetPipelineCacheData(device, merged_cache, &data_size, data.data());
+        data.resize(data_size);
+    }
+
+    for (VkPipelineCache cache : caches)
+    {
+        device_table->DestroyPipelineCache(device, cache, nullptr);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING("Failed to retrieve the pipeline cache data for '%s' (error = %s)",
+                             device_caches->filename.c_str(),
+                             util::ToString<VkResult>(result).c_str());
+        return;
+    }
+
+    // Leave the file untouched when replay did not add any pipelines to the cache.
+    if (data.empty() || (data == device_caches->initial_data))
+    {
+        return;
+    }
+
+    // Write to a temporary file that replaces the cache file when it is complete, so that concurrent replays of the
+    // same capture never load a partially written file, and that they never write to the same temporary file.
+    std::string temp_filename = GetTempFilename(device_caches->filename);
+    FILE*       file          = nullptr;
+    int32_t     open_result   = util::platform::FileOpen(&file, temp_filename.c_str(), "wb");
+    if (open_result != 0)
+    {
+        GFXRECON_LOG_WARNING("Failed to open pipeline cache file '%s' for writing", temp_filename.c_str());
+        return;
+    }
+
+    bool written = util::platform::FileWrite(data.data(), data.size(), file);
+    util::platform::FileClose(file);
+
+    std::error_code error;
+    if (written)
+    {
+        std::filesystem::rename(temp_filename, device_caches->filename, error);
+    }
+
+    if (!written || error)
+    {
+        GFXRECON_LOG_WARNING("Failed to write pipeline cache file '%s'", device_caches->filename.c_str());
+        std::filesystem::remove(temp_filename, error);
+    }
+    else
+    {
+        GFXRECON_LOG_INFO("Saved %" PRIu64 " bytes of pipeline cache data to '%s'",
+                          static_cast<uint64_t>(data.size()),
+                          device_caches->filename.c_str());
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,88 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_PERSISTENT_PIPELINE_CACHE_H
+#define GFXRECON_DECODE_VULKAN_PERSISTENT_PIPELINE_CACHE_H
+
+#include "decode/vulkan_object_info.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Stores the pipeline caches of a replay in a directory, so that later replays of the same capture file on the same
+// driver start with the pipelines that were compiled by the earlier replays. The cache file of a device is named
+// after the capture file hash and the pipeline cache UUID of the replay device. Each thread that creates pipelines
+// uses its own pipeline cache, and the caches of a device are merged before the data is written back to the file.
+class VulkanPersistentPipelineCache
+{
+  public:
+    VulkanPersistentPipelineCache(const std::string& directory, const std::string& capture_filename);
+
+    // Loads the data of the device's cache file.
+    void AddDevice(VkDevice                         device,
+                   const VulkanPhysicalDeviceInfo*  physical_device_info,
+                   const encode::VulkanDeviceTable* device_table);
+
+    // Returns the pipeline cache for pipelines created for the device on the calling thread. The cache is created on
+    // first use, with the data of the device's cache file.
+    VkPipelineCache GetPipelineCache(VkDevice device);
+
+    // Merges the pipeline caches of the device, writes the merged data to the device's cache file, and destroys the
+    // caches. Must not be called while pipelines are being created for the device.
+    void DestroyDeviceResources(VkDevice device);
+
+    void DestroyAllResources();
+
+  private:
+    struct DeviceCaches
+    {
+        const encode::VulkanDeviceTable*                     device_table{ nullptr };
+        std::string                                          filename;
+        std::vector<uint8_t>                                 initial_data;
+        std::unordered_map<std::thread::id, VkPipelineCache> thread_caches;
+    };
+
+  private:
+    void SaveDeviceCaches(VkDevice device, DeviceCaches* device_caches);
+
+  private:
+    std::string                                directory_;
+    std::string                                capture_hash_;
+    std::mutex                                 mutex_;
+    std::unordered_map<VkDevice, DeviceCaches> device_caches_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PERSISTENT_PIPELINE_CACHE_H
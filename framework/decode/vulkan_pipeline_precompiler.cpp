@@ -0,0 +1,217 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pipeline_precompiler.h"
+#include "decode/file_processor.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_replay_consumer.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Number of the slowest pipeline creation calls that are listed by the console summary.
+const size_t kSlowestCompileCount = 5;
+
+// Decodes the calls that create pipelines and shader objects, and the calls that create the objects that pipeline
+// creation depends on. All other calls are ignored.
+class VulkanPipelinePrecompileDecoder : public VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override
+    {
+        switch (call_id)
+        {
+            case format::ApiCallId::ApiCall_vkCreateInstance:
+            case format::ApiCallId::ApiCall_vkDestroyInstance:
+            case format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
+            case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
+            case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
+            case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            case format::ApiCallId::ApiCall_vkCreateDevice:
+            case format::ApiCallId::ApiCall_vkDestroyDevice:
+            case format::ApiCallId::ApiCall_vkCreateShaderModule:
+            case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+            case format::ApiCallId::ApiCall_vkCreateSampler:
+            case format::ApiCallId::ApiCall_vkDestroySampler:
+            case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+            case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+            case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+            case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+            case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+            case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+            case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+            case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+            case format::ApiCallId::ApiCall_vkCreateRenderPass:
+            case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+            case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+            case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+            case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            case format::ApiCallId::ApiCall_vkDestroyPipeline:
+            case format::ApiCallId::ApiCall_vkCreateShadersEXT:
+            case format::ApiCallId::ApiCall_vkDestroyShaderEXT:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
+    {
+        // The device properties are needed to select the replay devices.
+        format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+        return VulkanDecoder::SupportsMetaDataId(meta_data_id) &&
+               ((meta_data_type == format::MetaDataType::kSetDevicePropertiesCommand) ||
+                (meta_data_type == format::MetaDataType::kSetDeviceMemoryPropertiesCommand));
+    }
+};
+
+VulkanPipelinePrecompiler::VulkanPipelinePrecompiler(std::shared_ptr<application::Application> application,
+                                                     const VulkanReplayOptions&                options) :
+    application_(std::move(application)),
+    options_(options)
+{
+    // Pipelines are created asynchronously, on all available cores. Pipeline cache files and the resource dumping
+    // state belong to the replay that follows the precompile pass.
+    options_.num_pipeline_creation_jobs = static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency()));
+    options_.dumping_resources          = false;
+    options_.dump_resources.clear();
+    options_.save_pipeline_cache_filename.clear();
+    options_.load_pipeline_cache_filename.clear();
+    options_.add_new_pipeline_caches = false;
+    options_.screenshot_ranges.clear();
+}
+
+bool VulkanPipelinePrecompiler::Process(const std::string& filename)
+{
+    FileProcessor file_processor;
+
+    if (!file_processor.Initialize(filename))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s for pipeline precompilation", filename.c_str());
+        return false;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Precompiling pipelines with %d threads. This may take some time. Please wait...",
+                           options_.num_pipeline_creation_jobs);
+
+    int64_t                                start_time = util::datetime::GetTimestamp();
+    bool                                   success    = false;
+    std::vector<VulkanPipelineCompileTime> compile_times;
+
+    {
+        VulkanPipelinePrecompileDecoder decoder;
+        VulkanReplayConsumer            consumer(application_, options_);
+
+        consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
+        consumer.EnablePipelineCompileTimes();
+
+        decoder.AddConsumer(&consumer);
+        file_processor.AddDecoder(&decoder);
+
+        try
+        {
+            success = file_processor.ProcessAllFrames();
+        }
+        catch (const std::runtime_error& error)
+        {
+            // The pipelines that were compiled before the error are kept, and replay continues without the others.
+            GFXRECON_LOG_ERROR("Pipeline precompilation encountered a fatal error: %s", error.what());
+            success = false;
+        }
+
+        consumer.WaitAsyncOperations();
+        compile_times = consumer.GetPipelineCompileTimes();
+
+        file_processor.RemoveDecoder(&decoder);
+        decoder.RemoveConsumer(&consumer);
+    }
+
+    int64_t elapsed_time = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+
+    std::sort(compile_times.begin(),
+              compile_times.end(),
+              [](const VulkanPipelineCompileTime& lhs, const VulkanPipelineCompileTime& rhs) {
+                  return lhs.duration > rhs.duration;
+              });
+
+    uint64_t pipeline_count = 0;
+    int64_t  total_duration = 0;
+
+    for (const auto& compile_time : compile_times)
+    {
+        pipeline_count += compile_time.count;
+        total_duration += compile_time.duration;
+
+        GFXRECON_LOG_INFO("Pipeline compile time: %s (ID %" PRIu64 ", %u create infos): %f ms",
+                          compile_time.call_name,
+                          compile_time.first_id,
+                          compile_time.count,
+                          util::datetime::ConvertTimestampToMilliseconds(compile_time.duration));
+    }
+
+    GFXRECON_WRITE_CONSOLE("Precompiled %" PRIu64 " pipelines from %zu creation calls in %f seconds (%f seconds of "
+                           "compile time).",
+                           pipeline_count,
+                           compile_times.size(),
+                           util::datetime::ConvertTimestampToSeconds(elapsed_time),
+                           util::datetime::ConvertTimestampToSeconds(total_duration));
+
+    for (size_t i = 0; i < std::min(kSlowestCompileCount, compile_times.size()); ++i)
+    {
+        GFXRECON_WRITE_CONSOLE("  %s (ID %" PRIu64 "): %f ms",
+                               compile_times[i].call_name,
+                               compile_times[i].first_id,
+                               util::datetime::ConvertTimestampToMilliseconds(compile_times[i].duration));
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Pipeline precompilation did not process the entire capture file");
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,58 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
+
+#include "application/application.h"
+#include "decode/vulkan_replay_options.h"
+#include "util/defines.h"
+
+#include <memory>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Compiles the pipelines of a capture file before the file is replayed. The capture file is processed by a separate
+// replay pass that only replays the calls that create pipelines and shader objects, and the calls that create the
+// objects they depend on. The pipelines are created asynchronously, on all available cores, and the compile time of
+// each creation call is logged. Drivers with a persistent pipeline cache can then create the pipelines of the replay
+// from the cache, which keeps pipeline compilation out of the replayed frames.
+class VulkanPipelinePrecompiler
+{
+  public:
+    VulkanPipelinePrecompiler(std::shared_ptr<application::Application> application,
+                              const VulkanReplayOptions&                options);
+
+    // Returns false if the capture file could not be processed.
+    bool Process(const std::string& filename);
+
+  private:
+    std::shared_ptr<application::Application> application_;
+    VulkanReplayOptions                       options_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_PRECOMPILER_H
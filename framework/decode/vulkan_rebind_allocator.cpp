@@ -58,6 +58,7 @@
 #include "format/format_util.h"
 #include "util/alignment_utils.h"
 #include "util/platform.h"
+#include "util/streaming_memory_copy.h"
 #include "graphics/vulkan_struct_get_pnext.h"
 
 #include "generated/generated_vulkan_enum_to_string.h"
@@ -614,6 +615,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer
                 if ((property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                 {
                     resource_alloc_info->is_host_visible = true;
+                    resource_alloc_info->is_host_cached  = ((property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0);
                 }
 
                 memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
@@ -707,6 +709,8 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                         {
                             resource_alloc_info->is_host_visible = true;
+                            resource_alloc_info->is_host_cached  =
+                                ((property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0);
                         }
 
                         if (memory_alloc_info->original_content != nullptr)
@@ -841,6 +845,8 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage
                     if ((property_flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                     {
                         resource_alloc_info->is_host_visible = true;
+                        resource_alloc_info->is_host_cached  =
+                            ((property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0);
                     }
 
                     memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
@@ -954,6 +960,8 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                             {
                                 resource_alloc_info->is_host_visible = true;
+                                resource_alloc_info->is_host_cached  =
+                                    ((property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0);
                             }
 
                             if (memory_alloc_info->original_content != nullptr)
@@ -1123,6 +1131,8 @@ VkResult VulkanRebindAllocator::BindVideoSessionMemory(VkVideoSessionKHR
                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                         {
                             resource_alloc_info->is_host_visible = true;
+                            resource_alloc_info->is_host_cached  =
+                                ((property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0);
                         }
 
                         if (memory_alloc_info->original_content != nullptr)
@@ -1447,10 +1457,19 @@ void VulkanRebindAllocator::WriteBoundResourceDirect(
 {
     if (resource_alloc_info->object_type == ObjectType::buffer)
     {
-        util::platform::MemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
-                                   data_size,
-                                   data + src_offset,
-                                   data_size);
+        if (!resource_alloc_info->is_host_cached)
+        {
+            // Memory that is not host cached is typically write-combined.
+            util::StreamingMemoryCopy(
+                static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset, data + src_offset, data_size);
+        }
+        else
+        {
+            util::platform::MemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
+                                       data_size,
+                                       data + src_offset,
+                                       data_size);
+        }
     }
     else if (resource_alloc_info->object_type == ObjectType::image)
     {
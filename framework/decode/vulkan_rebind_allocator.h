@@ -338,6 +338,7 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         MemoryAllocInfo* memory_info{ nullptr };
         VmaAllocation    allocation{ VK_NULL_HANDLE };
         bool             is_host_visible{ false };
+        bool             is_host_cached{ false };
         void*            mapped_pointer{ nullptr };
         VkDeviceSize     original_offset{ 0 };
         VkDeviceSize     rebind_offset{ 0 };
@@ -41,10 +41,12 @@
 #include "generated/generated_vulkan_constant_maps.h"
 #include "graphics/vulkan_check_buffer_references.h"
 #include "graphics/vulkan_device_util.h"
+#include "graphics/vulkan_resources_util.h"
 #include "graphics/vulkan_util.h"
 #include "graphics/vulkan_struct_get_pnext.h"
 #include "graphics/vulkan_struct_deep_copy.h"
 #include "graphics/vulkan_struct_extract_handles.h"
+#include "util/date_time.h"
 #include "util/file_path.h"
 #include "util/hash.h"
 #include "util/platform.h"
@@ -248,16 +250,32 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(std::shared_ptr<application::
         }
         util::platform::FileClose(file);
     }
+
+    if (!options_.pipeline_cache_dir.empty())
+    {
+        persistent_pipeline_cache_ =
+            std::make_unique<VulkanPersistentPipelineCache>(options_.pipeline_cache_dir, options_.capture_filename);
+    }
 }
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 {
+    // Report the memory held by the object info structures while the objects are still live.
+    object_info_table_->LogMemoryUsage();
+
     for (const std::pair<format::HandleId, std::pair<const VulkanDeviceInfo*, VkPipelineCache>>& elt :
          tracked_pipeline_caches_)
     {
         SavePipelineCache(elt.first, elt.second.first, elt.second.second);
     }
 
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        // The caches of pipelines that are still being compiled can't be merged until the compilation completes.
+        WaitAsyncOperations();
+        persistent_pipeline_cache_->DestroyAllResources();
+    }
+
     // Idle all devices before destroying other resources.
     WaitDevicesIdle();
 
@@ -276,6 +294,11 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
         {
             screenshot_handler_->DestroyDeviceResources(device, device_table);
         }
+
+        if (gpu_frame_timer_ != nullptr)
+        {
+            gpu_frame_timer_->DestroyDeviceResources(device, device_table);
+        }
     });
 
     object_cleanup::FreeAllLiveObjects(
@@ -308,6 +331,269 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
     object_info_table_ = nullptr;
 }
 
+std::vector<VulkanPipelineCompileTime> VulkanReplayConsumerBase::GetPipelineCompileTimes()
+{
+    std::lock_guard<std::mutex> lock(compile_times_mutex_);
+    return compile_times_;
+}
+
+void VulkanReplayConsumerBase::WaitAsyncOperations()
+{
+    object_info_table_->VisitVkPipelineInfo([](const VulkanPipelineInfo* info) {
+        if ((info->handle == VK_NULL_HANDLE) && info->future.valid())
+        {
+            info->future.wait();
+        }
+    });
+
+    object_info_table_->VisitVkShaderEXTInfo([](const VulkanShaderEXTInfo* info) {
+        if ((info->handle == VK_NULL_HANDLE) && info->future.valid())
+        {
+            info->future.wait();
+        }
+    });
+}
+
+void VulkanReplayConsumerBase::RecordCompileTime(const char*      call_name,
+                                                 format::HandleId first_id,
+                                                 uint32_t         count,
+                                                 int64_t          start_time)
+{
+    if (record_compile_times_)
+    {
+        int64_t duration = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+
+        std::lock_guard<std::mutex> lock(compile_times_mutex_);
+        compile_times_.push_back({ call_name, first_id, count, duration });
+    }
+}
+
+void VulkanReplayConsumerBase::SaveResourceState()
+{
+    const VkBufferUsageFlags kWritableBufferUsage = VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                    VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+    const VkImageUsageFlags  kWritableImageUsage  = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT |
+                                                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+
+    WaitDevicesIdle();
+
+    buffer_snapshots_.clear();
+    image_snapshots_.clear();
+
+    track_loop_range_objects_   = true;
+    loop_range_first_object_id_ = max_object_id_ + 1;
+    loop_range_created_objects_.clear();
+    loop_range_destroyed_objects_ = false;
+
+    uint64_t total_size = 0;
+
+    object_info_table_->VisitVkDeviceInfo([&](const VulkanDeviceInfo* device_info) {
+        const VulkanPhysicalDeviceInfo* physical_device_info =
+            object_info_table_->GetVkPhysicalDeviceInfo(device_info->parent_id);
+
+        if ((physical_device_info == nullptr) || (physical_device_info->replay_device_info == nullptr) ||
+            !physical_device_info->replay_device_info->memory_properties.has_value())
+        {
+            GFXRECON_LOG_WARNING("Skipping resource state of VkDevice object (ID = %" PRIu64
+                                 ") with unknown memory properties",
+                                 device_info->capture_id);
+            return;
+        }
+
+        graphics::VulkanResourcesUtil resource_util(device_info->handle,
+                                                    device_info->parent,
+                                                    *GetDeviceTable(device_info->handle),
+                                                    *GetInstanceTable(device_info->parent),
+                                                    *physical_device_info->replay_device_info->memory_properties);
+
+        object_info_table_->VisitVkBufferInfo([&](const VulkanBufferInfo* buffer_info) {
+            if ((buffer_info->parent_id != device_info->capture_id) ||
+                (buffer_info->memory_id == format::kNullHandleId) || ((buffer_info->usage & kWritableBufferUsage) == 0))
+            {
+                return;
+            }
+
+            ResourceSnapshot snapshot;
+            snapshot.device_id   = device_info->capture_id;
+            snapshot.resource_id = buffer_info->capture_id;
+
+            VkResult result = resource_util.ReadFromBufferResource(
+                buffer_info->handle, buffer_info->size, 0, buffer_info->queue_family_index, snapshot.data);
+
+            if (result == VK_SUCCESS)
+            {
+                total_size += snapshot.data.size();
+                buffer_snapshots_.emplace_back(std::move(snapshot));
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to save the content of VkBuffer object (ID = %" PRIu64 ")",
+                                     buffer_info->capture_id);
+            }
+        });
+
+        object_info_table_->VisitVkImageInfo([&](const VulkanImageInfo* image_info) {
+            if ((image_info->parent_id != device_info->capture_id) || image_info->is_swapchain_image ||
+                (image_info->memory_id == format::kNullHandleId) || ((image_info->usage & kWritableImageUsage) == 0) ||
+                ((image_info->usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0) ||
+                (image_info->tiling != VK_IMAGE_TILING_OPTIMAL) ||
+                (image_info->sample_count != VK_SAMPLE_COUNT_1_BIT) ||
+                (image_info->current_layout == VK_IMAGE_LAYOUT_UNDEFINED) ||
+                (image_info->current_layout == VK_IMAGE_LAYOUT_PREINITIALIZED))
+            {
+                return;
+            }
+
+            std::vector<VkImageAspectFlagBits> aspects;
+            graphics::GetFormatAspects(image_info->format, &aspects);
+
+            for (const auto aspect : aspects)
+            {
+                ResourceSnapshot      snapshot;
+                std::vector<uint64_t> level_offsets;
+                bool                  scaling_supported = false;
+
+                snapshot.device_id   = device_info->capture_id;
+                snapshot.resource_id = image_info->capture_id;
+                snapshot.aspect      = aspect;
+                snapshot.layout      = image_info->current_layout;
+
+                VkResult result = resource_util.ReadFromImageResourceStaging(image_info->handle,
+                                                                             image_info->format,
+                                                                             image_info->type,
+                                                                             image_info->extent,
+                                                                             image_info->level_count,
+                                                                             image_info->layer_count,
+                                                                             image_info->tiling,
+                                                                             image_info->sample_count,
+                                                                             image_info->current_layout,
+                                                                             image_info->queue_family_index,
+                                                                             aspect,
+                                                                             snapshot.data,
+                                                                             level_offsets,
+                                                                             snapshot.level_sizes,
+                                                                             scaling_supported,
+                                                                             true);
+
+                if (result == VK_SUCCESS)
+                {
+                    total_size += snapshot.data.size();
+                    image_snapshots_.emplace_back(std::move(snapshot));
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING("Failed to save the content of VkImage object (ID = %" PRIu64 ")",
+                                         image_info->capture_id);
+                }
+            }
+        });
+    });
+
+    GFXRECON_LOG_INFO("Saved the content of %zu buffers and %zu image aspects (%" PRIu64 " bytes)",
+                      buffer_snapshots_.size(),
+                      image_snapshots_.size(),
+                      total_size);
+}
+
+bool VulkanReplayConsumerBase::RestoreResourceState()
+{
+    if (track_loop_range_objects_ && (!loop_range_created_objects_.empty() || loop_range_destroyed_objects_))
+    {
+        GFXRECON_LOG_WARNING("The frame range cannot be replayed again, because it creates objects that it does not "
+                             "destroy (%zu), or destroys objects that were created before the range",
+                             loop_range_created_objects_.size());
+        track_loop_range_objects_ = false;
+        return false;
+    }
+
+    WaitDevicesIdle();
+
+    object_info_table_->VisitVkDeviceInfo([this](const VulkanDeviceInfo* device_info) {
+        const format::HandleId device_id     = device_info->capture_id;
+        uint64_t               max_copy_size = 0;
+
+        for (const auto& snapshot : buffer_snapshots_)
+        {
+            if (snapshot.device_id == device_id)
+            {
+                max_copy_size = std::max(max_copy_size, static_cast<uint64_t>(snapshot.data.size()));
+            }
+        }
+
+        for (const auto& snapshot : image_snapshots_)
+        {
+            if (snapshot.device_id == device_id)
+            {
+                max_copy_size = std::max(max_copy_size, static_cast<uint64_t>(snapshot.data.size()));
+            }
+        }
+
+        if (max_copy_size == 0)
+        {
+            return;
+        }
+
+        // The saved content is uploaded in the same way as the resource content of a trimmed capture file.
+        ProcessBeginResourceInitCommand(device_id, max_copy_size, max_copy_size);
+
+        for (const auto& snapshot : buffer_snapshots_)
+        {
+            if (snapshot.device_id == device_id)
+            {
+                ProcessInitBufferCommand(device_id, snapshot.resource_id, snapshot.data.size(), snapshot.data.data());
+            }
+        }
+
+        for (const auto& snapshot : image_snapshots_)
+        {
+            if (snapshot.device_id == device_id)
+            {
+                ProcessInitImageCommand(device_id,
+                                        snapshot.resource_id,
+                                        snapshot.data.size(),
+                                        snapshot.aspect,
+                                        snapshot.layout,
+                                        snapshot.level_sizes,
+                                        snapshot.data.data());
+            }
+        }
+
+        ProcessEndResourceInitCommand(device_id);
+    });
+
+    return true;
+}
+
+void VulkanReplayConsumerBase::TrackCreatedObjects(const format::HandleId* ids, size_t count)
+{
+    if (ids == nullptr)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Capture IDs increase with object creation, so an ID that is not greater than the IDs seen before the range
+        // belongs to an object that was retrieved again, such as a queue.
+        if (track_loop_range_objects_ && (ids[i] >= loop_range_first_object_id_))
+        {
+            loop_range_created_objects_.insert(ids[i]);
+        }
+
+        max_object_id_ = std::max(max_object_id_, ids[i]);
+    }
+}
+
+void VulkanReplayConsumerBase::TrackDestroyedObject(format::HandleId id)
+{
+    if (track_loop_range_objects_ && (id != format::kNullHandleId) && (loop_range_created_objects_.erase(id) == 0))
+    {
+        loop_range_destroyed_objects_ = true;
+    }
+}
+
 void VulkanReplayConsumerBase::WaitDevicesIdle()
 {
     object_info_table_->VisitVkDeviceInfo([this](const VulkanDeviceInfo* info) {
@@ -319,6 +605,12 @@ void VulkanReplayConsumerBase::WaitDevicesIdle()
 
         device_table->DeviceWaitIdle(device);
     });
+
+    if (gpu_frame_timer_ != nullptr)
+    {
+        // All timed submissions have completed, so their GPU times can be reported without stalling.
+        gpu_frame_timer_->ReportGpuTimes(true);
+    }
 }
 
 void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
@@ -1065,6 +1357,12 @@ void VulkanReplayConsumerBase::ProcessInitImageCommand(format::HandleId
     }
 }
 
+format::HandleId VulkanReplayConsumerBase::GetCommandBufferPoolId(format::HandleId command_buffer_id) const
+{
+    const VulkanCommandBufferInfo* command_buffer_info = object_info_table_->GetVkCommandBufferInfo(command_buffer_id);
+    return (command_buffer_info != nullptr) ? command_buffer_info->pool_id : format::kNullHandleId;
+}
+
 void VulkanReplayConsumerBase::SetFatalErrorHandler(std::function<void(const char*)> handler)
 {
     fatal_error_handler_ = handler;
@@ -1072,6 +1370,20 @@ void VulkanReplayConsumerBase::SetFatalErrorHandler(std::function<void(const cha
     resource_dumper_->DumpResourcesSetFatalErrorHandler(handler);
 }
 
+void VulkanReplayConsumerBase::SetFpsInfo(graphics::FpsInfo* fps_info)
+{
+    fps_info_ = fps_info;
+
+    if ((fps_info_ != nullptr) && options_.detailed_frame_timing)
+    {
+        gpu_frame_timer_ = std::make_unique<VulkanGpuFrameTimer>(fps_info_);
+    }
+    else
+    {
+        gpu_frame_timer_.reset();
+    }
+}
+
 void VulkanReplayConsumerBase::RaiseFatalError(const char* message) const
 {
     // TODO: Should there be a default action if no error handler has been provided?
@@ -2222,6 +2534,17 @@ void VulkanReplayConsumerBase::InitializeScreenshotHandler()
     }
 
     screenshot_handler_ = std::make_unique<ScreenshotHandler>(options_.screenshot_format, options_.screenshot_ranges);
+
+    if (!options_.screenshot_compare_dir.empty())
+    {
+        if (!util::filepath::IsDirectory(options_.screenshot_compare_dir))
+        {
+            GFXRECON_LOG_WARNING("Screenshot comparison directory %s does not exist",
+                                 options_.screenshot_compare_dir.c_str());
+        }
+
+        screenshot_handler_->SetCompareOptions(options_.screenshot_compare_dir, options_.screenshot_compare_report);
+    }
 }
 
 void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const
@@ -2880,6 +3203,11 @@ VkResult VulkanReplayConsumerBase::PostCreateDeviceUpdateState(VulkanPhysicalDev
         device_info->queue_family_index_enabled[queue_create_info->queueFamilyIndex]  = true;
     }
 
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        persistent_pipeline_cache_->AddDevice(replay_device, physical_device_info, GetDeviceTable(replay_device));
+    }
+
     // Restore modified property/feature create info values to the original application values
     create_state.device_util.RestoreModifiedPhysicalDeviceFeatures();
 
@@ -2955,7 +3283,21 @@ void VulkanReplayConsumerBase::OverrideDestroyDevice(
             decode::EndInjectedCommands();
         }
 
+        if (gpu_frame_timer_ != nullptr)
+        {
+            gpu_frame_timer_->DestroyDeviceResources(device, GetDeviceTable(device));
+        }
+
         device_info->allocator->Destroy();
+
+        shader_module_deduplicator_.RemoveDevice(device);
+        pipeline_deduplicator_.RemoveDevice(device);
+
+        if (persistent_pipeline_cache_ != nullptr)
+        {
+            WaitAsyncOperations();
+            persistent_pipeline_cache_->DestroyDeviceResources(device);
+        }
     }
 
     func(device, GetAllocationCallbacks(pAllocator));
@@ -3545,6 +3887,20 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit      fu
         fence = fence_info->handle;
     }
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        // Enclose the submitted command buffers with the timestamp command buffers of the GPU frame timer.
+        const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(queue_info->parent_id);
+        assert(device_info != nullptr);
+
+        submit_infos = gpu_frame_timer_->AddTimestamps(device_info,
+                                                       queue_info,
+                                                       GetInstanceTable(device_info->parent),
+                                                       GetDeviceTable(device_info->handle),
+                                                       submitCount,
+                                                       submit_infos);
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
     // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
     // tracked.
@@ -3653,6 +4009,11 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit      fu
         }
     }
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        gpu_frame_timer_->EndSubmission(queue_info->handle, result);
+    }
+
     if ((options_.sync_queue_submissions) && (result == VK_SUCCESS))
     {
         GetDeviceTable(queue_info->handle)->QueueWaitIdle(queue_info->handle);
@@ -3724,6 +4085,20 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit2(PFN_vkQueueSubmit2     f
         fence = fence_info->handle;
     }
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        // Enclose the submitted command buffers with the timestamp command buffers of the GPU frame timer.
+        const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(queue_info->parent_id);
+        assert(device_info != nullptr);
+
+        submit_infos = gpu_frame_timer_->AddTimestamps(device_info,
+                                                       queue_info,
+                                                       GetInstanceTable(device_info->parent),
+                                                       GetDeviceTable(device_info->handle),
+                                                       submitCount,
+                                                       submit_infos);
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
     // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
     // tracked.
@@ -3831,6 +4206,11 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit2(PFN_vkQueueSubmit2     f
         }
     }
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        gpu_frame_timer_->EndSubmission(queue_info->handle, result);
+    }
+
     if ((options_.sync_queue_submissions) && (result == VK_SUCCESS))
     {
         GetDeviceTable(queue_info->handle)->QueueWaitIdle(queue_info->handle);
@@ -4394,6 +4774,7 @@ VkResult VulkanReplayConsumerBase::OverrideAllocateMemory(
                         if (opaque_address_pair != device_info->opaque_addresses.end())
                         {
                             opaque_address = opaque_address_pair->second;
+                            ReleaseCaptureReplayData(device_info, capture_id);
                         }
                     }
                 }
@@ -4649,7 +5030,11 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory(PFN_vkBindBufferMemo
                                                   memory_info->allocator_data,
                                                   &buffer_info->memory_property_flags);
 
-    if ((result != VK_SUCCESS) && (original_result == VK_SUCCESS))
+    if (result == VK_SUCCESS)
+    {
+        buffer_info->memory_id = memory_info->capture_id;
+    }
+    else if (original_result == VK_SUCCESS)
     {
         // When bind fails at replay, but succeeded at capture, check for memory incompatibilities and recommend
         // enabling memory translation.
@@ -4720,6 +5105,7 @@ VkResult VulkanReplayConsumerBase::OverrideBindBufferMemory2(
             if (buffer_info != nullptr)
             {
                 buffer_info->memory_property_flags = memory_property_flags[i];
+                buffer_info->memory_id             = replay_bind_meta_infos[i].memory;
             }
         }
     }
@@ -4756,7 +5142,11 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory(PFN_vkBindImageMemory
                                                  memory_info->allocator_data,
                                                  &image_info->memory_property_flags);
 
-    if ((result != VK_SUCCESS) && (original_result == VK_SUCCESS))
+    if (result == VK_SUCCESS)
+    {
+        image_info->memory_id = memory_info->capture_id;
+    }
+    else if (original_result == VK_SUCCESS)
     {
         // When bind fails at replay, but succeeded at capture, check for memory incompatibilities and recommend
         // enabling memory translation.
@@ -4829,6 +5219,7 @@ VkResult VulkanReplayConsumerBase::OverrideBindImageMemory2(
             if (image_info != nullptr)
             {
                 image_info->memory_property_flags = memory_property_flags[i];
+                image_info->memory_id             = replay_bind_meta_infos[i].memory;
             }
         }
     }
@@ -4990,6 +5381,7 @@ VulkanReplayConsumerBase::OverrideCreateBuffer(PFN_vkCreateBuffer
         if (entry != device_info->opaque_addresses.end())
         {
             address_info.opaqueCaptureAddress = entry->second;
+            ReleaseCaptureReplayData(device_info, capture_id);
 
             // The shallow copy of VkBufferCreateInfo references the same pNext list from the copy source.  We insert
             // the buffer address extension struct at the start of the list to avoid modifying the original by appending
@@ -5844,7 +6236,36 @@ VkResult VulkanReplayConsumerBase::OverrideCreateShaderModule(
     assert((device_info != nullptr) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() &&
            (pShaderModule != nullptr) && !pShaderModule->IsNull());
 
-    auto original_info = pCreateInfo->GetPointer();
+    auto        original_info = pCreateInfo->GetPointer();
+    std::string deduplication_key;
+    if (options_.deduplicate_pipelines && (original_result >= 0) &&
+        GetDeduplicationKey(device_info->capture_id, *original_info, &deduplication_key))
+    {
+        auto shader_info = reinterpret_cast<VulkanShaderModuleInfo*>(pShaderModule->GetConsumerData(0));
+        assert(shader_info != nullptr);
+
+        shader_info->deduplicated_object = shader_module_deduplicator_.Find(deduplication_key);
+        if (shader_info->deduplicated_object != nullptr)
+        {
+            *pShaderModule->GetHandlePointer() = shader_info->deduplicated_object->handle;
+            return VK_SUCCESS;
+        }
+
+        VkResult vk_res = func(
+            device_info->handle, original_info, GetAllocationCallbacks(pAllocator), pShaderModule->GetHandlePointer());
+
+        if (vk_res == VK_SUCCESS)
+        {
+            shader_info->deduplicated_object = shader_module_deduplicator_.Add(
+                device_info->handle, *pShaderModule->GetHandlePointer(), std::move(deduplication_key));
+
+            // check for buffer-references, issue warning
+            graphics::vulkan_check_buffer_references(original_info->pCode, original_info->codeSize);
+        }
+
+        return vk_res;
+    }
+
     if (original_result < 0 || options_.replace_shader_dir.empty())
     {
         VkResult vk_res = func(
@@ -5984,9 +6405,9 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
 
                 for (auto& existing_cache_data : cache_data)
                 {
-                    if (cache_data_size == existing_cache_data.capture_cache_data.size())
+                    if (cache_data_size == existing_cache_data.capture_cache_data->size())
                     {
-                        if (memcmp(existing_cache_data.capture_cache_data.data(),
+                        if (memcmp(existing_cache_data.capture_cache_data->data(),
                                    pData->GetPointer(),
                                    cache_data_size) == 0)
                         {
@@ -6002,16 +6423,30 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
 
             if (new_cache_data)
             {
+                // Applications commonly retrieve the same cache data from several pipeline caches. Share the blobs
+                // tracked for another pipeline cache instead of storing another copy.
+                const VulkanPipelineCacheData* shared_cache_data =
+                    FindPipelineCacheData(capture_pipeline_cache_data_hash, pData->GetPointer(), cache_data_size);
+
                 std::vector<VulkanPipelineCacheData>& item =
                     const_cast<VulkanPipelineCacheInfo*>(pipeline_cache_info)
                         ->pipeline_cache_data[capture_pipeline_cache_data_hash];
-                auto                    output_cache_data_size = *pDataSize->GetOutputPointer();
-                VulkanPipelineCacheData pipeline_cache_data;
-                pipeline_cache_data.capture_cache_data.resize(cache_data_size);
-                memcpy(pipeline_cache_data.capture_cache_data.data(), pData->GetPointer(), cache_data_size);
-                pipeline_cache_data.replay_cache_data.resize(output_cache_data_size);
-                memcpy(pipeline_cache_data.replay_cache_data.data(), pData->GetOutputPointer(), output_cache_data_size);
-                item.push_back(std::move(pipeline_cache_data));
+
+                if (shared_cache_data != nullptr)
+                {
+                    item.push_back(*shared_cache_data);
+                }
+                else
+                {
+                    auto                    output_cache_data_size = *pDataSize->GetOutputPointer();
+                    const uint8_t*          output_cache_data      = pData->GetOutputPointer();
+                    VulkanPipelineCacheData pipeline_cache_data;
+                    pipeline_cache_data.capture_cache_data = std::make_shared<const std::vector<uint8_t>>(
+                        pData->GetPointer(), pData->GetPointer() + cache_data_size);
+                    pipeline_cache_data.replay_cache_data  = std::make_shared<const std::vector<uint8_t>>(
+                        output_cache_data, output_cache_data + output_cache_data_size);
+                    item.push_back(std::move(pipeline_cache_data));
+                }
             }
         }
         return replay_result;
@@ -6031,8 +6466,9 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     GFXRECON_ASSERT((device_info != nullptr) && (pCreateInfo != nullptr) && (pPipelineCache != nullptr) &&
                     (pPipelineCache->GetHandlePointer() != nullptr) && (pCreateInfo->GetPointer() != nullptr));
 
-    VkPipelineCacheCreateInfo override_create_info = *pCreateInfo->GetPointer();
-    std::vector<char>         pipelineCacheData;
+    VkPipelineCacheCreateInfo                   override_create_info = *pCreateInfo->GetPointer();
+    std::vector<char>                           pipelineCacheData;
+    std::shared_ptr<const std::vector<uint8_t>> replay_cache_data;
 
     // If pipeline cache must not be loaded
     if (options_.omit_pipeline_cache_data)
@@ -6071,50 +6507,19 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
         // This vkCreatePipelineCache call has initial pipeline cache data, the data is valid for capture time,
         // but it might not be valid for replay time if considering platform/driver version change. So in the
         // following process, we'll try to find corresponding replay time pipeline cache data.
-        matched_replay_cache_data_exist_  = false;
-        capture_pipeline_cache_data_hash_ = gfxrecon::util::hash::GenerateCheckSum<uint32_t>(
+        uint32_t capture_pipeline_cache_data_hash = gfxrecon::util::hash::GenerateCheckSum<uint32_t>(
             reinterpret_cast<const uint8_t*>(override_create_info.pInitialData), override_create_info.initialDataSize);
-        capture_pipeline_cache_data_      = const_cast<void*>(override_create_info.pInitialData);
-        capture_pipeline_cache_data_size_ = override_create_info.initialDataSize;
-
-        object_info_table_->VisitVkPipelineCacheInfo([this](const VulkanPipelineCacheInfo* pipeline_cache_info) {
-            GFXRECON_ASSERT(pipeline_cache_info != nullptr);
-
-            auto iterator = pipeline_cache_info->pipeline_cache_data.find(capture_pipeline_cache_data_hash_);
-
-            if (iterator != pipeline_cache_info->pipeline_cache_data.end())
-            {
-                // We found pipeline cache data vector which has same hash value, will continue to check if it has
-                // same capture time pipeline cache data.
-                auto& cache_data = iterator->second;
 
-                for (auto& existing_cache_data : cache_data)
-                {
-                    if (capture_pipeline_cache_data_size_ == existing_cache_data.capture_cache_data.size())
-                    {
-                        // Target pipeline cache data has same size, we continue to check if it also has same data.
-                        if (memcmp(existing_cache_data.capture_cache_data.data(),
-                                   capture_pipeline_cache_data_,
-                                   capture_pipeline_cache_data_size_) == 0)
-                        {
-                            // Now we found the pipeline cache data, here we record its replay time data because we
-                            // need this data to replace capture time cache data in the vkCreatePipelineCache call.
-                            matched_replay_cache_data_exist_ = true;
-                            matched_replay_cache_data_.resize(existing_cache_data.replay_cache_data.size());
-                            memcpy(matched_replay_cache_data_.data(),
-                                   existing_cache_data.replay_cache_data.data(),
-                                   existing_cache_data.replay_cache_data.size());
-                            break;
-                        }
-                    }
-                }
-            }
-        });
+        const VulkanPipelineCacheData* cache_data = FindPipelineCacheData(
+            capture_pipeline_cache_data_hash, override_create_info.pInitialData, override_create_info.initialDataSize);
 
-        if (matched_replay_cache_data_exist_)
+        if (cache_data != nullptr)
         {
-            override_create_info.initialDataSize = matched_replay_cache_data_.size();
-            override_create_info.pInitialData    = matched_replay_cache_data_.data();
+            // Keep a reference to the replay time data, which replaces the capture time cache data in the
+            // vkCreatePipelineCache call.
+            replay_cache_data                    = cache_data->replay_cache_data;
+            override_create_info.initialDataSize = replay_cache_data->size();
+            override_create_info.pInitialData    = replay_cache_data->data();
         }
         else
         {
@@ -6183,6 +6588,7 @@ VkResult VulkanReplayConsumerBase::OverrideResetDescriptorPool(PFN_vkResetDescri
     // Descriptor sets allocated from the pool are implicitly freed and must be removed from the object info table.
     for (auto child_id : pool_info->child_ids)
     {
+        TrackDestroyedObject(child_id);
         object_info_table_->RemoveVkDescriptorSetInfo(child_id);
     }
 
@@ -7830,6 +8236,7 @@ VkResult VulkanReplayConsumerBase::OverrideCreateAccelerationStructureKHR(
         if (entry != device_info->opaque_addresses.end())
         {
             modified_create_info.deviceAddress = entry->second;
+            ReleaseCaptureReplayData(device_info, capture_id);
         }
         else
         {
@@ -7975,6 +8382,11 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
         overridePipelineCache = CreateNewPipelineCache(device_info, *pPipelines->GetPointer());
     }
 
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        overridePipelineCache = persistent_pipeline_cache_->GetPipelineCache(device_info->handle);
+    }
+
     if (deferred_operation_info)
     {
         deferred_operation_info->pending_state = true;
@@ -8094,6 +8506,15 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
                 // vkDeferredOperationJoinKHR handling.
                 deferred_operation_info->pending_state = false;
             }
+
+            // The shader group handle data is not referenced after the pipelines have been created.
+            if (result != VK_PIPELINE_COMPILE_REQUIRED_EXT)
+            {
+                for (uint32_t create_info_i = 0; create_info_i < createInfoCount; ++create_info_i)
+                {
+                    ReleaseCaptureReplayData(device_info, pPipelines->GetPointer()[create_info_i]);
+                }
+            }
         }
 
         if (deferred_operation_info)
@@ -8166,7 +8587,7 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesKHR(
     }
 
     // If a pipeline cache was created, track it to know when to destroy it/save it to file
-    if (in_pipelineCache != overridePipelineCache && result == VK_SUCCESS)
+    if (options_.add_new_pipeline_caches && in_pipelineCache != overridePipelineCache && result == VK_SUCCESS)
     {
         TrackNewPipelineCache(device_info,
                               *pPipelines->GetPointer(),
@@ -8339,6 +8760,11 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesNV(
         overridePipelineCache = CreateNewPipelineCache(device_info, *pPipelines->GetPointer());
     }
 
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        overridePipelineCache = persistent_pipeline_cache_->GetPipelineCache(device_info->handle);
+    }
+
     // Forward the call with the adequate pipeline cache
 
     VkResult result = func(device_info->handle,
@@ -8350,7 +8776,7 @@ VkResult VulkanReplayConsumerBase::OverrideCreateRayTracingPipelinesNV(
 
     // If a pipeline cache was created, track it to know when to destroy it/save it to file
 
-    if (pipelineCache != overridePipelineCache && result == VK_SUCCESS)
+    if (options_.add_new_pipeline_caches && pipelineCache != overridePipelineCache && result == VK_SUCCESS)
     {
         TrackNewPipelineCache(device_info,
                               *pPipelines->GetPointer(),
@@ -10003,6 +10429,106 @@ void VulkanReplayConsumerBase::OverrideUpdateDescriptorSets(
     return replaced_file_code;
 }
 
+template <typename T, typename DecodedT>
+VkResult VulkanReplayConsumerBase::CreateDeduplicatedPipelines(
+    const VulkanDeviceInfo*                                         device_info,
+    uint32_t                                                        create_info_count,
+    const T*                                                        create_infos,
+    const DecodedT*                                                 create_infos_meta,
+    HandlePointerDecoder<VkPipeline>*                               pPipelines,
+    const std::function<VkResult(uint32_t, const T*, VkPipeline*)>& create_pipelines)
+{
+    GFXRECON_ASSERT((device_info != nullptr) && (create_infos != nullptr) && (create_infos_meta != nullptr) &&
+                    (pPipelines != nullptr));
+
+    VkPipeline*              out_pipelines = pPipelines->GetHandlePointer();
+    std::vector<std::string> keys(create_info_count);
+
+    // Shader modules that were deduplicated are identified by the unique ID of their shared object, which is never
+    // reused, unlike the replay handle value.
+    auto get_shared_module_id = [this](format::HandleId module_id, uint64_t* shared_id) {
+        const VulkanShaderModuleInfo* module_info = GetObjectInfoTable().GetVkShaderModuleInfo(module_id);
+        if ((module_info == nullptr) || (module_info->deduplicated_object == nullptr))
+        {
+            return false;
+        }
+
+        *shared_id = module_info->deduplicated_object->unique_id;
+        return true;
+    };
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        // Derivatives referencing another element of the batch by index can't be reordered, so the batch is created
+        // as captured.
+        if (((create_infos[i].flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) != 0 &&
+             create_infos[i].basePipelineIndex >= 0) ||
+            !GetDeduplicationKey(device_info->capture_id, create_infos_meta[i], get_shared_module_id, &keys[i]))
+        {
+            return create_pipelines(create_info_count, create_infos, out_pipelines);
+        }
+    }
+
+    std::vector<VulkanCreateInfoDeduplicator<VkPipeline>::SharedObject> objects(create_info_count);
+    std::vector<uint32_t>                                               source_indices(create_info_count);
+    std::unordered_map<std::string, uint32_t>                           batch_indices;
+    std::vector<uint32_t>                                               unique_indices;
+    std::vector<T>                                                      unique_create_infos;
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        objects[i] = pipeline_deduplicator_.Find(keys[i]);
+        if (objects[i] == nullptr)
+        {
+            auto entry        = batch_indices.emplace(keys[i], i);
+            source_indices[i] = entry.first->second;
+            if (entry.second)
+            {
+                unique_indices.push_back(i);
+                unique_create_infos.push_back(create_infos[i]);
+            }
+        }
+    }
+
+    VkResult                replay_result = VK_SUCCESS;
+    std::vector<VkPipeline> unique_pipelines(unique_indices.size(), VK_NULL_HANDLE);
+
+    if (!unique_create_infos.empty())
+    {
+        replay_result = create_pipelines(static_cast<uint32_t>(unique_create_infos.size()),
+                                         unique_create_infos.data(),
+                                         unique_pipelines.data());
+
+        for (size_t i = 0; i < unique_indices.size(); ++i)
+        {
+            if (unique_pipelines[i] != VK_NULL_HANDLE)
+            {
+                uint32_t index = unique_indices[i];
+                objects[index] =
+                    pipeline_deduplicator_.Add(device_info->handle, unique_pipelines[i], std::move(keys[index]));
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        if (objects[i] == nullptr)
+        {
+            objects[i] = objects[source_indices[i]];
+        }
+
+        out_pipelines[i] = (objects[i] != nullptr) ? objects[i]->handle : VK_NULL_HANDLE;
+
+        auto pipeline_info = reinterpret_cast<VulkanPipelineInfo*>(pPipelines->GetConsumerData(i));
+        if (pipeline_info != nullptr)
+        {
+            pipeline_info->deduplicated_object = objects[i];
+        }
+    }
+
+    return replay_result;
+}
+
 VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
     PFN_vkCreateGraphicsPipelines                                     func,
     VkResult                                                          original_result,
@@ -10030,6 +10556,11 @@ VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
         override_pipeline_cache = CreateNewPipelineCache(device_info, *pPipelines->GetPointer());
     }
 
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        override_pipeline_cache = persistent_pipeline_cache_->GetPipelineCache(device_info->handle);
+    }
+
     std::vector<uint8_t>                 create_info_data;
     std::vector<std::unique_ptr<char[]>> replaced_file_code;
     auto*                                maybe_replaced_create_infos = in_p_create_infos;
@@ -10046,16 +10577,33 @@ VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
         maybe_replaced_create_infos = replaced_create_infos;
     }
 
-    VkResult replay_result = func(in_device,
-                                  override_pipeline_cache,
-                                  create_info_count,
-                                  maybe_replaced_create_infos,
-                                  in_p_allocation_callbacks,
-                                  out_pipelines);
+    VkResult replay_result = VK_SUCCESS;
+    if (options_.deduplicate_pipelines && (original_result >= 0))
+    {
+        replay_result = CreateDeduplicatedPipelines<VkGraphicsPipelineCreateInfo>(
+            device_info,
+            create_info_count,
+            in_p_create_infos,
+            pCreateInfos->GetMetaStructPointer(),
+            pPipelines,
+            [&](uint32_t count, const VkGraphicsPipelineCreateInfo* create_infos, VkPipeline* pipelines) {
+                return func(
+                    in_device, override_pipeline_cache, count, create_infos, in_p_allocation_callbacks, pipelines);
+            });
+    }
+    else
+    {
+        replay_result = func(in_device,
+                             override_pipeline_cache,
+                             create_info_count,
+                             maybe_replaced_create_infos,
+                             in_p_allocation_callbacks,
+                             out_pipelines);
+    }
 
     // If a pipeline cache was created, track it to know when to destroy it/save it to file
 
-    if (in_pipeline_cache != override_pipeline_cache && replay_result == VK_SUCCESS)
+    if (options_.add_new_pipeline_caches && in_pipeline_cache != override_pipeline_cache && replay_result == VK_SUCCESS)
     {
         TrackNewPipelineCache(device_info,
                               *pPipelines->GetPointer(),
@@ -10088,8 +10636,6 @@ VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
     const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
     HandlePointerDecoder<VkPipeline>*                                pPipelines)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(original_result);
-
     GFXRECON_ASSERT((device_info != nullptr) && (pCreateInfos != nullptr) && (pAllocator != nullptr) &&
                     (pPipelines != nullptr) && !pPipelines->IsNull() && (pPipelines->GetHandlePointer() != nullptr));
 
@@ -10107,16 +10653,38 @@ VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
         override_pipeline_cache = CreateNewPipelineCache(device_info, *pPipelines->GetPointer());
     }
 
-    VkResult replay_result = func(in_device,
-                                  override_pipeline_cache,
-                                  create_info_count,
-                                  in_p_create_infos,
-                                  in_p_allocation_callbacks,
-                                  out_pipelines);
+    if (persistent_pipeline_cache_ != nullptr)
+    {
+        override_pipeline_cache = persistent_pipeline_cache_->GetPipelineCache(device_info->handle);
+    }
+
+    VkResult replay_result = VK_SUCCESS;
+    if (options_.deduplicate_pipelines && (original_result >= 0))
+    {
+        replay_result = CreateDeduplicatedPipelines<VkComputePipelineCreateInfo>(
+            device_info,
+            create_info_count,
+            in_p_create_infos,
+            pCreateInfos->GetMetaStructPointer(),
+            pPipelines,
+            [&](uint32_t count, const VkComputePipelineCreateInfo* create_infos, VkPipeline* pipelines) {
+                return func(
+                    in_device, override_pipeline_cache, count, create_infos, in_p_allocation_callbacks, pipelines);
+            });
+    }
+    else
+    {
+        replay_result = func(in_device,
+                             override_pipeline_cache,
+                             create_info_count,
+                             in_p_create_infos,
+                             in_p_allocation_callbacks,
+                             out_pipelines);
+    }
 
     // If a pipeline cache was created, track it to know when to destroy it/save it to file
 
-    if (in_pipeline_cache != override_pipeline_cache && replay_result == VK_SUCCESS)
+    if (options_.add_new_pipeline_caches && in_pipeline_cache != override_pipeline_cache && replay_result == VK_SUCCESS)
     {
         TrackNewPipelineCache(device_info,
                               *pPipelines->GetPointer(),
@@ -10247,6 +10815,17 @@ void VulkanReplayConsumerBase::OverrideDestroyPipeline(
         in_pipeline =
             MapHandle<VulkanPipelineInfo>(pipeline_info->capture_id, &VulkanObjectInfoTable::GetVkPipelineInfo);
 
+        // A deduplicated pipeline is destroyed with the last pipeline info that references it.
+        if (pipeline_info->deduplicated_object != nullptr)
+        {
+            if (pipeline_info->deduplicated_object.use_count() > 1)
+            {
+                return;
+            }
+
+            pipeline_deduplicator_.Remove(pipeline_info->deduplicated_object.get());
+        }
+
         if (IsUsedByAsyncTask(pipeline_info->capture_id))
         {
             // schedule deletion
@@ -10332,6 +10911,17 @@ void VulkanReplayConsumerBase::OverrideDestroyShaderModule(
     {
         in_shader_module = shader_module_info->handle;
 
+        // A deduplicated shader module is destroyed with the last shader module info that references it.
+        if (shader_module_info->deduplicated_object != nullptr)
+        {
+            if (shader_module_info->deduplicated_object.use_count() > 1)
+            {
+                return;
+            }
+
+            shader_module_deduplicator_.Remove(shader_module_info->deduplicated_object.get());
+        }
+
         if (IsUsedByAsyncTask(shader_module_info->capture_id))
         {
             // schedule deletion
@@ -10356,7 +10946,8 @@ std::function<decode::handle_create_result_t<VkPipeline>()> VulkanReplayConsumer
     HandlePointerDecoder<VkPipeline>*                           pPipelines)
 {
     // avoid async operations if an externally synchronized pipeline-cache is used
-    if (pipeline_cache_info != nullptr && pipeline_cache_info->requires_external_synchronization)
+    if (persistent_pipeline_cache_ == nullptr && pipeline_cache_info != nullptr &&
+        pipeline_cache_info->requires_external_synchronization)
     {
         return {};
     }
@@ -10412,8 +11003,19 @@ std::function<decode::handle_create_result_t<VkPipeline>()> VulkanReplayConsumer
             replaced_file_code = ReplaceShaders(createInfoCount, create_infos, pipelines.data());
         }
 
+        // Each worker thread uses its own persistent pipeline cache.
+        if (persistent_pipeline_cache_ != nullptr)
+        {
+            pipeline_cache_handle = persistent_pipeline_cache_->GetPipelineCache(device_handle);
+        }
+
+        int64_t  start_time    = util::datetime::GetTimestamp();
         VkResult replay_result = func(
             device_handle, pipeline_cache_handle, createInfoCount, create_infos, in_pAllocator, out_pipelines.data());
+        RecordCompileTime("vkCreateGraphicsPipelines",
+                          pipelines.empty() ? format::kNullHandleId : pipelines[0],
+                          createInfoCount,
+                          start_time);
         CheckResult("vkCreateGraphicsPipelines", returnValue, replay_result, call_info);
 
         if (replay_result == VK_SUCCESS)
@@ -10440,7 +11042,8 @@ std::function<handle_create_result_t<VkPipeline>()> VulkanReplayConsumerBase::As
     HandlePointerDecoder<VkPipeline>*                          pPipelines)
 {
     // avoid async operations if an externally synchronized pipeline-cache is used
-    if (pipeline_cache_info != nullptr && pipeline_cache_info->requires_external_synchronization)
+    if (persistent_pipeline_cache_ == nullptr && pipeline_cache_info != nullptr &&
+        pipeline_cache_info->requires_external_synchronization)
     {
         return {};
     }
@@ -10457,10 +11060,13 @@ std::function<handle_create_result_t<VkPipeline>()> VulkanReplayConsumerBase::As
     graphics::vulkan_struct_deep_copy(in_pCreateInfos, createInfoCount, create_info_data.data());
 
     // extract handle-dependencies and track those
-    auto                  handle_deps = graphics::vulkan_struct_extract_handle_ids(pCreateInfos);
+    auto                  handle_deps       = graphics::vulkan_struct_extract_handle_ids(pCreateInfos);
+    format::HandleId      first_pipeline_id = format::kNullHandleId;
     std::function<void()> sync_fn;
     if (pPipelines != nullptr && createInfoCount > 0)
     {
+        first_pipeline_id = pPipelines->GetPointer()[0];
+
         sync_fn = [this, parent_id = pPipelines->GetPointer()[0]]() {
             MapHandle<VulkanPipelineInfo>(parent_id, &VulkanObjectInfoTable::GetVkPipelineInfo);
         };
@@ -10476,12 +11082,22 @@ std::function<handle_create_result_t<VkPipeline>()> VulkanReplayConsumerBase::As
                  call_info,
                  in_pAllocator,
                  createInfoCount,
+                 first_pipeline_id,
                  create_info_data = std::move(create_info_data),
                  handle_deps      = std::move(handle_deps)]() mutable -> handle_create_result_t<VkPipeline> {
         std::vector<VkPipeline> out_pipelines(createInfoCount);
-        auto     create_infos  = reinterpret_cast<const VkComputePipelineCreateInfo*>(create_info_data.data());
+        auto create_infos = reinterpret_cast<const VkComputePipelineCreateInfo*>(create_info_data.data());
+
+        // Each worker thread uses its own persistent pipeline cache.
+        if (persistent_pipeline_cache_ != nullptr)
+        {
+            pipeline_cache_handle = persistent_pipeline_cache_->GetPipelineCache(device_handle);
+        }
+
+        int64_t  start_time    = util::datetime::GetTimestamp();
         VkResult replay_result = func(
             device_handle, pipeline_cache_handle, createInfoCount, create_infos, in_pAllocator, out_pipelines.data());
+        RecordCompileTime("vkCreateComputePipelines", first_pipeline_id, createInfoCount, start_time);
         CheckResult("vkCreateComputePipelines", returnValue, replay_result, call_info);
 
         if (replay_result == VK_SUCCESS)
@@ -10549,7 +11165,10 @@ VulkanReplayConsumerBase::AsyncCreateShadersEXT(PFN_vkCreateShadersEXT
             replaced_file_code = ReplaceShaders(createInfoCount, create_infos, shaders.data());
         }
 
+        int64_t  start_time    = util::datetime::GetTimestamp();
         VkResult replay_result = func(device_handle, createInfoCount, create_infos, in_pAllocator, out_shaders.data());
+        RecordCompileTime(
+            "vkCreateShadersEXT", shaders.empty() ? format::kNullHandleId : shaders[0], createInfoCount, start_time);
         CheckResult("vkCreateShadersEXT", returnValue, replay_result, call_info);
 
         if (replay_result == VK_SUCCESS)
@@ -10636,6 +11255,51 @@ void VulkanReplayConsumerBase::SetCurrentBlockIndex(uint64_t block_index)
     main_thread_queue_.poll();
 }
 
+void VulkanReplayConsumerBase::ReleaseCaptureReplayData(const VulkanDeviceInfo* device_info,
+                                                        format::HandleId        capture_id)
+{
+    // Objects that are created inside the measurement range are created again each time the range is looped.
+    if (options_.measurement_range_loop_count <= 1)
+    {
+        auto mutable_device_info = const_cast<VulkanDeviceInfo*>(device_info);
+        mutable_device_info->opaque_addresses.erase(capture_id);
+        mutable_device_info->shader_group_handles.erase(capture_id);
+    }
+}
+
+const VulkanPipelineCacheData* VulkanReplayConsumerBase::FindPipelineCacheData(uint32_t    capture_data_hash,
+                                                                              const void* capture_data,
+                                                                              size_t      capture_data_size)
+{
+    const VulkanPipelineCacheData* found_cache_data = nullptr;
+
+    object_info_table_->VisitVkPipelineCacheInfo([&](const VulkanPipelineCacheInfo* pipeline_cache_info) {
+        GFXRECON_ASSERT(pipeline_cache_info != nullptr);
+
+        if (found_cache_data != nullptr)
+        {
+            return;
+        }
+
+        auto iterator = pipeline_cache_info->pipeline_cache_data.find(capture_data_hash);
+        if (iterator != pipeline_cache_info->pipeline_cache_data.end())
+        {
+            // Data with the same hash value was found, check if it also has the same capture time data.
+            for (const auto& existing_cache_data : iterator->second)
+            {
+                if ((capture_data_size == existing_cache_data.capture_cache_data->size()) &&
+                    (memcmp(existing_cache_data.capture_cache_data->data(), capture_data, capture_data_size) == 0))
+                {
+                    found_cache_data = &existing_cache_data;
+                    break;
+                }
+            }
+        }
+    });
+
+    return found_cache_data;
+}
+
 void VulkanReplayConsumerBase::LoadPipelineCache(format::HandleId id, std::vector<char>& pipelineCacheData)
 {
     FILE*   file  = nullptr;
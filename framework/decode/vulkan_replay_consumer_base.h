@@ -30,10 +30,13 @@
 #include "decode/screenshot_handler.h"
 #include "decode/swapchain_image_tracker.h"
 #include "decode/vulkan_device_address_tracker.h"
+#include "decode/vulkan_gpu_frame_timer.h"
 #include "decode/vulkan_address_replacer.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
+#include "decode/vulkan_persistent_pipeline_cache.h"
 #include "decode/common_object_info_table.h"
+#include "decode/vulkan_create_info_deduplicator.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_tracking_consumer.h"
@@ -57,6 +60,7 @@
 #include <cassert>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -70,6 +74,15 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Compile time of an asynchronous pipeline or shader object creation call.
+struct VulkanPipelineCompileTime
+{
+    const char*      call_name;
+    format::HandleId first_id; // Capture ID of the first pipeline or shader object that was created by the call.
+    uint32_t         count;
+    int64_t          duration; // Nanoseconds.
+};
+
 class VulkanReplayConsumerBase : public VulkanConsumer
 {
   public:
@@ -86,10 +99,26 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFatalErrorHandler(std::function<void(const char*)> handler);
 
-    void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
+    void SetFpsInfo(graphics::FpsInfo* fps_info);
+
+    // Records the compile time of each pipeline or shader object creation call that is processed asynchronously.
+    void EnablePipelineCompileTimes() { record_compile_times_ = true; }
+
+    std::vector<VulkanPipelineCompileTime> GetPipelineCompileTimes();
+
+    // Waits for the asynchronous pipeline and shader object creation tasks to complete.
+    void WaitAsyncOperations();
 
     virtual void WaitDevicesIdle() override;
 
+    // Saves the content of the buffers and images that can be written by the device. Images with an undefined
+    // layout, multisampled images, linear images and swapchain images are not saved.
+    virtual void SaveResourceState() override;
+
+    // Returns false without restoring the content if objects were created or destroyed since the content was saved, as
+    // the range cannot be replayed again with the same objects.
+    virtual bool RestoreResourceState() override;
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) override;
@@ -166,6 +195,8 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const std::vector<uint64_t>& level_sizes,
                                          const uint8_t*               data) override;
 
+    virtual format::HandleId GetCommandBufferPoolId(format::HandleId command_buffer_id) const override;
+
     virtual void Process_vkUpdateDescriptorSetWithTemplate(const ApiCallInfo&               call_info,
                                                            format::HandleId                 device,
                                                            format::HandleId                 descriptorSet,
@@ -362,6 +393,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     {
         if ((id != nullptr) && (handle != nullptr))
         {
+            TrackCreatedObjects(id, 1);
             handle_mapping::AddHandle(
                 parent_id, *id, *handle, std::forward<T>(initial_info), object_info_table_, AddFunc);
         }
@@ -375,6 +407,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     {
         if ((id != nullptr) && (handle != nullptr))
         {
+            TrackCreatedObjects(id, 1);
             handle_mapping::AddHandle(parent_id, *id, *handle, object_info_table_, AddFunc);
         }
     }
@@ -388,6 +421,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                     std::vector<T>&&              initial_infos,
                     void (CommonObjectInfoTable::*AddFunc)(T&&))
     {
+        TrackCreatedObjects(ids, ids_len);
         handle_mapping::AddHandleArray(
             parent_id, ids, ids_len, handles, handles_len, std::move(initial_infos), object_info_table_, AddFunc);
     }
@@ -400,6 +434,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                     size_t                        handles_len,
                     void (CommonObjectInfoTable::*AddFunc)(T&&))
     {
+        TrackCreatedObjects(ids, ids_len);
         handle_mapping::AddHandleArray(parent_id, ids, ids_len, handles, handles_len, object_info_table_, AddFunc);
     }
 
@@ -418,6 +453,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
             // poll in case there are no worker-threads
             background_queue_.poll();
 
+            TrackCreatedObjects(ids, ids_len);
             handle_mapping::AddHandleArrayAsync(
                 parent_id, ids, ids_len, object_info_table_, AddFunc, std::move(result_future));
         }
@@ -439,6 +475,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
             // poll in case there are no worker-threads
             background_queue_.poll();
 
+            TrackCreatedObjects(ids, ids_len);
             handle_mapping::AddHandleArrayAsync(parent_id,
                                                 ids,
                                                 ids_len,
@@ -449,6 +486,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         }
     }
 
+    // Tracks the objects that are created and destroyed while a looped frame range is replayed. The range can only be
+    // replayed again if it destroys every object that it creates, and no object that was created before it.
+    void TrackCreatedObjects(const format::HandleId* ids, size_t count);
+
+    void TrackDestroyedObject(format::HandleId id);
+
     //! track arbitrary handles that are currently used by asynchronous operations
     void TrackAsyncHandles(const std::unordered_set<format::HandleId>& async_handles,
                            const std::function<void()>&                sync_fn);
@@ -460,6 +503,9 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     //! schedules deletion of already tracked handles
     void DestroyAsyncHandle(format::HandleId handle, std::function<void()> destroy_fn);
 
+    //! records the compile time of an asynchronous creation call, started at start_time, when enabled
+    void RecordCompileTime(const char* call_name, format::HandleId first_id, uint32_t count, int64_t start_time);
+
     //! return true if this handle is currently being tracked (was passed to 'TrackAsyncHandles' earlier)
     bool IsUsedByAsyncTask(uint64_t handle) const { return async_tracked_handles_.count(handle) > 0; }
 
@@ -480,6 +526,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                         S* (CommonObjectInfoTable::*GetPoolInfoFunc)(format::HandleId),
                         void (CommonObjectInfoTable::*AddFunc)(T&&))
     {
+        TrackCreatedObjects(ids, ids_len);
         handle_mapping::AddHandleArray(parent_id,
                                        pool_id,
                                        ids,
@@ -502,12 +549,14 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                         S* (CommonObjectInfoTable::*GetPoolInfoFunc)(format::HandleId),
                         void (CommonObjectInfoTable::*AddFunc)(T&&))
     {
+        TrackCreatedObjects(ids, ids_len);
         handle_mapping::AddHandleArray(
             parent_id, pool_id, ids, ids_len, handles, handles_len, object_info_table_, GetPoolInfoFunc, AddFunc);
     }
 
     void RemoveHandle(format::HandleId id, void (CommonObjectInfoTable::*RemoveFunc)(format::HandleId))
     {
+        TrackDestroyedObject(id);
         handle_mapping::RemoveHandle(id, object_info_table_, RemoveFunc);
     }
 
@@ -517,6 +566,16 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                           void (CommonObjectInfoTable::*RemovePoolFunc)(format::HandleId),
                           void (CommonObjectInfoTable::*RemoveObjectFunc)(format::HandleId))
     {
+        const T* pool_info = (object_info_table_->*GetPoolInfoFunc)(id);
+        if (pool_info != nullptr)
+        {
+            for (auto child_id : pool_info->child_ids)
+            {
+                TrackDestroyedObject(child_id);
+            }
+        }
+
+        TrackDestroyedObject(id);
         handle_mapping::RemovePoolHandle(id, object_info_table_, GetPoolInfoFunc, RemovePoolFunc, RemoveObjectFunc);
     }
 
@@ -534,6 +593,16 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         {
             // The handle and ID array sizes are expected to be the same for mapping operations.
             assert(handles_len == handles_pointer->GetLength());
+
+            if (!handles_pointer->IsNull())
+            {
+                const format::HandleId* ids = handles_pointer->GetPointer();
+                for (size_t i = 0; i < handles_pointer->GetLength(); ++i)
+                {
+                    TrackDestroyedObject(ids[i]);
+                }
+            }
+
             handle_mapping::RemoveHandleArray<S, T>(
                 pool_id, handles_pointer, object_info_table_, GetPoolInfoFunc, RemoveFunc);
         }
@@ -1573,6 +1642,25 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                                                       VkShaderCreateInfoEXT*  create_infos,
                                                                       const format::HandleId* shaders) const;
 
+    // Creates the pipelines for the create infos that do not match a pipeline created by a previous call to replay
+    // with --deduplicate-pipelines, and assigns the shared pipeline to the others. The decoded create infos provide
+    // the capture IDs of the referenced objects for the deduplication keys.
+    template <typename T, typename DecodedT>
+    VkResult
+    CreateDeduplicatedPipelines(const VulkanDeviceInfo*                                         device_info,
+                                uint32_t                                                        create_info_count,
+                                const T*                                                        create_infos,
+                                const DecodedT*                                                 create_infos_meta,
+                                HandlePointerDecoder<VkPipeline>*                               pPipelines,
+                                const std::function<VkResult(uint32_t, const T*, VkPipeline*)>& create_pipelines);
+
+    // Releases the opaque address or shader group handle data used to create the specified object.
+    void ReleaseCaptureReplayData(const VulkanDeviceInfo* device_info, format::HandleId capture_id);
+
+    // Returns the pipeline cache data tracked for any pipeline cache with the specified capture time data, or nullptr.
+    const VulkanPipelineCacheData*
+    FindPipelineCacheData(uint32_t capture_data_hash, const void* capture_data, size_t capture_data_size);
+
     void LoadPipelineCache(format::HandleId id, std::vector<char>& pipelineCacheData);
     void SavePipelineCache(format::HandleId id, const VulkanDeviceInfo* device_info, VkPipelineCache pipelineCache);
     VkPipelineCache CreateNewPipelineCache(const VulkanDeviceInfo* device_info, format::HandleId id);
@@ -1605,6 +1693,17 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         std::vector<HardwareBufferPlaneInfo> plane_info;
     };
 
+    // Resource content that was saved by SaveResourceState(), in the format of the state snapshot upload commands.
+    struct ResourceSnapshot
+    {
+        format::HandleId      device_id{ format::kNullHandleId };
+        format::HandleId      resource_id{ format::kNullHandleId };
+        VkImageAspectFlagBits aspect{};
+        VkImageLayout         layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+        std::vector<uint64_t> level_sizes;
+        std::vector<uint8_t>  data;
+    };
+
     typedef std::unordered_map<uint64_t, HardwareBufferInfo>               HardwareBufferMap;
     typedef std::unordered_map<format::HandleId, HardwareBufferMemoryInfo> HardwareBufferMemoryMap;
 
@@ -1628,6 +1727,8 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::unique_ptr<VulkanSwapchain>                                           swapchain_;
     std::string                                                                screenshot_file_prefix_;
     graphics::FpsInfo*                                                         fps_info_;
+    std::unique_ptr<VulkanGpuFrameTimer>                                       gpu_frame_timer_;
+    std::unique_ptr<VulkanPersistentPipelineCache>                             persistent_pipeline_cache_;
 
     std::unordered_map<const decode::VulkanDeviceInfo*, decode::VulkanDeviceAddressTracker> _device_address_trackers;
     std::unordered_map<const decode::VulkanDeviceInfo*, decode::VulkanAddressReplacer>      _device_address_replacers;
@@ -1635,6 +1736,23 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     util::ThreadPool main_thread_queue_;
     util::ThreadPool background_queue_;
 
+    bool                                   record_compile_times_{ false };
+    std::mutex                             compile_times_mutex_;
+    std::vector<VulkanPipelineCompileTime> compile_times_;
+
+    std::vector<ResourceSnapshot> buffer_snapshots_;
+    std::vector<ResourceSnapshot> image_snapshots_;
+
+    // The objects created and destroyed by the looped frame range, which are tracked from SaveResourceState() on.
+    format::HandleId                     max_object_id_{ format::kNullHandleId };
+    bool                                 track_loop_range_objects_{ false };
+    format::HandleId                     loop_range_first_object_id_{ format::kNullHandleId };
+    std::unordered_set<format::HandleId> loop_range_created_objects_;
+    bool                                 loop_range_destroyed_objects_{ false };
+
+    VulkanCreateInfoDeduplicator<VkShaderModule> shader_module_deduplicator_;
+    VulkanCreateInfoDeduplicator<VkPipeline>     pipeline_deduplicator_;
+
     //! async_tracked_handle_asset_t groups assets used by tracked async-dependencies
     struct async_tracked_handle_asset_t
     {
@@ -1686,15 +1804,6 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     //       the initial cache data has no corresponding replay time cache data.
     bool omitted_pipeline_cache_data_;
 
-    // Temporary data used by pipeline cache data handling
-    // The following capture time data used for calling VisitPipelineCacheInfo as input parameters
-    // , replay time data used as output result.
-    uint32_t             capture_pipeline_cache_data_hash_ = 0;
-    uint32_t             capture_pipeline_cache_data_size_ = 0;
-    void*                capture_pipeline_cache_data_;
-    bool                 matched_replay_cache_data_exist_ = false;
-    std::vector<uint8_t> matched_replay_cache_data_;
-
     std::unordered_map<format::HandleId, std::pair<const VulkanDeviceInfo*, VkPipelineCache>> tracked_pipeline_caches_;
     std::unordered_map<VkPipeline, format::HandleId> pipeline_cache_correspondances_;
 };
@@ -100,6 +100,12 @@ const char* ImageFileExtension(DumpedImageFormat image_format)
         case KFormatPNG:
             return ".png";
 
+        case KFormatQOI:
+            return ".qoi";
+
+        case KFormatZSTD:
+            return ".zst";
+
         case KFormatRaw:
         default:
             return ".bin";
@@ -624,6 +630,54 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                                                              vkuFormatHasAlpha(image_info->format));
                         }
                     }
+                    else if (output_image_format == KFormatQOI)
+                    {
+                        if (dump_separate_alpha)
+                        {
+                            util::imagewriter::WriteQoiImageSeparateAlpha(filename,
+                                                                          scaled_extent.width,
+                                                                          scaled_extent.height,
+                                                                          subresource_sizes[0],
+                                                                          offsetted_data,
+                                                                          stride,
+                                                                          image_writer_format);
+                        }
+                        else
+                        {
+                            util::imagewriter::WriteQoiImage(filename,
+                                                             scaled_extent.width,
+                                                             scaled_extent.height,
+                                                             subresource_sizes[0],
+                                                             offsetted_data,
+                                                             stride,
+                                                             image_writer_format,
+                                                             vkuFormatHasAlpha(image_info->format));
+                        }
+                    }
+                    else if (output_image_format == KFormatZSTD)
+                    {
+                        if (dump_separate_alpha)
+                        {
+                            util::imagewriter::WriteZstdImageSeparateAlpha(filename,
+                                                                           scaled_extent.width,
+                                                                           scaled_extent.height,
+                                                                           subresource_sizes[0],
+                                                                           offsetted_data,
+                                                                           stride,
+                                                                           image_writer_format);
+                        }
+                        else
+                        {
+                            util::imagewriter::WriteZstdImage(filename,
+                                                              scaled_extent.width,
+                                                              scaled_extent.height,
+                                                              subresource_sizes[0],
+                                                              offsetted_data,
+                                                              stride,
+                                                              image_writer_format,
+                                                              vkuFormatHasAlpha(image_info->format));
+                        }
+                    }
                 }
                 else
                 {
@@ -867,6 +921,12 @@ DumpedImageFormat GetDumpedImageFormat(const VulkanDeviceInfo*            device
         case util::ScreenshotFormat::kPng:
             return KFormatPNG;
 
+        case util::ScreenshotFormat::kQoi:
+            return KFormatQOI;
+
+        case util::ScreenshotFormat::kZstd:
+            return KFormatZSTD;
+
         default:
             assert(0);
             return KFormatRaw;
@@ -62,6 +62,8 @@ enum DumpedImageFormat
 {
     kFormatBMP,
     KFormatPNG,
+    KFormatQOI,
+    KFormatZSTD,
     KFormatRaw
 };
 
@@ -95,11 +95,16 @@ struct VulkanReplayOptions : public ReplayOptions
     bool  dump_resources_dump_raw_images{ false };
     bool  dump_resources_dump_separate_alpha{ false };
 
-    bool preload_measurement_range{ false };
+    bool     preload_measurement_range{ false };
+    uint32_t measurement_range_loop_count{ 1 };
+    bool     precompile_pipelines{ false };
+    bool     detailed_frame_timing{ false };
+    bool     deduplicate_pipelines{ false };
 
     std::string load_pipeline_cache_filename;
     std::string save_pipeline_cache_filename;
     bool        add_new_pipeline_caches;
+    std::string pipeline_cache_dir;
 };
 
 GFXRECON_END_NAMESPACE(decode)
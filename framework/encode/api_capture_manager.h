@@ -89,6 +89,18 @@ class ApiCaptureManager
     {
         return common_manager_->BeginApiCallCapture(call_id);
     }
+    ParameterEncoder* BeginTrackedCommandApiCallCapture(format::ApiCallId call_id)
+    {
+        return common_manager_->BeginTrackedCommandApiCallCapture(call_id);
+    }
+    FixedParameterEncoder* BeginTrackedFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size)
+    {
+        return common_manager_->BeginTrackedFixedApiCallCapture(call_id, parameter_size);
+    }
+    FixedParameterEncoder* BeginFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size)
+    {
+        return common_manager_->BeginFixedApiCallCapture(call_id, parameter_size);
+    }
     ParameterEncoder* BeginTrackedMethodCallCapture(format::ApiCallId call_id, format::HandleId object_id)
     {
         return common_manager_->BeginTrackedMethodCallCapture(call_id, object_id);
@@ -201,6 +213,15 @@ class ApiCaptureManager
     {
         common_manager_->WriteFillMemoryCmd(api_family_, memory_id, offset, size, data);
     }
+    CommandRecordingCache* GetCommandRecordingCache() { return common_manager_->GetCommandRecordingCache(); }
+    void                   AppendToCommandRecording(std::vector<uint8_t>* recording)
+    {
+        common_manager_->AppendToCommandRecording(recording);
+    }
+    void WriteCommandBufferRecording(format::HandleId command_buffer_id, const std::vector<uint8_t>& recording)
+    {
+        common_manager_->WriteCommandBufferRecording(api_family_, command_buffer_id, recording);
+    }
     void WriteCreateHeapAllocationCmd(uint64_t allocation_id, uint64_t allocation_size)
     {
         common_manager_->WriteCreateHeapAllocationCmd(api_family_, allocation_id, allocation_size);
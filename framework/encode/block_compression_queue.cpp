@@ -0,0 +1,405 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/block_compression_queue.h"
+
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Buffers of blocks returned to the free list are released when they grew larger than this, so that an occasional large
+// block does not keep its memory for the rest of the capture.
+static const size_t kMaxRecycledBufferSize = 4 * 1024 * 1024;
+
+BlockCompressionQueue::BlockCompressionQueue(util::Compressor* compressor,
+                                             uint32_t          thread_count,
+                                             size_t            max_pending_bytes,
+                                             WriteFunction     write_function) :
+    compressor_(compressor),
+    max_pending_bytes_(max_pending_bytes), write_function_(std::move(write_function)), pending_bytes_(0),
+    writing_(false), running_(true)
+{
+    assert((compressor_ != nullptr) && (thread_count > 0) && write_function_);
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        compress_threads_.emplace_back(&BlockCompressionQueue::CompressThreadMain, this);
+    }
+
+    write_thread_ = std::thread(&BlockCompressionQueue::WriteThreadMain, this);
+}
+
+BlockCompressionQueue::~BlockCompressionQueue()
+{
+    Flush();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+
+    compress_condition_.notify_all();
+    write_condition_.notify_all();
+
+    for (auto& thread : compress_threads_)
+    {
+        thread.join();
+    }
+
+    write_thread_.join();
+}
+
+void BlockCompressionQueue::QueueFunctionCall(format::ApiCallId call_id,
+                                              format::ThreadId  thread_id,
+                                              const uint8_t*    data,
+                                              size_t            size)
+{
+    // Reserve space for the larger, compressed header, which is also used as the location of the uncompressed header.
+    const size_t header_size = sizeof(format::CompressedFunctionCallHeader);
+    Block*       block       = AcquireBlock(header_size + size);
+
+    block->kind        = BlockKind::kFunctionCall;
+    block->call_id     = call_id;
+    block->thread_id   = thread_id;
+    block->header_size = header_size;
+    util::platform::MemoryCopy(block->input.data() + header_size, size, data, size);
+
+    SubmitBlock(block);
+}
+
+void BlockCompressionQueue::QueueMethodCall(format::ApiCallId call_id,
+                                            format::HandleId  object_id,
+                                            format::ThreadId  thread_id,
+                                            const uint8_t*    data,
+                                            size_t            size)
+{
+    const size_t header_size = sizeof(format::CompressedMethodCallHeader);
+    Block*       block       = AcquireBlock(header_size + size);
+
+    block->kind        = BlockKind::kMethodCall;
+    block->call_id     = call_id;
+    block->object_id   = object_id;
+    block->thread_id   = thread_id;
+    block->header_size = header_size;
+    util::platform::MemoryCopy(block->input.data() + header_size, size, data, size);
+
+    SubmitBlock(block);
+}
+
+void BlockCompressionQueue::QueueMetaDataBlock(const void* header, size_t header_size, const uint8_t* data, size_t size)
+{
+    assert(header_size >= sizeof(format::BlockHeader));
+
+    Block* block = AcquireBlock(header_size + size);
+
+    block->kind        = BlockKind::kMetaData;
+    block->header_size = header_size;
+    util::platform::MemoryCopy(block->input.data(), header_size, header, header_size);
+    util::platform::MemoryCopy(block->input.data() + header_size, size, data, size);
+
+    SubmitBlock(block);
+}
+
+void BlockCompressionQueue::QueueBlock(const std::pair<const void*, size_t>* parts, size_t part_count)
+{
+    size_t size = 0;
+    for (size_t i = 0; i < part_count; ++i)
+    {
+        size += parts[i].second;
+    }
+
+    Block*   block  = AcquireBlock(size);
+    uint8_t* output = block->input.data();
+
+    block->kind = BlockKind::kRaw;
+
+    for (size_t i = 0; i < part_count; ++i)
+    {
+        util::platform::MemoryCopy(output, parts[i].second, parts[i].first, parts[i].second);
+        output += parts[i].second;
+    }
+
+    SubmitBlock(block);
+}
+
+void BlockCompressionQueue::Flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_condition_.wait(lock, [this]() { return write_queue_.empty() && !writing_; });
+}
+
+BlockCompressionQueue::Block* BlockCompressionQueue::AcquireBlock(size_t size)
+{
+    Block* block = nullptr;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // Block the API thread while the queue is over its memory budget. A block that is larger than the budget is
+        // accepted when the queue is empty.
+        space_condition_.wait(
+            lock, [this, size]() { return (pending_bytes_ == 0) || ((pending_bytes_ + size) <= max_pending_bytes_); });
+
+        pending_bytes_ += size;
+
+        if (free_blocks_.empty())
+        {
+            blocks_.emplace_back(std::make_unique<Block>());
+            block = blocks_.back().get();
+        }
+        else
+        {
+            block = free_blocks_.back();
+            free_blocks_.pop_back();
+        }
+    }
+
+    block->pending_size = size;
+    block->input.resize(size);
+
+    return block;
+}
+
+void BlockCompressionQueue::SubmitBlock(Block* block)
+{
+    bool compress = (block->kind != BlockKind::kRaw);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        block->ready = !compress;
+        write_queue_.push_back(block);
+
+        if (compress)
+        {
+            compress_queue_.push_back(block);
+        }
+    }
+
+    if (compress)
+    {
+        compress_condition_.notify_one();
+    }
+    else
+    {
+        write_condition_.notify_one();
+    }
+}
+
+void BlockCompressionQueue::ReleaseBlock(Block* block)
+{
+    block->kind       = BlockKind::kRaw;
+    block->ready      = false;
+    block->compressed = false;
+
+    if (block->input.capacity() > kMaxRecycledBufferSize)
+    {
+        std::vector<uint8_t>().swap(block->input);
+    }
+
+    if (block->output.capacity() > kMaxRecycledBufferSize)
+    {
+        std::vector<uint8_t>().swap(block->output);
+    }
+
+    free_blocks_.push_back(block);
+}
+
+void BlockCompressionQueue::CompressBlock(Block* block)
+{
+    const size_t   header_size       = block->header_size;
+    const size_t   uncompressed_size = block->input.size() - header_size;
+    const uint8_t* uncompressed_data = block->input.data() + header_size;
+    size_t         compressed_size   = 0;
+
+    if (uncompressed_size > 0)
+    {
+        compressed_size = compressor_->Compress(uncompressed_size, uncompressed_data, &block->output, header_size);
+    }
+
+    block->compressed = (compressed_size > 0) && (compressed_size < uncompressed_size);
+
+    if (block->kind == BlockKind::kFunctionCall)
+    {
+        if (block->compressed)
+        {
+            auto header               = reinterpret_cast<format::CompressedFunctionCallHeader*>(block->output.data());
+            header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            header->api_call_id       = block->call_id;
+            header->thread_id         = block->thread_id;
+            header->uncompressed_size = uncompressed_size;
+            header->block_header.size = sizeof(header->api_call_id) + sizeof(header->thread_id) +
+                                        sizeof(header->uncompressed_size) + compressed_size;
+        }
+        else
+        {
+            // The uncompressed header is smaller than the reserved space, and is placed immediately before the data.
+            auto header = reinterpret_cast<format::FunctionCallHeader*>(
+                block->input.data() + (header_size - sizeof(format::FunctionCallHeader)));
+            header->block_header.type = format::BlockType::kFunctionCallBlock;
+            header->api_call_id       = block->call_id;
+            header->thread_id         = block->thread_id;
+            header->block_header.size = sizeof(header->api_call_id) + sizeof(header->thread_id) + uncompressed_size;
+        }
+    }
+    else if (block->kind == BlockKind::kMethodCall)
+    {
+        if (block->compressed)
+        {
+            auto header               = reinterpret_cast<format::CompressedMethodCallHeader*>(block->output.data());
+            header->block_header.type = format::BlockType::kCompressedMethodCallBlock;
+            header->api_call_id       = block->call_id;
+            header->object_id         = block->object_id;
+            header->thread_id         = block->thread_id;
+            header->uncompressed_size = uncompressed_size;
+            header->block_header.size = sizeof(header->api_call_id) + sizeof(header->object_id) +
+                                        sizeof(header->uncompressed_size) + sizeof(header->thread_id) +
+                                        compressed_size;
+        }
+        else
+        {
+            auto header = reinterpret_cast<format::MethodCallHeader*>(
+                block->input.data() + (header_size - sizeof(format::MethodCallHeader)));
+            header->block_header.type = format::BlockType::kMethodCallBlock;
+            header->api_call_id       = block->call_id;
+            header->object_id         = block->object_id;
+            header->thread_id         = block->thread_id;
+            header->block_header.size = sizeof(header->api_call_id) + sizeof(header->object_id) +
+                                        sizeof(header->thread_id) + uncompressed_size;
+        }
+    }
+    else
+    {
+        assert(block->kind == BlockKind::kMetaData);
+
+        auto header  = reinterpret_cast<format::BlockHeader*>(block->input.data());
+        header->size = (header_size - sizeof(format::BlockHeader)) + uncompressed_size;
+
+        if (block->compressed)
+        {
+            header->type = format::BlockType::kCompressedMetaDataBlock;
+            header->size = (header_size - sizeof(format::BlockHeader)) + compressed_size;
+            util::platform::MemoryCopy(block->output.data(), header_size, block->input.data(), header_size);
+        }
+    }
+
+    if (block->compressed)
+    {
+        block->output.resize(header_size + compressed_size);
+    }
+}
+
+void BlockCompressionQueue::CompressThreadMain()
+{
+    for (;;)
+    {
+        Block* block = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            compress_condition_.wait(lock, [this]() { return !compress_queue_.empty() || !running_; });
+
+            if (compress_queue_.empty())
+            {
+                return;
+            }
+
+            block = compress_queue_.front();
+            compress_queue_.pop_front();
+        }
+
+        CompressBlock(block);
+
+        bool is_next = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            block->ready = true;
+            is_next      = (write_queue_.front() == block);
+        }
+
+        if (is_next)
+        {
+            write_condition_.notify_one();
+        }
+    }
+}
+
+void BlockCompressionQueue::WriteThreadMain()
+{
+    for (;;)
+    {
+        Block* block = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            write_condition_.wait(
+                lock, [this]() { return (!write_queue_.empty() && write_queue_.front()->ready) || !running_; });
+
+            if (write_queue_.empty() || !write_queue_.front()->ready)
+            {
+                // Only reached on shutdown, which happens after the queue was flushed.
+                return;
+            }
+
+            block = write_queue_.front();
+            write_queue_.pop_front();
+            writing_ = true;
+        }
+
+        if (block->compressed)
+        {
+            write_function_(block->output.data(), block->output.size());
+        }
+        else
+        {
+            size_t offset = 0;
+
+            if (block->kind == BlockKind::kFunctionCall)
+            {
+                offset = block->header_size - sizeof(format::FunctionCallHeader);
+            }
+            else if (block->kind == BlockKind::kMethodCall)
+            {
+                offset = block->header_size - sizeof(format::MethodCallHeader);
+            }
+
+            write_function_(block->input.data() + offset, block->input.size() - offset);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_bytes_ -= block->pending_size;
+            writing_ = false;
+            ReleaseBlock(block);
+        }
+
+        space_condition_.notify_all();
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,138 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
+#define GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Moves block compression off of the API threads. Queued blocks are copied to a recycled buffer, compressed by a pool
+// of worker threads, and passed to the write function by a dedicated writer thread in the order they were queued.
+// Blocks that are not compressed, such as meta data commands without a payload, must also be queued to preserve the
+// block order of the capture file.
+class BlockCompressionQueue
+{
+  public:
+    typedef std::function<void(const void* data, size_t size)> WriteFunction;
+
+    BlockCompressionQueue(util::Compressor* compressor,
+                          uint32_t          thread_count,
+                          size_t            max_pending_bytes,
+                          WriteFunction     write_function);
+
+    ~BlockCompressionQueue();
+
+    // Queues a function call block for the encoded parameter data.
+    void QueueFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, const uint8_t* data, size_t size);
+
+    // Queues a method call block for the encoded parameter data.
+    void QueueMethodCall(format::ApiCallId call_id,
+                         format::HandleId  object_id,
+                         format::ThreadId  thread_id,
+                         const uint8_t*    data,
+                         size_t            size);
+
+    // Queues a meta data block with a payload that is compressed when possible. The header must start with a
+    // format::BlockHeader, which is updated with the final block size and type, and must store the uncompressed size
+    // of the payload.
+    void QueueMetaDataBlock(const void* header, size_t header_size, const uint8_t* data, size_t size);
+
+    // Queues a block that is written without modification. The data may be provided in multiple parts.
+    void QueueBlock(const std::pair<const void*, size_t>* parts, size_t part_count);
+
+    // Waits for all queued blocks to be written.
+    void Flush();
+
+  private:
+    enum class BlockKind
+    {
+        kRaw,
+        kFunctionCall,
+        kMethodCall,
+        kMetaData
+    };
+
+    struct Block
+    {
+        BlockKind            kind{ BlockKind::kRaw };
+        format::ApiCallId    call_id{ format::ApiCallId::ApiCall_Unknown };
+        format::HandleId     object_id{ format::kNullHandleId };
+        format::ThreadId     thread_id{ 0 };
+        size_t               header_size{ 0 };
+        size_t               pending_size{ 0 };
+        bool                 ready{ false };
+        bool                 compressed{ false };
+        std::vector<uint8_t> input;
+        std::vector<uint8_t> output;
+    };
+
+    Block* AcquireBlock(size_t size);
+
+    void SubmitBlock(Block* block);
+
+    void ReleaseBlock(Block* block);
+
+    void CompressBlock(Block* block);
+
+    void CompressThreadMain();
+
+    void WriteThreadMain();
+
+  private:
+    util::Compressor*        compressor_;
+    size_t                   max_pending_bytes_;
+    WriteFunction            write_function_;
+    std::vector<std::thread> compress_threads_;
+    std::thread              write_thread_;
+
+    std::mutex                          mutex_;
+    std::condition_variable             compress_condition_;
+    std::condition_variable             write_condition_;
+    std::condition_variable             space_condition_;
+    std::deque<Block*>                  write_queue_;
+    std::deque<Block*>                  compress_queue_;
+    std::vector<std::unique_ptr<Block>> blocks_;
+    std::vector<Block*>                 free_blocks_;
+    size_t                              pending_bytes_;
+    bool                                writing_;
+    bool                                running_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
@@ -35,15 +35,26 @@
 #include "util/compressor.h"
 #include "util/file_path.h"
 #include "util/date_time.h"
+#include "util/direct_file_output_stream.h"
 #include "util/driver_info.h"
 #include "util/logging.h"
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <climits>
 #include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
 #include <unordered_map>
 
+#if defined(WIN32)
+#include <io.h>
+#include <sys/stat.h>
+#endif
+
 #if defined(__unix__)
 extern char** environ;
 #endif
@@ -55,6 +66,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const uint32_t kFirstFrame           = 1;
 const size_t   kFileStreamBufferSize = 256 * 1024;
 
+// Size of each of the two buffers of the direct I/O capture file stream.
+const size_t kDirectFileStreamBufferSize = 4 * 1024 * 1024;
+
+// Memory budget for the command buffer recordings that are kept for deduplication.
+const size_t kCommandRecordingCacheSize = 64 * 1024 * 1024;
+
 std::mutex                                     CommonCaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CommonCaptureManager::ThreadData::thread_count_ = 0;
 std::unordered_map<uint64_t, format::ThreadId> CommonCaptureManager::ThreadData::id_map_;
@@ -66,6 +83,187 @@ CommonCaptureManager::ApiCallMutexT                            CommonCaptureMana
 
 std::atomic<format::HandleId> CommonCaptureManager::unique_id_counter_{ format::kNullHandleId };
 
+// Writes data to a file descriptor without buffering or memory allocation, so that it can be called from a signal
+// handler.
+static bool WriteToFileDescriptor(int fd, const void* data, size_t size)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    while (size > 0)
+    {
+#if defined(WIN32)
+        int written = _write(fd, bytes, static_cast<unsigned int>(std::min<size_t>(size, INT_MAX)));
+#else
+        ssize_t written = write(fd, bytes, size);
+        if ((written < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+#endif
+        if (written <= 0)
+        {
+            return false;
+        }
+
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+
+// Output stream for the fatal error handlers, which only calls functions that are async-signal-safe.
+class CrashFileOutputStream : public util::OutputStream
+{
+  public:
+    explicit CrashFileOutputStream(const char* filename)
+    {
+#if defined(WIN32)
+        fd_ = _open(filename, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        fd_ = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    }
+
+    virtual ~CrashFileOutputStream() override
+    {
+        if (fd_ >= 0)
+        {
+#if defined(WIN32)
+            _close(fd_);
+#else
+            close(fd_);
+#endif
+        }
+    }
+
+    virtual bool IsValid() override { return (fd_ >= 0); }
+
+    virtual bool Write(const void* data, size_t len) override { return WriteToFileDescriptor(fd_, data, len); }
+
+  private:
+    int fd_{ -1 };
+};
+
+// Fatal error handlers for the flight recorder, which write the recorded frames to a file and then pass the error on to
+// the handler that was installed before them.
+#if defined(WIN32)
+static LPTOP_LEVEL_EXCEPTION_FILTER s_previous_exception_filter = nullptr;
+static bool                         s_crash_handlers_installed  = false;
+
+static LONG WINAPI FlightRecorderExceptionFilter(EXCEPTION_POINTERS* exception_info)
+{
+    CommonCaptureManager::WriteFlightRecordingAfterCrash();
+
+    if (s_previous_exception_filter != nullptr)
+    {
+        return s_previous_exception_filter(exception_info);
+    }
+
+    return EXCEPTION_CONTINUE_SEARCH;
+}
+
+static void InstallFlightRecorderCrashHandlers()
+{
+    s_previous_exception_filter = SetUnhandledExceptionFilter(FlightRecorderExceptionFilter);
+    s_crash_handlers_installed  = true;
+}
+
+static void RemoveFlightRecorderCrashHandlers()
+{
+    if (s_crash_handlers_installed)
+    {
+        SetUnhandledExceptionFilter(s_previous_exception_filter);
+        s_crash_handlers_installed = false;
+    }
+}
+#else
+static constexpr int    kFlightRecorderSignals[]   = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+static constexpr size_t kFlightRecorderSignalCount = sizeof(kFlightRecorderSignals) / sizeof(int);
+
+static struct sigaction s_previous_signal_actions[kFlightRecorderSignalCount] = {};
+static bool             s_crash_handlers_installed                            = false;
+
+static void FlightRecorderSignalHandler(int id, siginfo_t* info, void* data)
+{
+    int saved_errno = errno;
+    CommonCaptureManager::WriteFlightRecordingAfterCrash();
+    errno = saved_errno;
+
+    const struct sigaction* previous_action = nullptr;
+    for (size_t i = 0; i < kFlightRecorderSignalCount; ++i)
+    {
+        if (kFlightRecorderSignals[i] == id)
+        {
+            previous_action = &s_previous_signal_actions[i];
+        }
+    }
+
+    // Restore the previous handler, so that the signal is delivered to it directly if it is raised again.
+    if (previous_action != nullptr)
+    {
+        sigaction(id, previous_action, nullptr);
+
+        // Pass the signal on to the previous handler with its original arguments.
+        if ((previous_action->sa_flags & SA_SIGINFO) != 0)
+        {
+            if (previous_action->sa_sigaction != nullptr)
+            {
+                previous_action->sa_sigaction(id, info, data);
+                return;
+            }
+        }
+        else if ((previous_action->sa_handler != SIG_DFL) && (previous_action->sa_handler != SIG_IGN))
+        {
+            previous_action->sa_handler(id);
+            return;
+        }
+    }
+
+    // Without a previous handler, terminate the process the same way that it would have without the flight recorder.
+    // Returning re-executes the faulting instruction, which raises the signal again with the default action. Signals
+    // that were sent by a process instead of a fault would not be raised again, so they are raised explicitly.
+    signal(id, SIG_DFL);
+
+    if ((info == nullptr) || (info->si_code <= 0))
+    {
+        raise(id);
+    }
+}
+
+static void InstallFlightRecorderCrashHandlers()
+{
+    struct sigaction action = {};
+    sigemptyset(&action.sa_mask);
+    action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+    action.sa_sigaction = FlightRecorderSignalHandler;
+
+    for (size_t i = 0; i < kFlightRecorderSignalCount; ++i)
+    {
+        if (sigaction(kFlightRecorderSignals[i], &action, &s_previous_signal_actions[i]) != 0)
+        {
+            GFXRECON_LOG_WARNING("Failed to install the flight recorder handler for signal %d (%s)",
+                                 kFlightRecorderSignals[i],
+                                 strerror(errno));
+        }
+    }
+
+    s_crash_handlers_installed = true;
+}
+
+static void RemoveFlightRecorderCrashHandlers()
+{
+    if (s_crash_handlers_installed)
+    {
+        for (size_t i = 0; i < kFlightRecorderSignalCount; ++i)
+        {
+            sigaction(kFlightRecorderSignals[i], &s_previous_signal_actions[i], nullptr);
+        }
+
+        s_crash_handlers_installed = false;
+    }
+}
+#endif
+
 CommonCaptureManager::ThreadData::ThreadData() :
     thread_id_(GetThreadId()), object_id_(format::kNullHandleId), call_id_(format::ApiCallId::ApiCall_Unknown),
     block_index_(0)
@@ -96,7 +294,9 @@ format::ThreadId CommonCaptureManager::ThreadData::GetThreadId()
 }
 
 CommonCaptureManager::CommonCaptureManager() :
-    force_file_flush_(false), timestamp_filename_(true),
+    compression_thread_count_(0), compression_queue_size_(0), segment_size_limit_(0), segment_frame_limit_(0),
+    segment_index_(0), segment_first_frame_(0), force_file_flush_(false), direct_file_io_(false),
+    timestamp_filename_(true),
     memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
     page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false), page_guard_signal_handler_watcher_(false),
     page_guard_memory_mode_(kMemoryModeShadowInternal), page_guard_external_memory_(false), trim_enabled_(false),
@@ -111,12 +311,18 @@ CommonCaptureManager::CommonCaptureManager() :
 
 CommonCaptureManager::~CommonCaptureManager()
 {
+    // Write the blocks that are still queued before the file is closed.
+    compression_queue_ = nullptr;
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
         util::PageGuardManager::Destroy();
     }
 
+    // The page guard handler forwards unhandled signals to the flight recorder handler, so it is removed last.
+    RemoveFlightRecorderCrashHandlers();
+
     util::Log::Release();
 }
 
@@ -299,6 +505,11 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
     timestamp_filename_              = trace_settings.time_stamp_file;
     memory_tracking_mode_            = trace_settings.memory_tracking_mode;
     force_file_flush_                = trace_settings.force_flush;
+    direct_file_io_                  = trace_settings.direct_io;
+    compression_thread_count_        = trace_settings.compression_threads;
+    compression_queue_size_          = static_cast<size_t>(trace_settings.compression_queue_size) * 1024 * 1024;
+    segment_size_limit_              = static_cast<uint64_t>(trace_settings.segment_size) * 1024 * 1024;
+    segment_frame_limit_             = trace_settings.segment_frames;
     debug_layer_                     = trace_settings.debug_layer;
     debug_device_lost_               = trace_settings.debug_device_lost;
     screenshots_enabled_             = !trace_settings.screenshot_ranges.empty();
@@ -377,9 +588,62 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
-    if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
-        trace_settings.trim_boundary != CaptureSettings::TrimBoundary::kDrawCalls &&
-        trace_settings.runtime_capture_trigger == CaptureSettings::RuntimeTriggerState::kNotUsed)
+    if (trace_settings.dedup_command_buffers)
+    {
+        if (trace_settings.flight_recorder_frames > 0)
+        {
+            // A recording that spans a flight recorder checkpoint would be missing from the segment before it.
+            GFXRECON_LOG_WARNING("Ignoring the command buffer deduplication setting, which is not supported by the "
+                                 "flight recorder");
+        }
+        else
+        {
+            command_recording_cache_ = std::make_unique<CommandRecordingCache>(kCommandRecordingCacheSize);
+        }
+    }
+
+    if (trace_settings.flight_recorder_frames > 0)
+    {
+        // The flight recorder captures in write and track mode from the start, but keeps the capture blocks in memory.
+        // The capture trigger requests a capture file for the recorded frames instead of starting a trimmed capture.
+        if (!trace_settings.trim_ranges.empty() ||
+            (trace_settings.trim_boundary == CaptureSettings::TrimBoundary::kDrawCalls))
+        {
+            GFXRECON_LOG_WARNING("Ignoring capture frame, queue submit, and draw call ranges, which are not supported by "
+                                 "the flight recorder");
+        }
+
+        if (use_asset_file_)
+        {
+            GFXRECON_LOG_WARNING("Ignoring the asset file setting, which is not supported by the flight recorder");
+            use_asset_file_ = false;
+        }
+
+        // Trimming is enabled for the resource usage changes that are needed to write state checkpoints. The trim
+        // boundary is left unset, as the capture trigger is handled by CheckFlightRecorder.
+        trim_enabled_                   = true;
+        trim_key_                       = trace_settings.trim_key;
+        previous_runtime_trigger_state_ = trace_settings.runtime_capture_trigger;
+
+        flight_recorder_ = std::make_unique<FlightRecorder>(
+            trace_settings.flight_recorder_frames, trace_settings.flight_recorder_checkpoint_interval, current_frame_);
+        file_stream_  = std::make_unique<FlightRecorderStream>(flight_recorder_.get());
+        capture_mode_ = kModeWriteAndTrack;
+
+        if (trace_settings.flight_recorder_crash_dump)
+        {
+            PrepareFlightRecordingAfterCrash();
+
+            // Installed before the page guard manager, which forwards the signals that it does not handle.
+            InstallFlightRecorderCrashHandlers();
+        }
+
+        GFXRECON_LOG_INFO("Flight recorder is keeping the last %u frames in memory",
+                          trace_settings.flight_recorder_frames);
+    }
+    else if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
+             trace_settings.trim_boundary != CaptureSettings::TrimBoundary::kDrawCalls &&
+             trace_settings.runtime_capture_trigger == CaptureSettings::RuntimeTriggerState::kNotUsed)
     {
         // Use default kModeWrite capture mode.
         success = CreateCaptureFile(api_family, base_filename_);
@@ -465,6 +729,16 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         {
             success = false;
         }
+        else if ((compressor_ != nullptr) && (compression_thread_count_ > 0))
+        {
+            compression_queue_ = std::make_unique<BlockCompressionQueue>(
+                compressor_.get(),
+                compression_thread_count_,
+                compression_queue_size_,
+                [this](const void* data, size_t size) { WriteToStream(data, size, file_stream_.get()); });
+
+            GFXRECON_LOG_INFO("Compressing capture file blocks on %u worker threads", compression_thread_count_);
+        }
     }
 
     if (success)
@@ -512,17 +786,31 @@ bool CommonCaptureManager::IsCaptureModeWrite() const
     return (GetCaptureMode() & kModeWrite) == kModeWrite;
 }
 
-ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId call_id)
+ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId call_id, bool omit_addresses)
 {
     auto thread_data      = GetThreadData();
     thread_data->call_id_ = call_id;
 
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
+    thread_data->parameter_encoder_->SetOmitAddresses(omit_addresses);
 
     return thread_data->parameter_encoder_.get();
 }
 
+FixedParameterEncoder* CommonCaptureManager::InitFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size)
+{
+    auto thread_data      = GetThreadData();
+    thread_data->call_id_ = call_id;
+
+    // Reserve space for an uncompressed FunctionCallHeader and the parameter data with a single buffer resize.
+    thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
+    thread_data->fixed_parameter_encoder_.Reset(thread_data->parameter_buffer_->ReserveData(parameter_size),
+                                                parameter_size);
+
+    return &thread_data->fixed_parameter_encoder_;
+}
+
 ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId call_id, format::HandleId object_id)
 {
     auto thread_data        = GetThreadData();
@@ -531,6 +819,7 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
 
     // Reset the parameter buffer and reserve space for an uncompressed MethodCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::MethodCallHeader));
+    thread_data->parameter_encoder_->SetOmitAddresses(false);
 
     return thread_data->parameter_encoder_.get();
 }
@@ -548,6 +837,15 @@ void CommonCaptureManager::EndApiCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
+        if (compression_queue_ != nullptr)
+        {
+            // Only copy the parameter data; compression and the file write happen on the queue's threads.
+            compression_queue_->QueueFunctionCall(
+                thread_data->call_id_, thread_data->thread_id_, parameter_buffer->GetData(), uncompressed_size);
+            IncrementBlockIndex(1);
+            return;
+        }
+
         if (compressor_ != nullptr)
         {
             size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
@@ -604,6 +902,17 @@ void CommonCaptureManager::EndMethodCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
+        if (compression_queue_ != nullptr)
+        {
+            compression_queue_->QueueMethodCall(thread_data->call_id_,
+                                                thread_data->object_id_,
+                                                thread_data->thread_id_,
+                                                parameter_buffer->GetData(),
+                                                uncompressed_size);
+            IncrementBlockIndex(1);
+            return;
+        }
+
         if (compressor_ != nullptr)
         {
             size_t header_size     = sizeof(format::CompressedMethodCallHeader);
@@ -734,7 +1043,8 @@ void CommonCaptureManager::CheckContinueCaptureForWriteMode(format::ApiFamilyId
                 {
                     manager_it.first->DestroyStateTracker();
                 }
-                compressor_ = nullptr;
+                compression_queue_ = nullptr;
+                compressor_        = nullptr;
             }
             else if (trim_ranges_[trim_current_range_].first == current_boundary_count)
             {
@@ -784,7 +1094,8 @@ void CommonCaptureManager::DeactivateTrimmingDrawCalls(std::shared_lock<ApiCallM
             {
                 manager_it.first->DestroyStateTracker();
             }
-            compressor_ = nullptr;
+            compression_queue_ = nullptr;
+            compressor_        = nullptr;
         }
     }
 }
@@ -934,6 +1245,15 @@ void CommonCaptureManager::EndFrame(format::ApiFamilyId api_family, std::shared_
             CheckStartCaptureForTrackMode(api_family, current_frame_, current_lock);
         }
     }
+    else if (flight_recorder_ != nullptr)
+    {
+        CheckFlightRecorder(api_family, current_lock);
+    }
+
+    if ((segment_size_limit_ > 0) || (segment_frame_limit_ > 0))
+    {
+        CheckCaptureFileSegment(api_family, current_lock);
+    }
 
     // Flush after presents to help avoid capture files with incomplete final blocks.
     if (file_stream_.get() != nullptr)
@@ -1074,17 +1394,43 @@ std::string CommonCaptureManager::CreateAssetFilename(const std::string& base_fi
     return asset_filename;
 }
 
+std::unique_ptr<util::FileOutputStream> CommonCaptureManager::CreateCaptureFileStream(const std::string& filename) const
+{
+    if (direct_file_io_)
+    {
+        std::unique_ptr<util::FileOutputStream> direct_stream =
+            std::make_unique<util::DirectFileOutputStream>(filename, kDirectFileStreamBufferSize, force_file_flush_);
+        if (direct_stream->IsValid())
+        {
+            return direct_stream;
+        }
+
+        GFXRECON_LOG_WARNING("Failed to open %s for direct I/O; using buffered file I/O", filename.c_str());
+    }
+
+    return std::make_unique<util::FileOutputStream>(filename, kFileStreamBufferSize);
+}
+
 bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, const std::string& base_filename)
 {
     bool success      = true;
     capture_filename_ = base_filename;
 
+    // Blocks for the previous file must be written before it is replaced.
+    FlushCompressionQueue();
+
+    if (command_recording_cache_ != nullptr)
+    {
+        // Recordings can only be referenced from the file that contains them.
+        command_recording_cache_->Clear();
+    }
+
     if (timestamp_filename_)
     {
         capture_filename_ = util::filepath::GenerateTimestampedFilename(capture_filename_);
     }
 
-    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename_, kFileStreamBufferSize);
+    file_stream_ = CreateCaptureFileStream(capture_filename_);
 
     if (file_stream_->IsValid())
     {
@@ -1198,6 +1544,16 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
             // Write to file
             CombineAndWriteToFile({ { &env_block, sizeof(env_block) }, { env_vars.c_str(), env_vars.size() } });
         }
+
+        if (((segment_size_limit_ > 0) || (segment_frame_limit_ > 0)) && (flight_recorder_ == nullptr))
+        {
+            // The new file is the first segment of a segmented capture. Later segments are named after it.
+            segment_base_filename_ = capture_filename_;
+            segment_index_         = 0;
+            segment_first_frame_   = current_frame_;
+
+            WriteNextSegmentAnnotation(nullptr);
+        }
     }
     else
     {
@@ -1226,6 +1582,9 @@ void CommonCaptureManager::ActivateTrimming(std::shared_lock<ApiCallMutexT>& cur
 
         capture_mode_ |= kModeWrite;
 
+        // The state writers write to the file stream directly, after the blocks that are already queued.
+        FlushCompressionQueue();
+
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
         if (use_asset_file_)
@@ -1270,6 +1629,8 @@ void CommonCaptureManager::DeactivateTrimming(std::shared_lock<ApiCallMutexT>& c
 
         capture_mode_ &= ~kModeWrite;
 
+        FlushCompressionQueue();
+
         assert(file_stream_);
         file_stream_->Flush();
         file_stream_ = nullptr;
@@ -1281,6 +1642,307 @@ void CommonCaptureManager::DeactivateTrimming(std::shared_lock<ApiCallMutexT>& c
     }
 }
 
+void CommonCaptureManager::CheckFlightRecorder(format::ApiFamilyId              api_family,
+                                               std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    if ((!trim_key_.empty() && IsTrimHotkeyPressed()) ||
+        ((previous_runtime_trigger_state_ != CaptureSettings::RuntimeTriggerState::kNotUsed) &&
+         RuntimeTriggerEnabled()))
+    {
+        WriteFlightRecording(api_family, current_lock);
+    }
+
+    if (flight_recorder_->IsCheckpointDue(current_frame_))
+    {
+        WriteFlightRecorderCheckpoint(current_lock);
+    }
+}
+
+void CommonCaptureManager::WriteFlightRecorderCheckpoint(std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    auto has_shared_lock = current_lock.owns_lock();
+    if (has_shared_lock)
+    {
+        current_lock.unlock();
+    }
+
+    {
+        auto exclusive_api_call_lock = std::unique_lock<CommonCaptureManager::ApiCallMutexT>{};
+        if (!GetForceCommandSerialization())
+        {
+            // If command serialization is active, the caller already holds the exclusive lock.
+            exclusive_api_call_lock = AcquireExclusiveApiCallLock();
+        }
+
+        // The checkpoint must follow the blocks that were captured before it.
+        FlushCompressionQueue();
+
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        flight_recorder_->BeginCheckpoint(current_frame_);
+
+        for (auto& manager : api_capture_managers_)
+        {
+            manager.first->WriteTrackedState(file_stream_.get(), thread_data->thread_id_);
+        }
+
+        flight_recorder_->EndCheckpoint();
+    }
+
+    if (has_shared_lock)
+    {
+        current_lock.lock();
+    }
+}
+
+void CommonCaptureManager::WriteFlightRecording(format::ApiFamilyId              api_family,
+                                                std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    auto has_shared_lock = current_lock.owns_lock();
+    if (has_shared_lock)
+    {
+        current_lock.unlock();
+    }
+
+    {
+        auto exclusive_api_call_lock = std::unique_lock<CommonCaptureManager::ApiCallMutexT>{};
+        if (!GetForceCommandSerialization())
+        {
+            // If command serialization is active, the caller already holds the exclusive lock.
+            exclusive_api_call_lock = AcquireExclusiveApiCallLock();
+        }
+
+        FlushCompressionQueue();
+
+        std::string range_string = "_flight_recorder_frames_" + std::to_string(flight_recorder_->GetFirstFrame()) +
+                                   "_through_" + std::to_string(current_frame_ - 1);
+
+        // Swap the capture file in for the recorder stream while the recording is written, so that the file starts
+        // with the same header and capture information blocks as a regular capture file.
+        std::unique_ptr<util::FileOutputStream> recorder_stream = std::move(file_stream_);
+
+        if (CreateCaptureFile(api_family, util::filepath::InsertFilenamePostfix(base_filename_, range_string)))
+        {
+            FlushCompressionQueue();
+
+            if (flight_recorder_->WriteRecording(file_stream_.get()))
+            {
+                GFXRECON_LOG_INFO("Finished writing flight recorder capture");
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Failed to write flight recorder capture file %s", capture_filename_.c_str());
+            }
+
+            file_stream_->Flush();
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to create flight recorder capture file");
+        }
+
+        file_stream_ = std::move(recorder_stream);
+    }
+
+    if (has_shared_lock)
+    {
+        current_lock.lock();
+    }
+}
+
+void CommonCaptureManager::PrepareFlightRecordingAfterCrash()
+{
+    // The file name is generated when the capture starts, as the time cannot be formatted from a signal handler.
+    crash_filename_ = util::filepath::InsertFilenamePostfix(base_filename_, "_flight_recorder_crash");
+    if (timestamp_filename_)
+    {
+        crash_filename_ = util::filepath::GenerateTimestampedFilename(crash_filename_);
+    }
+
+    std::vector<format::FileOptionPair> option_list;
+    BuildOptionList(file_options_, &option_list);
+
+    format::FileHeader file_header;
+    file_header.fourcc        = GFXRECON_FOURCC;
+    file_header.major_version = 0;
+    file_header.minor_version = 0;
+    file_header.num_options   = static_cast<uint32_t>(option_list.size());
+
+    const size_t options_size = option_list.size() * sizeof(format::FileOptionPair);
+    crash_file_header_.resize(sizeof(file_header) + options_size);
+    util::platform::MemoryCopy(crash_file_header_.data(), sizeof(file_header), &file_header, sizeof(file_header));
+    util::platform::MemoryCopy(
+        crash_file_header_.data() + sizeof(file_header), options_size, option_list.data(), options_size);
+
+    crash_message_ =
+        "[gfxrecon] WARNING - Wrote flight recorder capture to " + crash_filename_ + " after a fatal error\n";
+
+    GFXRECON_LOG_INFO("Flight recorder will write the recorded frames to %s after a fatal error",
+                      crash_filename_.c_str());
+}
+
+void CommonCaptureManager::WriteFlightRecordingAfterCrash()
+{
+    static std::atomic_flag written = ATOMIC_FLAG_INIT;
+
+    if ((singleton_ == nullptr) || (singleton_->flight_recorder_ == nullptr) || singleton_->crash_filename_.empty() ||
+        written.test_and_set())
+    {
+        return;
+    }
+
+    // This can run in a signal handler, so the file name, file header and message were prepared in advance, and the
+    // file is written without memory allocation or locks. The API threads are not stopped, so the recording is written
+    // on a best effort basis.
+    CrashFileOutputStream crash_stream(singleton_->crash_filename_.c_str());
+    if (crash_stream.IsValid() &&
+        crash_stream.Write(singleton_->crash_file_header_.data(), singleton_->crash_file_header_.size()) &&
+        singleton_->flight_recorder_->WriteRecordingAfterCrash(&crash_stream))
+    {
+#if defined(WIN32)
+        const int error_fd = 2;
+#else
+        const int error_fd = STDERR_FILENO;
+#endif
+        WriteToFileDescriptor(error_fd, singleton_->crash_message_.data(), singleton_->crash_message_.size());
+    }
+}
+
+std::string CommonCaptureManager::CreateSegmentFilename(uint32_t segment_index) const
+{
+    const size_t kIndexDigits = 4;
+
+    std::string index_string = std::to_string(segment_index);
+    if (index_string.length() < kIndexDigits)
+    {
+        index_string.insert(0, kIndexDigits - index_string.length(), '0');
+    }
+
+    return util::filepath::InsertFilenamePostfix(segment_base_filename_, "_segment_" + index_string);
+}
+
+void CommonCaptureManager::WriteNextSegmentAnnotation(util::FileOutputStream* file_stream)
+{
+    // The file for the next segment does not exist until the current segment is complete, so replay may find that the
+    // file named by the last segment is missing.
+    const std::string next_filename = util::filepath::GetFilename(CreateSegmentFilename(segment_index_ + 1));
+    const auto        label_length  = util::platform::StringLength(format::kAnnotationLabelNextSegment);
+    const auto        data_length   = next_filename.length();
+
+    format::AnnotationHeader annotation;
+    annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
+    annotation.block_header.type = format::BlockType::kAnnotation;
+    annotation.annotation_type   = format::AnnotationType::kText;
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uint32_t, label_length);
+    annotation.label_length = static_cast<uint32_t>(label_length);
+    annotation.data_length  = data_length;
+
+    CombineAndWriteToFile({ { &annotation, sizeof(annotation) },
+                            { format::kAnnotationLabelNextSegment, label_length },
+                            { next_filename.c_str(), data_length } },
+                          file_stream);
+}
+
+void CommonCaptureManager::WriteExecuteFromFile(util::FileOutputStream& out_stream,
+                                                format::ApiFamilyId     api_family,
+                                                const std::string&      filename,
+                                                format::ThreadId        thread_id,
+                                                uint32_t                n_blocks,
+                                                int64_t                 offset)
+{
+    // The file is referenced relative to the directory of the file that contains the block.
+    const std::string relative_file = util::filepath::GetFilename(filename);
+
+    format::ExecuteBlocksFromFile execute_from_file;
+    execute_from_file.meta_header.block_header.size =
+        format::GetMetaDataBlockBaseSize(execute_from_file) + relative_file.length();
+    execute_from_file.meta_header.block_header.type = format::kMetaDataBlock;
+    execute_from_file.meta_header.meta_data_id =
+        format::MakeMetaDataId(api_family, format::MetaDataType::kExecuteBlocksFromFile);
+    execute_from_file.thread_id = thread_id;
+    execute_from_file.n_blocks  = n_blocks;
+    execute_from_file.offset    = offset;
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uint32_t, relative_file.length());
+    execute_from_file.filename_length = static_cast<uint32_t>(relative_file.length());
+
+    CombineAndWriteToFile({ { &execute_from_file, sizeof(execute_from_file) },
+                            { relative_file.c_str(), relative_file.length() } },
+                          &out_stream);
+}
+
+void CommonCaptureManager::CheckCaptureFileSegment(format::ApiFamilyId              api_family,
+                                                   std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    if (((capture_mode_ & kModeWrite) == kModeWrite) && (flight_recorder_ == nullptr) && (file_stream_ != nullptr))
+    {
+        if (((segment_frame_limit_ > 0) && ((current_frame_ - segment_first_frame_) >= segment_frame_limit_)) ||
+            ((segment_size_limit_ > 0) && (static_cast<uint64_t>(file_stream_->GetOffset()) >= segment_size_limit_)))
+        {
+            StartNextCaptureFileSegment(api_family, current_lock);
+        }
+    }
+}
+
+void CommonCaptureManager::StartNextCaptureFileSegment(format::ApiFamilyId              api_family,
+                                                       std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    auto has_shared_lock = current_lock.owns_lock();
+    if (has_shared_lock)
+    {
+        current_lock.unlock();
+    }
+
+    {
+        auto exclusive_api_call_lock = std::unique_lock<CommonCaptureManager::ApiCallMutexT>{};
+        if (!GetForceCommandSerialization())
+        {
+            // If command serialization is active, the caller already holds the exclusive lock.
+            exclusive_api_call_lock = AcquireExclusiveApiCallLock();
+        }
+
+        // The link to the next segment must be the last block of the current segment.
+        FlushCompressionQueue();
+
+        const std::string segment_filename = CreateSegmentFilename(segment_index_ + 1);
+
+        auto segment_stream = CreateCaptureFileStream(segment_filename);
+        if (segment_stream->IsValid())
+        {
+            // Each segment starts with its own file header, so that it can be inspected on its own. The link to the
+            // segment starts after the header.
+            WriteFileHeader(segment_stream.get());
+            const int64_t segment_offset = segment_stream->GetOffset();
+
+            WriteExecuteFromFile(
+                *file_stream_, api_family, segment_filename, GetThreadData()->thread_id_, 0, segment_offset);
+            file_stream_->Flush();
+
+            ++segment_index_;
+            segment_first_frame_ = current_frame_;
+            file_stream_         = std::move(segment_stream);
+            capture_filename_    = segment_filename;
+
+            WriteNextSegmentAnnotation(file_stream_.get());
+
+            GFXRECON_LOG_INFO("Recording graphics API capture to segment %s", capture_filename_.c_str());
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to create capture file segment %s; the capture will continue in %s",
+                               segment_filename.c_str(),
+                               capture_filename_.c_str());
+            segment_size_limit_  = 0;
+            segment_frame_limit_ = 0;
+        }
+    }
+
+    if (has_shared_lock)
+    {
+        current_lock.lock();
+    }
+}
+
 void CommonCaptureManager::WriteFileHeader(util::FileOutputStream* file_stream)
 {
     std::vector<format::FileOptionPair> option_list;
@@ -1422,38 +2084,92 @@ void CommonCaptureManager::WriteFillMemoryCmd(
         fill_cmd.memory_offset = offset;
         fill_cmd.memory_size   = size;
 
-        bool not_compressed = true;
+        WriteMetaDataBlock(&fill_cmd.meta_header, header_size, uncompressed_data, uncompressed_size);
+    }
+}
+
+void CommonCaptureManager::AppendToCommandRecording(std::vector<uint8_t>* recording)
+{
+    assert(recording != nullptr);
 
-        if (compressor_ != nullptr)
-        {
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
-            {
-                not_compressed = false;
+    auto   parameter_buffer = thread_data->parameter_buffer_.get();
+    size_t parameter_size   = parameter_buffer->GetDataSize();
 
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    // Recorded blocks are stored uncompressed, as the complete recording is compressed when it is written.
+    format::FunctionCallHeader call_header;
+    call_header.block_header.type = format::BlockType::kFunctionCallBlock;
+    call_header.block_header.size = sizeof(call_header.api_call_id) + sizeof(call_header.thread_id) + parameter_size;
+    call_header.api_call_id       = thread_data->call_id_;
+    call_header.thread_id         = 0;
 
-                // Calculate size of packet with uncompressed data size.
-                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+    const uint8_t* header_data = reinterpret_cast<const uint8_t*>(&call_header);
+    recording->insert(recording->end(), header_data, header_data + sizeof(call_header));
 
-                // Copy header to beginning of compressed_buffer_
-                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+    size_t parameter_offset = recording->size();
+    recording->insert(recording->end(), parameter_buffer->GetData(), parameter_buffer->GetData() + parameter_size);
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
-            }
-        }
+    // The command buffer handle is the first parameter of every command. It is cleared so that the same commands
+    // recorded to different command buffers produce identical recordings.
+    if (parameter_size >= sizeof(format::HandleId))
+    {
+        memset(recording->data() + parameter_offset, 0, sizeof(format::HandleId));
+    }
+}
 
-        if (not_compressed)
+// Returns the number of function call blocks in a command buffer recording.
+static uint64_t CountRecordedCommands(const std::vector<uint8_t>& recording)
+{
+    uint64_t count  = 0;
+    size_t   offset = 0;
+
+    while ((offset + sizeof(format::BlockHeader)) <= recording.size())
+    {
+        format::BlockHeader block_header;
+        memcpy(&block_header, recording.data() + offset, sizeof(block_header));
+
+        offset += sizeof(block_header) + static_cast<size_t>(block_header.size);
+        ++count;
+    }
+
+    return count;
+}
+
+void CommonCaptureManager::WriteCommandBufferRecording(format::ApiFamilyId         api_family,
+                                                       format::HandleId            command_buffer_id,
+                                                       const std::vector<uint8_t>& recording)
+{
+    if (IsCaptureModeWrite() && (command_recording_cache_ != nullptr) && !recording.empty())
+    {
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        format::CommandBufferRecording recording_cmd;
+        recording_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        recording_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kCommandBufferRecording);
+        recording_cmd.thread_id         = thread_data->thread_id_;
+        recording_cmd.command_buffer_id = command_buffer_id;
+
+        if (command_recording_cache_->FindOrAdd(recording.data(), recording.size(), &recording_cmd.recording_index))
         {
-            // Calculate size of packet with compressed data size.
-            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
+            recording_cmd.recording_size                = 0;
+            recording_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(recording_cmd);
 
-            CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+            WriteToFile(&recording_cmd, sizeof(recording_cmd));
         }
+        else
+        {
+            recording_cmd.recording_size = recording.size();
+
+            WriteMetaDataBlock(&recording_cmd.meta_header, sizeof(recording_cmd), recording.data(), recording.size());
+        }
+
+        // Each recorded command is assigned its own block index, following the index of the recording block, to match
+        // the block indices that are assigned to the commands when the recording is processed for replay.
+        IncrementBlockIndex(CountRecordedCommands(recording));
     }
 }
 
@@ -1480,7 +2196,66 @@ void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_
     }
 }
 
+void CommonCaptureManager::WriteMetaDataBlock(format::MetaDataHeader* header,
+                                              size_t                  header_size,
+                                              const void*             data,
+                                              size_t                  data_size)
+{
+    // The size of the block header is not included in the block size.
+    const size_t   base_size = header_size - sizeof(format::BlockHeader);
+    const uint8_t* bytes     = static_cast<const uint8_t*>(data);
+
+    if (compression_queue_ != nullptr)
+    {
+        compression_queue_->QueueMetaDataBlock(header, header_size, bytes, data_size);
+        IncrementBlockIndex(1);
+        return;
+    }
+
+    if (compressor_ != nullptr)
+    {
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        size_t compressed_size = compressor_->Compress(data_size, bytes, &thread_data->compressed_buffer_, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < data_size))
+        {
+            // We don't have special headers for compressed meta-data blocks because their headers always include the
+            // uncompressed size, so we just change the type to indicate the data is compressed.
+            header->block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            header->block_header.size = base_size + compressed_size;
+
+            // Copy header to beginning of compressed_buffer_
+            util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, header, header_size);
+
+            WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+            return;
+        }
+    }
+
+    header->block_header.size = base_size + data_size;
+
+    CombineAndWriteToFile({ { header, header_size }, { data, data_size } });
+}
+
 void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream)
+{
+    if ((compression_queue_ != nullptr) && (file_stream == nullptr))
+    {
+        // Queue the block to keep it in order with the blocks that are being compressed.
+        std::pair<const void*, size_t> buffer(data, size);
+        compression_queue_->QueueBlock(&buffer, 1);
+    }
+    else
+    {
+        WriteToStream(data, size, (file_stream != nullptr) ? file_stream : file_stream_.get());
+    }
+
+    IncrementBlockIndex(1);
+}
+
+void CommonCaptureManager::WriteToStream(const void* data, size_t size, util::FileOutputStream* output_stream)
 {
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -1496,8 +2271,6 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
         }
     }
 
-    util::FileOutputStream* output_stream = (file_stream != nullptr) ? file_stream : file_stream_.get();
-
     output_stream->Write(data, size);
     if (force_file_flush_)
     {
@@ -1513,13 +2286,14 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
             manager->UffdUnblockRtSignal();
         }
     }
+}
 
-    // Increment block index
-    auto thread_data = GetThreadData();
-    assert(thread_data != nullptr);
-
-    ++block_index_;
-    thread_data->block_index_ = block_index_.load();
+void CommonCaptureManager::FlushCompressionQueue()
+{
+    if (compression_queue_ != nullptr)
+    {
+        compression_queue_->Flush();
+    }
 }
 
 void CommonCaptureManager::AtExit()
@@ -25,7 +25,11 @@
 #ifndef GFXRECON_ENCODE_CAPTURE_MANAGER_H
 #define GFXRECON_ENCODE_CAPTURE_MANAGER_H
 
+#include "encode/block_compression_queue.h"
 #include "encode/capture_settings.h"
+#include "encode/command_recording_cache.h"
+#include "encode/fixed_parameter_encoder.h"
+#include "encode/flight_recorder.h"
 #include "encode/handle_unwrap_memory.h"
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
@@ -36,6 +40,7 @@
 #include "util/defines.h"
 #include "util/file_output_stream.h"
 #include "util/keyboard.h"
+#include "util/reader_biased_shared_mutex.h"
 
 #include <atomic>
 #include <cassert>
@@ -55,7 +60,9 @@ class ApiCaptureManager;
 class CommonCaptureManager
 {
   public:
-    typedef std::shared_mutex ApiCallMutexT;
+    // The shared API call lock is acquired by every intercepted API call, while the exclusive lock is only acquired for
+    // rare events such as trim state writes and forced command serialization.
+    typedef util::ReaderBiasedSharedMutex ApiCallMutexT;
 
     static format::HandleId GetUniqueId() { return ++unique_id_counter_; }
 
@@ -91,6 +98,41 @@ class CommonCaptureManager
         return nullptr;
     }
 
+    // Variants of BeginTrackedApiCallCapture and BeginApiCallCapture for API calls with a fixed parameter_size, which
+    // is reserved in the parameter buffer up front. The parameter encoding must write exactly parameter_size bytes.
+    FixedParameterEncoder* BeginTrackedFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size)
+    {
+        if (capture_mode_ != kModeDisabled)
+        {
+            return InitFixedApiCallCapture(call_id, parameter_size);
+        }
+
+        return nullptr;
+    }
+
+    FixedParameterEncoder* BeginFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size)
+    {
+        if ((capture_mode_ & kModeWrite) == kModeWrite)
+        {
+            return InitFixedApiCallCapture(call_id, parameter_size);
+        }
+
+        return nullptr;
+    }
+
+    // Variant of BeginTrackedApiCallCapture for commands that are recorded to a command buffer. When command buffer
+    // deduplication is enabled, pointer addresses are omitted from the encoded parameters, as the addresses of the
+    // application's parameter memory change between recordings that are otherwise identical.
+    ParameterEncoder* BeginTrackedCommandApiCallCapture(format::ApiCallId call_id)
+    {
+        if (capture_mode_ != kModeDisabled)
+        {
+            return InitApiCallCapture(call_id, (command_recording_cache_ != nullptr));
+        }
+
+        return nullptr;
+    }
+
     ParameterEncoder* BeginTrackedMethodCallCapture(format::ApiCallId call_id, format::HandleId object_id)
     {
         if (capture_mode_ != kModeDisabled)
@@ -140,6 +182,17 @@ class CommonCaptureManager
 
     void DeactivateTrimmingDrawCalls(std::shared_lock<ApiCallMutexT>& current_lock);
 
+    // Writes a state checkpoint to the flight recorder when one is due, and writes the recorded frames to a capture
+    // file when requested by the capture trigger.
+    void CheckFlightRecorder(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
+
+    // Prepares the file name and file header that WriteFlightRecordingAfterCrash writes, which cannot be built when the
+    // fatal error handlers run.
+    void PrepareFlightRecordingAfterCrash();
+
+    // Called by the fatal error handlers to write the flight recorder contents before the process terminates.
+    static void WriteFlightRecordingAfterCrash();
+
     bool IsTrimHotkeyPressed();
 
     bool RuntimeTriggerEnabled();
@@ -218,6 +271,7 @@ class CommonCaptureManager
         format::HandleId                         object_id_;
         std::unique_ptr<encode::ParameterBuffer> parameter_buffer_;
         std::unique_ptr<ParameterEncoder>        parameter_encoder_;
+        FixedParameterEncoder                    fixed_parameter_encoder_;
         std::vector<uint8_t>                     compressed_buffer_;
         HandleUnwrapMemory                       handle_unwrap_memory_;
         uint64_t                                 block_index_;
@@ -281,18 +335,23 @@ class CommonCaptureManager
     std::string CreateTrimDrawCallsFilename(const std::string&                    base_filename,
                                             const CaptureSettings::TrimDrawCalls& trim_draw_calls);
     std::unique_ptr<util::FileOutputStream> CreateAssetFile();
+    std::unique_ptr<util::FileOutputStream> CreateCaptureFileStream(const std::string& filename) const;
     std::string                             CreateAssetFilename(const std::string& base_filename) const;
     bool CreateCaptureFile(format::ApiFamilyId api_family, const std::string& base_filename);
     void WriteCaptureOptions(std::string& operation_annotation);
     void ActivateTrimming(std::shared_lock<ApiCallMutexT>& current_lock);
     void DeactivateTrimming(std::shared_lock<ApiCallMutexT>& current_lock);
+    void WriteFlightRecorderCheckpoint(std::shared_lock<ApiCallMutexT>& current_lock);
+    void WriteFlightRecording(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
 
     void WriteFileHeader(util::FileOutputStream* file_stream = nullptr);
 
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
                          std::vector<format::FileOptionPair>* option_list);
 
-    ParameterEncoder* InitApiCallCapture(format::ApiCallId call_id);
+    ParameterEncoder* InitApiCallCapture(format::ApiCallId call_id, bool omit_addresses = false);
+
+    FixedParameterEncoder* InitFixedApiCallCapture(format::ApiCallId call_id, size_t parameter_size);
 
     ParameterEncoder* InitMethodCallCapture(format::ApiCallId call_id, format::HandleId object_id);
 
@@ -302,8 +361,23 @@ class CommonCaptureManager
     void WriteFillMemoryCmd(
         format::ApiFamilyId api_family, format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data);
 
+    CommandRecordingCache* GetCommandRecordingCache() { return command_recording_cache_.get(); }
+
+    // Appends the block of the current API call to a command buffer recording, with the thread ID and the command
+    // buffer handle ID set to zero.
+    void AppendToCommandRecording(std::vector<uint8_t>* recording);
+
+    // Writes the commands recorded to a command buffer, or a reference to an identical earlier recording.
+    void WriteCommandBufferRecording(format::ApiFamilyId         api_family,
+                                     format::HandleId            command_buffer_id,
+                                     const std::vector<uint8_t>& recording);
+
     void WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family, uint64_t allocation_id, uint64_t allocation_size);
 
+    // Writes a meta-data block with a header that is followed by data, compressing the data when compression is
+    // enabled. The block size is set from header_size and the size of the written data.
+    void WriteMetaDataBlock(format::MetaDataHeader* header, size_t header_size, const void* data, size_t data_size);
+
     void WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream = nullptr);
 
     template <size_t N>
@@ -312,6 +386,14 @@ class CommonCaptureManager
     {
         static_assert(N != 1, "Use WriteToFile(void*, size) when writing a single buffer.");
 
+        if ((compression_queue_ != nullptr) && (file_stream == nullptr))
+        {
+            // The queue combines the buffers when it copies them.
+            compression_queue_->QueueBlock(buffers, N);
+            IncrementBlockIndex(1);
+            return;
+        }
+
         // Combine buffers for a single write.
         std::vector<uint8_t>& scratch_buffer = GetThreadData()->GetScratchBuffer();
         scratch_buffer.clear();
@@ -336,12 +418,26 @@ class CommonCaptureManager
     bool WriteFrameStateFile();
 
   private:
+    void WriteToStream(const void* data, size_t size, util::FileOutputStream* output_stream);
+
+    void FlushCompressionQueue();
+
     void WriteExecuteFromFile(util::FileOutputStream& out_stream,
+                              format::ApiFamilyId     api_family,
                               const std::string&      filename,
                               format::ThreadId        thread_id,
                               uint32_t                n_blocks,
                               int64_t                 offset);
 
+    std::string CreateSegmentFilename(uint32_t segment_index) const;
+
+    void WriteNextSegmentAnnotation(util::FileOutputStream* file_stream);
+
+    // Switches to a new capture file segment when the current segment has reached the size or frame limit.
+    void CheckCaptureFileSegment(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
+
+    void StartNextCaptureFileSegment(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
+
   protected:
     std::unique_ptr<util::Compressor> compressor_;
     std::mutex                        mapped_memory_lock_;
@@ -374,12 +470,26 @@ class CommonCaptureManager
         capture_settings_; // Settings from the settings file and environment at capture manager creation time.
 
     std::unique_ptr<util::FileOutputStream> file_stream_;
+    std::unique_ptr<BlockCompressionQueue>  compression_queue_;
+    uint32_t                                compression_thread_count_;
+    size_t                                  compression_queue_size_;
+    std::unique_ptr<FlightRecorder>         flight_recorder_;
+    std::string                             crash_filename_;
+    std::vector<uint8_t>                    crash_file_header_;
+    std::string                             crash_message_;
+    std::unique_ptr<CommandRecordingCache>  command_recording_cache_;
+    uint64_t                                segment_size_limit_;
+    uint32_t                                segment_frame_limit_;
+    uint32_t                                segment_index_;
+    uint32_t                                segment_first_frame_;
+    std::string                             segment_base_filename_;
     format::EnabledOptions                  file_options_;
     std::string                             base_filename_;
     std::string                             capture_filename_;
     std::string                             asset_file_name_;
     bool                                    timestamp_filename_;
     bool                                    force_file_flush_;
+    bool                                    direct_file_io_;
     CaptureSettings::MemoryTrackingMode     memory_tracking_mode_;
     bool                                    page_guard_align_buffer_sizes_;
     bool                                    page_guard_track_ahb_memory_;
@@ -45,12 +45,24 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // clang-format off
 #define CAPTURE_COMPRESSION_TYPE_LOWER                       "capture_compression_type"
 #define CAPTURE_COMPRESSION_TYPE_UPPER                       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER                    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER                    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_COMPRESSION_QUEUE_SIZE_LOWER                 "capture_compression_queue_size"
+#define CAPTURE_COMPRESSION_QUEUE_SIZE_UPPER                 "CAPTURE_COMPRESSION_QUEUE_SIZE"
 #define CAPTURE_FILE_NAME_LOWER                              "capture_file"
 #define CAPTURE_FILE_NAME_UPPER                              "CAPTURE_FILE"
 #define CAPTURE_FILE_USE_TIMESTAMP_LOWER                     "capture_file_timestamp"
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER                     "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER                             "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER                             "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_SEGMENT_SIZE_LOWER                      "capture_file_segment_size"
+#define CAPTURE_FILE_SEGMENT_SIZE_UPPER                      "CAPTURE_FILE_SEGMENT_SIZE"
+#define CAPTURE_FILE_SEGMENT_FRAMES_LOWER                    "capture_file_segment_frames"
+#define CAPTURE_FILE_SEGMENT_FRAMES_UPPER                    "CAPTURE_FILE_SEGMENT_FRAMES"
+#define CAPTURE_FILE_DIRECT_IO_LOWER                         "capture_file_direct_io"
+#define CAPTURE_FILE_DIRECT_IO_UPPER                         "CAPTURE_FILE_DIRECT_IO"
+#define CAPTURE_DEDUP_COMMAND_BUFFERS_LOWER                  "capture_dedup_command_buffers"
+#define CAPTURE_DEDUP_COMMAND_BUFFERS_UPPER                  "CAPTURE_DEDUP_COMMAND_BUFFERS"
 #define LOG_ALLOW_INDENTS_LOWER                              "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER                              "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER                             "log_break_on_error"
@@ -91,6 +103,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_TRIGGER_UPPER                                "CAPTURE_TRIGGER"
 #define CAPTURE_TRIGGER_FRAMES_LOWER                         "capture_trigger_frames"
 #define CAPTURE_TRIGGER_FRAMES_UPPER                         "CAPTURE_TRIGGER_FRAMES"
+#define CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER                 "capture_flight_recorder_frames"
+#define CAPTURE_FLIGHT_RECORDER_FRAMES_UPPER                 "CAPTURE_FLIGHT_RECORDER_FRAMES"
+#define CAPTURE_FLIGHT_RECORDER_INTERVAL_LOWER               "capture_flight_recorder_checkpoint_interval"
+#define CAPTURE_FLIGHT_RECORDER_INTERVAL_UPPER               "CAPTURE_FLIGHT_RECORDER_CHECKPOINT_INTERVAL"
+#define CAPTURE_FLIGHT_RECORDER_CRASH_DUMP_LOWER             "capture_flight_recorder_crash_dump"
+#define CAPTURE_FLIGHT_RECORDER_CRASH_DUMP_UPPER             "CAPTURE_FLIGHT_RECORDER_CRASH_DUMP"
 #define CAPTURE_ANDROID_TRIGGER_LOWER                        "capture_android_trigger"
 #define CAPTURE_ANDROID_TRIGGER_UPPER                        "CAPTURE_ANDROID_TRIGGER"
 #define CAPTURE_ANDROID_DUMP_ASSETS_LOWER                    "capture_android_dump_assets"
@@ -151,7 +169,13 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureCompressionQueueSizeEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_QUEUE_SIZE_LOWER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileSegmentSizeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_SIZE_LOWER;
+const char kCaptureFileSegmentFramesEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_FRAMES_LOWER;
+const char kCaptureFileDirectIoEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_DIRECT_IO_LOWER;
+const char kCaptureDedupCommandBuffersEnvVar[]               = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUP_COMMAND_BUFFERS_LOWER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -174,6 +198,9 @@ const char kCaptureDrawCallsEnvVar[]                         = GFXRECON_ENV_VAR_
 const char kQuitAfterFramesEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX QUIT_AFTER_CAPTURE_FRAMES_LOWER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_LOWER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_LOWER;
+const char kCaptureFlightRecorderFramesEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER;
+const char kCaptureFlightRecorderIntervalEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_INTERVAL_LOWER;
+const char kCaptureFlightRecorderCrashDumpEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_CRASH_DUMP_LOWER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_LOWER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_LOWER;
 const char kCaptureUseAssetFileEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_USE_ASSET_FILE_LOWER;
@@ -208,7 +235,13 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureCompressionQueueSizeEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_QUEUE_SIZE_UPPER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileSegmentSizeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_SIZE_UPPER;
+const char kCaptureFileSegmentFramesEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_FRAMES_UPPER;
+const char kCaptureFileDirectIoEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_DIRECT_IO_UPPER;
+const char kCaptureDedupCommandBuffersEnvVar[]               = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEDUP_COMMAND_BUFFERS_UPPER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kCaptureUseAssetFileEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_USE_ASSET_FILE_UPPER;
@@ -241,6 +274,9 @@ const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_UPPER;
+const char kCaptureFlightRecorderFramesEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_FRAMES_UPPER;
+const char kCaptureFlightRecorderIntervalEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_INTERVAL_UPPER;
+const char kCaptureFlightRecorderCrashDumpEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_CRASH_DUMP_UPPER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_UPPER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_UPPER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_UPPER;
@@ -262,8 +298,14 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
 const std::string kOptionKeyCaptureCompressionType                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads                = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureCompressionQueueSize              = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_QUEUE_SIZE_LOWER);
 const std::string kOptionKeyCaptureFile                              = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileSegmentSize                   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SEGMENT_SIZE_LOWER);
+const std::string kOptionKeyCaptureFileSegmentFrames                 = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SEGMENT_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFileDirectIo                      = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_DIRECT_IO_LOWER);
+const std::string kOptionKeyCaptureDedupCommandBuffers               = std::string(kSettingsFilter) + std::string(CAPTURE_DEDUP_COMMAND_BUFFERS_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp                  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents                          = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError                          = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -285,6 +327,9 @@ const std::string kOptionKeyCaptureDrawCalls                         = std::stri
 const std::string kOptionKeyQuitAfterCaptureFrames                   = std::string(kSettingsFilter) + std::string(QUIT_AFTER_CAPTURE_FRAMES_LOWER);
 const std::string kOptionKeyCaptureTrigger                           = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_LOWER);
 const std::string kOptionKeyCaptureTriggerFrames                     = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderFrames              = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderInterval            = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_INTERVAL_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderCrashDump           = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_CRASH_DUMP_LOWER);
 const std::string kOptionKeyCaptureIUnknownWrapping                  = std::string(kSettingsFilter) + std::string(CAPTURE_IUNKNOWN_WRAPPING_LOWER);
 const std::string kOptionKeyCaptureQueueSubmits                      = std::string(kSettingsFilter) + std::string(CAPTURE_QUEUE_SUBMITS_LOWER);
 const std::string kOptionKeyCaptureUseAssetFile                      = std::string(kSettingsFilter) + std::string(CAPTURE_USE_ASSET_FILE_LOWER);
@@ -413,7 +458,13 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionQueueSizeEnvVar, kOptionKeyCaptureCompressionQueueSize);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileSegmentSizeEnvVar, kOptionKeyCaptureFileSegmentSize);
+    LoadSingleOptionEnvVar(options, kCaptureFileSegmentFramesEnvVar, kOptionKeyCaptureFileSegmentFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFileDirectIoEnvVar, kOptionKeyCaptureFileDirectIo);
+    LoadSingleOptionEnvVar(options, kCaptureDedupCommandBuffersEnvVar, kOptionKeyCaptureDedupCommandBuffers);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -437,6 +488,9 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kQuitAfterFramesEnvVar, kOptionKeyQuitAfterCaptureFrames);
     LoadSingleOptionEnvVar(options, kCaptureTriggerEnvVar, kOptionKeyCaptureTrigger);
     LoadSingleOptionEnvVar(options, kCaptureTriggerFramesEnvVar, kOptionKeyCaptureTriggerFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderFramesEnvVar, kOptionKeyCaptureFlightRecorderFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderIntervalEnvVar, kOptionKeyCaptureFlightRecorderInterval);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderCrashDumpEnvVar, kOptionKeyCaptureFlightRecorderCrashDump);
     LoadSingleOptionEnvVar(options, kCaptureQueueSubmitsEnvVar, kOptionKeyCaptureQueueSubmits);
     LoadSingleOptionEnvVar(options, kCaptureUseAssetFileEnvVar, kOptionKeyCaptureUseAssetFile);
 
@@ -510,12 +564,24 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_threads = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureCompressionThreads), settings->trace_settings_.compression_threads);
+    settings->trace_settings_.compression_queue_size = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureCompressionQueueSize), settings->trace_settings_.compression_queue_size);
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.segment_size = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureFileSegmentSize), settings->trace_settings_.segment_size);
+    settings->trace_settings_.segment_frames = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureFileSegmentFrames), settings->trace_settings_.segment_frames);
+    settings->trace_settings_.direct_io =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileDirectIo), settings->trace_settings_.direct_io);
+    settings->trace_settings_.dedup_command_buffers = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureDedupCommandBuffers), settings->trace_settings_.dedup_command_buffers);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -611,6 +677,15 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
         }
     }
 
+    settings->trace_settings_.flight_recorder_frames = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureFlightRecorderFrames), settings->trace_settings_.flight_recorder_frames);
+    settings->trace_settings_.flight_recorder_checkpoint_interval =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureFlightRecorderInterval),
+                                        settings->trace_settings_.flight_recorder_checkpoint_interval);
+    settings->trace_settings_.flight_recorder_crash_dump =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFlightRecorderCrashDump),
+                        settings->trace_settings_.flight_recorder_crash_dump);
+
     settings->trace_settings_.quit_after_frame_ranges = ParseBoolString(
         FindOption(options, kOptionKeyQuitAfterCaptureFrames), settings->trace_settings_.quit_after_frame_ranges);
 
@@ -980,6 +1055,14 @@ util::ScreenshotFormat CaptureSettings::ParseScreenshotFormatString(const std::s
     {
         result = util::ScreenshotFormat::kPng;
     }
+    else if (util::platform::StringCompareNoCase("qoi", value_string.c_str()) == 0)
+    {
+        result = util::ScreenshotFormat::kQoi;
+    }
+    else if (util::platform::StringCompareNoCase("zstd", value_string.c_str()) == 0)
+    {
+        result = util::ScreenshotFormat::kZstd;
+    }
     else
     {
         if (!value_string.empty())
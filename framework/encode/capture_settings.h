@@ -103,6 +103,12 @@ class CaptureSettings
         format::EnabledOptions       capture_file_options;
         bool                         time_stamp_file{ true };
         bool                         force_flush{ false };
+        uint32_t                     compression_threads{ 0 };     // 0 compresses blocks on the API threads.
+        uint32_t                     compression_queue_size{ 64 }; // Memory budget of the compression queue in MiB.
+        uint32_t                     segment_size{ 0 };            // Capture file segment size in MiB, 0 for no limit.
+        uint32_t                     segment_frames{ 0 };          // Frames per capture file segment, 0 for no limit.
+        bool                         direct_io{ false };           // Write the capture file with direct I/O.
+        bool                         dedup_command_buffers{ false };
         MemoryTrackingMode           memory_tracking_mode{ kPageGuard };
         std::string                  screenshot_dir;
         std::vector<util::UintRange> screenshot_ranges;
@@ -112,6 +118,9 @@ class CaptureSettings
         TrimDrawCalls                trim_draw_calls;
         std::string                  trim_key;
         uint32_t                     trim_key_frames{ 0 };
+        uint32_t                     flight_recorder_frames{ 0 };              // 0 disables the flight recorder.
+        uint32_t                     flight_recorder_checkpoint_interval{ 0 }; // 0 uses flight_recorder_frames.
+        bool                         flight_recorder_crash_dump{ true };
         RuntimeTriggerState          runtime_capture_trigger{ kNotUsed };
         bool                         runtime_write_assets{ false };
         int                          page_guard_signal_handler_watcher_max_restores{ 1 };
@@ -0,0 +1,79 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/command_recording_cache.h"
+
+#include "format/format.h"
+#include "util/hash.h"
+#include "util/logging.h"
+
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+bool CommandRecordingCache::FindOrAdd(const uint8_t* data, size_t size, uint32_t* index)
+{
+    GFXRECON_ASSERT(index != nullptr);
+
+    const uint64_t hash = util::hash::GenerateDataHash(data, size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto range = lookup_.equal_range(hash);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        const std::vector<uint8_t>& recording = recordings_[entry->second];
+        if ((recording.size() == size) && (memcmp(recording.data(), data, size) == 0))
+        {
+            *index = entry->second;
+            return true;
+        }
+    }
+
+    if ((cache_size_ + size) > max_cache_size_)
+    {
+        *index = format::kUnreferencedCommandRecording;
+        return false;
+    }
+
+    *index = static_cast<uint32_t>(recordings_.size());
+    recordings_.emplace_back(data, data + size);
+    lookup_.emplace(hash, *index);
+    cache_size_ += size;
+
+    return false;
+}
+
+void CommandRecordingCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    lookup_.clear();
+    recordings_.clear();
+    cache_size_ = 0;
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
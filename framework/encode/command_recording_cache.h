@@ -0,0 +1,69 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_COMMAND_RECORDING_CACHE_H
+#define GFXRECON_ENCODE_COMMAND_RECORDING_CACHE_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Keeps the content of the command buffer recordings that were written to the capture file, so that recordings with
+// identical content can be written as a reference to the first recording. Recordings are no longer cached once the
+// total size of the cached recordings exceeds the memory budget.
+class CommandRecordingCache
+{
+  public:
+    CommandRecordingCache(size_t max_cache_size) : max_cache_size_(max_cache_size), cache_size_(0), generation_(0) {}
+
+    // Searches the cache for a recording with the same content. Returns true and the recording's index when a match
+    // is found. Otherwise, the recording is added to the cache and false is returned, with index set to the index
+    // assigned to the new recording, or to format::kUnreferencedCommandRecording when the cache is full.
+    bool FindOrAdd(const uint8_t* data, size_t size, uint32_t* index);
+
+    // Removes all recordings, for a new capture file that cannot reference the recordings of the previous file.
+    void Clear();
+
+    // Recordings that were started before the cache was last cleared belong to the previous capture file.
+    uint32_t GetGeneration() const { return generation_.load(std::memory_order_acquire); }
+
+  private:
+    std::mutex                                  mutex_;
+    std::unordered_multimap<uint64_t, uint32_t> lookup_;
+    std::vector<std::vector<uint8_t>>           recordings_;
+    size_t                                      max_cache_size_;
+    size_t                                      cache_size_;
+    std::atomic<uint32_t>                       generation_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_COMMAND_RECORDING_CACHE_H
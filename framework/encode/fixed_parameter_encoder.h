@@ -0,0 +1,100 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FIXED_PARAMETER_ENCODER_H
+#define GFXRECON_ENCODE_FIXED_PARAMETER_ENCODER_H
+
+#include "encode/vulkan_handle_wrapper_util.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Encoder for API calls with only scalar and handle parameters, for which the encoded parameter size is known at compile
+// time. Values are copied straight to memory that was reserved in the parameter buffer for the full parameter list, so
+// there are no per-value virtual OutputStream calls or buffer size checks. The value encoding methods match the
+// ParameterEncoder methods of the same name, so the generated encoding code is identical for both encoders.
+class FixedParameterEncoder
+{
+  public:
+    FixedParameterEncoder() {}
+
+    ~FixedParameterEncoder() {}
+
+    void Reset(uint8_t* data, size_t size)
+    {
+        data_ = data;
+        end_  = data + size;
+    }
+
+    // clang-format off
+
+    // Values
+    void EncodeInt8Value(int8_t value)                                                                                { EncodeValue(value); }
+    void EncodeUInt8Value(uint8_t value)                                                                              { EncodeValue(value); }
+    void EncodeInt16Value(int16_t value)                                                                              { EncodeValue(value); }
+    void EncodeUInt16Value(uint16_t value)                                                                            { EncodeValue(value); }
+    void EncodeInt32Value(int32_t value)                                                                              { EncodeValue(value); }
+    void EncodeUInt32Value(uint32_t value)                                                                            { EncodeValue(value); }
+    void EncodeInt64Value(int64_t value)                                                                              { EncodeValue(value); }
+    void EncodeUInt64Value(uint64_t value)                                                                            { EncodeValue(value); }
+    void EncodeFloatValue(float value)                                                                                { EncodeValue(value); }
+    void EncodeDoubleValue(double value)                                                                              { EncodeValue(value); }
+    void EncodeSizeTValue(size_t value)                                                                               { EncodeValue(static_cast<format::SizeTEncodeType>(value)); }
+    void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeValue(static_cast<format::HandleEncodeType>(value)); }
+    void EncodeVkDeviceAddressValue(VkDeviceAddress value)                                                            { EncodeValue(static_cast<format::DeviceSizeEncodeType>(value)); }
+
+    template<typename Wrapper>
+    void EncodeVulkanHandleValue(typename Wrapper::HandleType value)                                                  { EncodeHandleIdValue(vulkan_wrappers::GetWrappedId<Wrapper>(value)); }
+    template<typename T>
+    void EncodeEnumValue(T value)                                                                                     { EncodeValue(static_cast<format::EnumEncodeType>(value)); }
+    template<typename T>
+    void EncodeFlagsValue(T value)                                                                                    { EncodeValue(static_cast<format::FlagsEncodeType>(value)); }
+    template<typename T>
+    void EncodeFlags64Value(T value)                                                                                  { EncodeValue(static_cast<format::Flags64EncodeType>(value)); }
+
+    // clang-format on
+
+  private:
+    template <typename T>
+    void EncodeValue(T value)
+    {
+        assert((data_ + sizeof(T)) <= end_);
+        std::memcpy(data_, &value, sizeof(T));
+        data_ += sizeof(T);
+    }
+
+  private:
+    uint8_t* data_{ nullptr };
+    uint8_t* end_{ nullptr };
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FIXED_PARAMETER_ENCODER_H
@@ -0,0 +1,167 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/flight_recorder.h"
+
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+FlightRecorder::FlightRecorder(uint32_t frame_count, uint32_t checkpoint_interval, uint32_t current_frame) :
+    arena_(kChunkSize), target_(nullptr), frame_count_(frame_count),
+    checkpoint_interval_((checkpoint_interval > 0) ? checkpoint_interval : frame_count)
+{
+    // The first segment has an empty checkpoint, as it starts before the first API call was captured.
+    auto segment         = std::make_unique<Segment>();
+    segment->first_frame = current_frame;
+    segment->checkpoint.SetArena(&arena_);
+    segment->blocks.SetArena(&arena_);
+
+    target_ = &segment->blocks;
+    segments_.emplace_back(std::move(segment));
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    // Return the chunks to the arena before it is destroyed.
+    segments_.clear();
+}
+
+void FlightRecorder::Write(const void* data, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(target_ != nullptr);
+
+    if (size > 0)
+    {
+        util::platform::MemoryCopy(target_->Allocate(size), size, data, size);
+    }
+}
+
+bool FlightRecorder::IsCheckpointDue(uint32_t current_frame) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (current_frame - segments_.back()->first_frame) >= checkpoint_interval_;
+}
+
+void FlightRecorder::BeginCheckpoint(uint32_t current_frame)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto segment         = std::make_unique<Segment>();
+    segment->first_frame = current_frame;
+    segment->checkpoint.SetArena(&arena_);
+    segment->blocks.SetArena(&arena_);
+
+    target_ = &segment->checkpoint;
+    segments_.emplace_back(std::move(segment));
+}
+
+void FlightRecorder::EndCheckpoint()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const uint32_t current_frame = segments_.back()->first_frame;
+    target_                      = &segments_.back()->blocks;
+
+    // The oldest segment can be released when the recording that starts with the next segment already covers the
+    // requested number of frames.
+    while ((segments_.size() > 1) && ((current_frame - segments_[1]->first_frame) >= frame_count_))
+    {
+        segments_.pop_front();
+    }
+}
+
+bool FlightRecorder::WriteRecording(util::OutputStream* output_stream)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return WriteSegments(output_stream);
+}
+
+bool FlightRecorder::WriteRecordingAfterCrash(util::OutputStream* output_stream)
+{
+    // Mutex functions are not async-signal-safe, and the crashing thread may hold the lock, so the recording is written
+    // without it. The block that was being written when the crash occurred may be incomplete.
+    return WriteSegments(output_stream);
+}
+
+uint32_t FlightRecorder::GetFirstFrame() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segments_.front()->first_frame;
+}
+
+size_t FlightRecorder::GetDataSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t size = 0;
+    for (const auto& segment : segments_)
+    {
+        size += segment->checkpoint.GetDataSize() + segment->blocks.GetDataSize();
+    }
+
+    return size;
+}
+
+bool FlightRecorder::WriteBuffer(const util::ChunkedBuffer& buffer, util::OutputStream* output_stream) const
+{
+    for (const util::ChunkArena::Chunk* chunk = buffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        if ((chunk->size > 0) && !output_stream->Write(chunk->GetData(), chunk->size))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FlightRecorder::WriteSegments(util::OutputStream* output_stream) const
+{
+    assert(output_stream != nullptr);
+
+    // Only the checkpoint of the oldest segment is written. The blocks of the later segments were captured after it,
+    // so their checkpoints are not needed to replay the recording.
+    if (!WriteBuffer(segments_.front()->checkpoint, output_stream))
+    {
+        return false;
+    }
+
+    for (const auto& segment : segments_)
+    {
+        if (!WriteBuffer(segment->blocks, output_stream))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,127 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_FLIGHT_RECORDER_H
+#define GFXRECON_ENCODE_FLIGHT_RECORDER_H
+
+#include "util/chunk_arena.h"
+#include "util/defines.h"
+#include "util/file_output_stream.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Keeps the capture blocks for the most recent frames in memory. The recording is split into segments that each start
+// with a state checkpoint, which is a snapshot of the tracked state written by the API capture managers, followed by
+// the blocks captured after the snapshot. Old segments are released once the newer segments cover the requested number
+// of frames, so a recording that is written to a file always starts with a checkpoint and contains at least the
+// requested number of frames when that many frames have been captured.
+class FlightRecorder
+{
+  public:
+    static constexpr size_t kChunkSize = 1024 * 1024;
+
+  public:
+    FlightRecorder(uint32_t frame_count, uint32_t checkpoint_interval, uint32_t current_frame);
+
+    ~FlightRecorder();
+
+    // Appends capture data to the current segment.
+    void Write(const void* data, size_t size);
+
+    bool IsCheckpointDue(uint32_t current_frame) const;
+
+    // Starts a new segment. Data written before the call to EndCheckpoint is stored as the state checkpoint of the new
+    // segment. The caller must ensure that no capture blocks are written until EndCheckpoint is called.
+    void BeginCheckpoint(uint32_t current_frame);
+
+    // Completes the checkpoint and releases the segments that are no longer needed to cover the requested frames.
+    void EndCheckpoint();
+
+    // Writes the checkpoint of the oldest segment, followed by the capture blocks of all segments.
+    bool WriteRecording(util::OutputStream* output_stream);
+
+    // Variant of WriteRecording for fatal error handlers, which does not lock the recorder, as a thread may have been
+    // interrupted while it was writing to the recorder. Only async-signal-safe functions are called, provided that the
+    // output stream does the same.
+    bool WriteRecordingAfterCrash(util::OutputStream* output_stream);
+
+    uint32_t GetFirstFrame() const;
+
+    size_t GetDataSize() const;
+
+  private:
+    struct Segment
+    {
+        uint32_t            first_frame{ 0 };
+        util::ChunkedBuffer checkpoint;
+        util::ChunkedBuffer blocks;
+    };
+
+  private:
+    bool WriteBuffer(const util::ChunkedBuffer& buffer, util::OutputStream* output_stream) const;
+
+    bool WriteSegments(util::OutputStream* output_stream) const;
+
+  private:
+    mutable std::mutex                   mutex_;
+    util::ChunkArena                     arena_;
+    std::deque<std::unique_ptr<Segment>> segments_;
+    util::ChunkedBuffer*                 target_;
+    uint32_t                             frame_count_;
+    uint32_t                             checkpoint_interval_;
+};
+
+// Adapts the flight recorder to the FileOutputStream interface of the capture file, so that capture blocks and state
+// checkpoints are written to memory instead of a file.
+class FlightRecorderStream : public util::FileOutputStream
+{
+  public:
+    FlightRecorderStream(FlightRecorder* recorder) : util::FileOutputStream(nullptr, false), recorder_(recorder) {}
+
+    virtual bool IsValid() override { return (recorder_ != nullptr); }
+
+    virtual bool Write(const void* data, size_t len) override
+    {
+        recorder_->Write(data, len);
+        return true;
+    }
+
+    virtual void Flush() override {}
+
+    virtual int64_t GetOffset() const override { return static_cast<int64_t>(recorder_->GetDataSize()); }
+
+  private:
+    FlightRecorder* recorder_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FLIGHT_RECORDER_H
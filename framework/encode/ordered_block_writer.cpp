@@ -0,0 +1,206 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/ordered_block_writer.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+static const uint32_t kMaxDefaultThreadCount  = 4;
+static const size_t   kPendingBlocksPerThread = 4;
+
+static uint64_t GetElapsedMicroseconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t OrderedBlockWriter::GetDefaultThreadCount()
+{
+    // Leave half of the cores to the application, which keeps running its other threads while the snapshot is written.
+    return std::min(kMaxDefaultThreadCount, std::thread::hardware_concurrency() / 2);
+}
+
+OrderedBlockWriter::OrderedBlockWriter(util::OutputStream* output_stream,
+                                       util::Compressor*   compressor,
+                                       uint32_t            thread_count) :
+    output_stream_(output_stream),
+    compressor_(compressor), pending_bytes_(0), max_pending_blocks_(0), compress_time_us_(0), write_time_us_(0)
+{
+    assert(output_stream_ != nullptr);
+
+    // Without a compressor there is no work to offload, and blocks are written directly.
+    if ((compressor_ != nullptr) && (thread_count > 0))
+    {
+        thread_pool_.set_num_threads(thread_count);
+        max_pending_blocks_ = thread_count * kPendingBlocksPerThread;
+    }
+}
+
+OrderedBlockWriter::~OrderedBlockWriter()
+{
+    Flush();
+}
+
+void OrderedBlockWriter::SubmitBlock(const void*            header,
+                                     size_t                 header_size,
+                                     const void*            prefix,
+                                     size_t                 prefix_size,
+                                     std::vector<uint8_t>&& data,
+                                     const uint8_t*         external_data,
+                                     size_t                 data_size)
+{
+    assert((header != nullptr) && (header_size >= sizeof(format::BlockHeader)));
+    assert((prefix != nullptr) || (prefix_size == 0));
+
+    auto block = std::make_unique<Block>();
+
+    block->header.assign(reinterpret_cast<const uint8_t*>(header), reinterpret_cast<const uint8_t*>(header) + header_size);
+    block->data_size         = data_size;
+    block->uncompressed_size = data_size;
+
+    if (prefix_size > 0)
+    {
+        block->prefix.assign(reinterpret_cast<const uint8_t*>(prefix),
+                             reinterpret_cast<const uint8_t*>(prefix) + prefix_size);
+    }
+
+    if (thread_pool_.numthreads() == 0)
+    {
+        // Synchronous path: compress from the caller's memory and write immediately.
+        block->data          = std::move(data);
+        block->external_data = (external_data != nullptr) ? external_data : block->data.data();
+
+        CompressBlock(block.get());
+
+        auto start = std::chrono::steady_clock::now();
+        WriteBlock(block.get());
+        write_time_us_ += GetElapsedMicroseconds(start);
+        return;
+    }
+
+    if (external_data != nullptr)
+    {
+        block->data.assign(external_data, external_data + data_size);
+    }
+    else
+    {
+        block->data = std::move(data);
+    }
+
+    pending_bytes_ += data_size;
+    pending_blocks_.emplace_back(thread_pool_.post([this, pending = std::move(block)]() mutable {
+        CompressBlock(pending.get());
+        return std::move(pending);
+    }));
+
+    while ((pending_blocks_.size() > max_pending_blocks_) || (pending_bytes_ > kMaxPendingBytes))
+    {
+        WriteNextPendingBlock();
+    }
+}
+
+void OrderedBlockWriter::CompressBlock(Block* block)
+{
+    assert(block != nullptr);
+
+    const uint8_t* data = (block->external_data != nullptr) ? block->external_data : block->data.data();
+
+    if ((compressor_ != nullptr) && (block->data_size > 0))
+    {
+        auto                 start = std::chrono::steady_clock::now();
+        std::vector<uint8_t> compressed_data;
+        size_t               compressed_size = compressor_->Compress(block->data_size, data, &compressed_data, 0);
+
+        if ((compressed_size > 0) && (compressed_size < block->data_size))
+        {
+            compressed_data.resize(compressed_size);
+
+            block->data          = std::move(compressed_data);
+            block->external_data = nullptr;
+            block->data_size     = compressed_size;
+            block->compressed    = true;
+        }
+
+        compress_time_us_ += GetElapsedMicroseconds(start);
+    }
+}
+
+void OrderedBlockWriter::WriteBlock(Block* block)
+{
+    assert(block != nullptr);
+
+    format::BlockHeader* block_header = reinterpret_cast<format::BlockHeader*>(block->header.data());
+
+    block_header->size = (block->header.size() - sizeof(format::BlockHeader)) + block->prefix.size() + block->data_size;
+
+    if (block->compressed)
+    {
+        block_header->type = format::BlockType::kCompressedMetaDataBlock;
+    }
+
+    output_stream_->Write(block->header.data(), block->header.size());
+
+    if (!block->prefix.empty())
+    {
+        output_stream_->Write(block->prefix.data(), block->prefix.size());
+    }
+
+    if (block->data_size > 0)
+    {
+        const uint8_t* data = (block->external_data != nullptr) ? block->external_data : block->data.data();
+        output_stream_->Write(data, block->data_size);
+    }
+}
+
+void OrderedBlockWriter::WriteNextPendingBlock()
+{
+    assert(!pending_blocks_.empty());
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<Block> block = pending_blocks_.front().get();
+    pending_blocks_.pop_front();
+
+    pending_bytes_ -= block->uncompressed_size;
+    WriteBlock(block.get());
+
+    write_time_us_ += GetElapsedMicroseconds(start);
+}
+
+void OrderedBlockWriter::Flush()
+{
+    while (!pending_blocks_.empty())
+    {
+        WriteNextPendingBlock();
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,133 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_ORDERED_BLOCK_WRITER_H
+#define GFXRECON_ENCODE_ORDERED_BLOCK_WRITER_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+#include "util/threadpool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Writes meta data blocks with large data payloads, such as the resource memory content written for the trim state
+// snapshot. Payloads are compressed on worker threads while the caller retrieves the data for the next block, and
+// completed blocks are written to the output stream in the order they were submitted, so the file content does not
+// depend on thread scheduling. When there is no compressor or no worker thread, blocks are compressed and written
+// immediately on the calling thread.
+class OrderedBlockWriter
+{
+  public:
+    // Upper bound for the uncompressed data held by blocks that have been submitted but not yet written.
+    static const size_t kMaxPendingBytes = 256 * 1024 * 1024;
+
+    static uint32_t GetDefaultThreadCount();
+
+    OrderedBlockWriter(util::OutputStream* output_stream, util::Compressor* compressor, uint32_t thread_count);
+
+    ~OrderedBlockWriter();
+
+    // Submits a block made of a meta data command header, an optional uncompressed prefix, and a data payload that is
+    // compressed when a compressor is available. The header must start with a format::BlockHeader, which is updated
+    // with the final block size and with the compressed block type when the payload is compressed.
+    template <typename HeaderT>
+    void WriteMetaDataBlock(const HeaderT&         header,
+                            const void*            prefix,
+                            size_t                 prefix_size,
+                            std::vector<uint8_t>&& data,
+                            size_t                 data_size)
+    {
+        SubmitBlock(&header, sizeof(header), prefix, prefix_size, std::move(data), nullptr, data_size);
+    }
+
+    // Same as above, but the payload is referenced by pointer. It is copied if the block is compressed on a worker
+    // thread, so the memory may be released as soon as this call returns.
+    template <typename HeaderT>
+    void WriteMetaDataBlock(
+        const HeaderT& header, const void* prefix, size_t prefix_size, const uint8_t* data, size_t data_size)
+    {
+        SubmitBlock(&header, sizeof(header), prefix, prefix_size, std::vector<uint8_t>(), data, data_size);
+    }
+
+    // Waits for all submitted blocks and writes them to the output stream.
+    void Flush();
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(thread_pool_.numthreads()); }
+
+    // Compression time in milliseconds, summed over all threads.
+    double GetCompressTime() const { return static_cast<double>(compress_time_us_.load()) / 1000.0; }
+
+    // Time in milliseconds that the submitting thread spent waiting for compression to complete and writing blocks.
+    double GetWriteTime() const { return static_cast<double>(write_time_us_) / 1000.0; }
+
+  private:
+    struct Block
+    {
+        std::vector<uint8_t> header;
+        std::vector<uint8_t> prefix;
+        std::vector<uint8_t> data;
+        const uint8_t*       external_data{ nullptr };
+        size_t               data_size{ 0 };
+        size_t               uncompressed_size{ 0 };
+        bool                 compressed{ false };
+    };
+
+    void SubmitBlock(const void*            header,
+                     size_t                 header_size,
+                     const void*            prefix,
+                     size_t                 prefix_size,
+                     std::vector<uint8_t>&& data,
+                     const uint8_t*         external_data,
+                     size_t                 data_size);
+
+    void CompressBlock(Block* block);
+
+    void WriteBlock(Block* block);
+
+    void WriteNextPendingBlock();
+
+  private:
+    util::OutputStream*                             output_stream_;
+    util::Compressor*                               compressor_;
+    util::ThreadPool                                thread_pool_;
+    std::deque<std::future<std::unique_ptr<Block>>> pending_blocks_;
+    size_t                                          pending_bytes_;
+    size_t                                          max_pending_blocks_;
+    std::atomic<uint64_t>                           compress_time_us_;
+    uint64_t                                        write_time_us_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_ORDERED_BLOCK_WRITER_H
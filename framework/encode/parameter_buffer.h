@@ -50,6 +50,16 @@ class ParameterBuffer : public util::MemoryOutputStream
         header_size_ = 0;
     }
 
+    // Appends size bytes to the buffer and returns a pointer to the start of the appended bytes, to be written directly
+    // by the caller.
+    uint8_t* ReserveData(size_t size)
+    {
+        std::vector<uint8_t>* buffer = GetBuffer();
+        const size_t          offset = buffer->size();
+        buffer->resize(offset + size);
+        return buffer->data() + offset;
+    }
+
     // Returns a pointer to the header data or nullptr if no header data was reserved.
     uint8_t* GetHeaderData() { return (header_size_ > 0) ? GetBuffer()->data() : nullptr; };
 
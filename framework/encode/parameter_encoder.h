@@ -48,10 +48,13 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class ParameterEncoder
 {
   public:
-    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream) {}
+    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream), omit_addresses_(false) {}
 
     ~ParameterEncoder() {}
 
+    // When set, pointer addresses are omitted from all pointer encodings, as if omit_addr was specified.
+    void SetOmitAddresses(bool omit_addresses) { omit_addresses_ = omit_addresses; }
+
     // clang-format off
 
     // Values
@@ -309,7 +312,7 @@ class ParameterEncoder
         }
         else
         {
-            if (!omit_addr)
+            if (!omit_addr && !omit_addresses_)
             {
                 pointer_attrib |= format::PointerAttributes::kHasAddress;
             }
@@ -652,6 +655,7 @@ class ParameterEncoder
 
   private:
     util::OutputStream* output_stream_;
+    bool                omit_addresses_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
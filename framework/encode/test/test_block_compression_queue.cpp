@@ -0,0 +1,281 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "encode/block_compression_queue.h"
+#include "format/format.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using gfxrecon::encode::BlockCompressionQueue;
+
+namespace format = gfxrecon::format;
+
+namespace
+{
+
+// Compresses data made of a single repeated byte to the byte and the data size, and leaves other data uncompressed.
+// Compression takes longer for lower block indices, stored in the first byte, so that later blocks tend to complete
+// before earlier ones.
+class RepeatedByteCompressor : public gfxrecon::util::Compressor
+{
+  public:
+    size_t Compress(const size_t          uncompressed_size,
+                    const uint8_t*        uncompressed_data,
+                    std::vector<uint8_t>* compressed_data,
+                    size_t                compressed_data_offset) override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds((16 - (uncompressed_data[0] % 16)) * 100));
+
+        for (size_t i = 1; i < uncompressed_size; ++i)
+        {
+            if (uncompressed_data[i] != uncompressed_data[0])
+            {
+                return 0;
+            }
+        }
+
+        const uint64_t size = uncompressed_size;
+        compressed_data->resize(compressed_data_offset + 1 + sizeof(size));
+        (*compressed_data)[compressed_data_offset] = uncompressed_data[0];
+        std::memcpy(compressed_data->data() + compressed_data_offset + 1, &size, sizeof(size));
+        return 1 + sizeof(size);
+    }
+
+    size_t Decompress(const size_t                compressed_size,
+                      const std::vector<uint8_t>& compressed_data,
+                      const size_t                expected_uncompressed_size,
+                      std::vector<uint8_t>*       uncompressed_data) override
+    {
+        uncompressed_data->assign(expected_uncompressed_size, compressed_data[0]);
+        return expected_uncompressed_size;
+    }
+};
+
+struct WrittenBlocks
+{
+    std::mutex                        mutex;
+    std::vector<std::vector<uint8_t>> blocks;
+
+    BlockCompressionQueue::WriteFunction GetWriteFunction()
+    {
+        return [this](const void* data, size_t size) {
+            std::lock_guard<std::mutex> lock(mutex);
+            const uint8_t*              bytes = reinterpret_cast<const uint8_t*>(data);
+            blocks.emplace_back(bytes, bytes + size);
+        };
+    }
+};
+
+// Even blocks repeat a single byte and are compressed, odd blocks are not.
+std::vector<uint8_t> MakeBlockData(uint32_t index)
+{
+    std::vector<uint8_t> data(64 + (index % 7) * 100, static_cast<uint8_t>(index));
+    if ((index % 2) != 0)
+    {
+        data.back() = static_cast<uint8_t>(index + 1);
+    }
+    return data;
+}
+
+// Checks that a written block is the function call block that was queued with the index as its thread ID.
+void CheckFunctionCallBlock(const std::vector<uint8_t>& block, uint32_t index)
+{
+    const std::vector<uint8_t> expected = MakeBlockData(index);
+
+    format::BlockHeader block_header;
+    REQUIRE(block.size() >= sizeof(block_header));
+    std::memcpy(&block_header, block.data(), sizeof(block_header));
+    REQUIRE((block_header.size + sizeof(block_header)) == block.size());
+
+    if ((index % 2) == 0)
+    {
+        format::CompressedFunctionCallHeader header;
+        std::memcpy(&header, block.data(), sizeof(header));
+        REQUIRE(header.block_header.type == format::BlockType::kCompressedFunctionCallBlock);
+        REQUIRE(header.api_call_id == format::ApiCallId::ApiCall_vkCmdDraw);
+        REQUIRE(header.thread_id == index);
+        REQUIRE(header.uncompressed_size == expected.size());
+        REQUIRE(block.size() == (sizeof(header) + 1 + sizeof(uint64_t)));
+        REQUIRE(block[sizeof(header)] == expected[0]);
+    }
+    else
+    {
+        format::FunctionCallHeader header;
+        std::memcpy(&header, block.data(), sizeof(header));
+        REQUIRE(header.block_header.type == format::BlockType::kFunctionCallBlock);
+        REQUIRE(header.api_call_id == format::ApiCallId::ApiCall_vkCmdDraw);
+        REQUIRE(header.thread_id == index);
+        REQUIRE(std::vector<uint8_t>(block.begin() + sizeof(header), block.end()) == expected);
+    }
+}
+
+} // namespace
+
+TEST_CASE("BlockCompressionQueue - blocks are written in the order they were queued", "[compression_queue]")
+{
+    RepeatedByteCompressor compressor;
+    WrittenBlocks          written;
+    const uint32_t         block_count = 64;
+
+    {
+        BlockCompressionQueue queue(&compressor, 4, 1024 * 1024, written.GetWriteFunction());
+
+        for (uint32_t i = 0; i < block_count; ++i)
+        {
+            const std::vector<uint8_t> data = MakeBlockData(i);
+
+            if ((i % 8) == 5)
+            {
+                // Blocks that are not compressed stay between the compressed blocks that were queued around them.
+                format::BlockHeader header = { sizeof(uint32_t), format::BlockType::kUnknownBlock };
+                const std::pair<const void*, size_t> parts[] = { { &header, sizeof(header) }, { &i, sizeof(i) } };
+                queue.QueueBlock(parts, 2);
+            }
+            else
+            {
+                queue.QueueFunctionCall(format::ApiCallId::ApiCall_vkCmdDraw, i, data.data(), data.size());
+            }
+        }
+
+        queue.Flush();
+
+        std::lock_guard<std::mutex> lock(written.mutex);
+        REQUIRE(written.blocks.size() == block_count);
+    }
+
+    for (uint32_t i = 0; i < block_count; ++i)
+    {
+        INFO("Block " << i);
+
+        const std::vector<uint8_t>& block = written.blocks[i];
+
+        if ((i % 8) == 5)
+        {
+            uint32_t value = 0;
+            REQUIRE(block.size() == (sizeof(format::BlockHeader) + sizeof(value)));
+            std::memcpy(&value, block.data() + sizeof(format::BlockHeader), sizeof(value));
+            REQUIRE(value == i);
+        }
+        else
+        {
+            CheckFunctionCallBlock(block, i);
+        }
+    }
+}
+
+TEST_CASE("BlockCompressionQueue - queueing waits while the queue is over its size limit", "[compression_queue]")
+{
+    RepeatedByteCompressor compressor;
+
+    std::mutex              gate_mutex;
+    std::condition_variable gate_condition;
+    bool                    gate_open = false;
+    std::atomic<uint32_t>   write_count{ 0 };
+    std::atomic<uint32_t>   queued_count{ 0 };
+
+    // The first write waits for the gate to open, which keeps its block and every block after it in the queue.
+    auto write_function = [&](const void*, size_t) {
+        std::unique_lock<std::mutex> lock(gate_mutex);
+        ++write_count;
+        gate_condition.wait(lock, [&]() { return gate_open; });
+    };
+
+    const size_t         block_size = 100;
+    std::vector<uint8_t> data(block_size, 1);
+
+    BlockCompressionQueue queue(&compressor, 2, block_size * 2, write_function);
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const std::pair<const void*, size_t> part = { data.data(), data.size() };
+            queue.QueueBlock(&part, 1);
+            ++queued_count;
+        }
+    });
+
+    while ((write_count == 0) || (queued_count < 2))
+    {
+        std::this_thread::yield();
+    }
+
+    // The block being written and the one after it fill the queue, so the third block can't be queued yet.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(queued_count == 2);
+
+    {
+        std::lock_guard<std::mutex> lock(gate_mutex);
+        gate_open = true;
+    }
+    gate_condition.notify_all();
+
+    producer.join();
+    queue.Flush();
+
+    REQUIRE(queued_count == 3);
+    REQUIRE(write_count == 3);
+
+    // A block that is larger than the limit is accepted when the queue is empty.
+    std::vector<uint8_t>                 large_data(block_size * 10, 2);
+    const std::pair<const void*, size_t> part = { large_data.data(), large_data.size() };
+    queue.QueueBlock(&part, 1);
+    queue.Flush();
+
+    REQUIRE(write_count == 4);
+}
+
+TEST_CASE("BlockCompressionQueue - pending blocks are written on destruction", "[compression_queue]")
+{
+    RepeatedByteCompressor compressor;
+    WrittenBlocks          written;
+    const uint32_t         block_count = 32;
+
+    {
+        BlockCompressionQueue queue(&compressor, 3, 1024 * 1024, written.GetWriteFunction());
+
+        for (uint32_t i = 0; i < block_count; ++i)
+        {
+            const std::vector<uint8_t> data = MakeBlockData(i);
+            queue.QueueFunctionCall(format::ApiCallId::ApiCall_vkCmdDraw, i, data.data(), data.size());
+        }
+
+        // The queue is destroyed while most blocks are still being compressed.
+    }
+
+    REQUIRE(written.blocks.size() == block_count);
+
+    for (uint32_t i = 0; i < block_count; ++i)
+    {
+        INFO("Block " << i);
+        CheckFunctionCallBlock(written.blocks[i], i);
+    }
+}
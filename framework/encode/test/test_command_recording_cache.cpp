@@ -0,0 +1,102 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "encode/command_recording_cache.h"
+#include "format/format.h"
+
+#include <cstdint>
+#include <vector>
+
+using gfxrecon::encode::CommandRecordingCache;
+
+TEST_CASE("CommandRecordingCache - identical recordings are found", "[recording_cache]")
+{
+    CommandRecordingCache cache(1024);
+
+    const std::vector<uint8_t> first  = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const std::vector<uint8_t> second = { 1, 2, 3, 4, 5, 6, 7, 9 };
+    uint32_t                   index  = 0;
+
+    // The first occurrence of each recording is a miss that assigns the next index.
+    REQUIRE_FALSE(cache.FindOrAdd(first.data(), first.size(), &index));
+    REQUIRE(index == 0);
+    REQUIRE_FALSE(cache.FindOrAdd(second.data(), second.size(), &index));
+    REQUIRE(index == 1);
+
+    // A prefix of a cached recording has different content.
+    REQUIRE_FALSE(cache.FindOrAdd(first.data(), first.size() - 1, &index));
+    REQUIRE(index == 2);
+
+    // Identical content is found regardless of the buffer that holds it.
+    const std::vector<uint8_t> copy = first;
+    REQUIRE(cache.FindOrAdd(copy.data(), copy.size(), &index));
+    REQUIRE(index == 0);
+    REQUIRE(cache.FindOrAdd(second.data(), second.size(), &index));
+    REQUIRE(index == 1);
+}
+
+TEST_CASE("CommandRecordingCache - recordings are not added when the budget is exhausted", "[recording_cache]")
+{
+    CommandRecordingCache cache(16);
+
+    const std::vector<uint8_t> first(10, 1);
+    const std::vector<uint8_t> second(10, 2);
+    const std::vector<uint8_t> third(6, 3);
+    uint32_t                   index = 0;
+
+    REQUIRE_FALSE(cache.FindOrAdd(first.data(), first.size(), &index));
+    REQUIRE(index == 0);
+
+    // The second recording would exceed the budget, so it cannot be referenced by later recordings.
+    REQUIRE_FALSE(cache.FindOrAdd(second.data(), second.size(), &index));
+    REQUIRE(index == gfxrecon::format::kUnreferencedCommandRecording);
+    REQUIRE_FALSE(cache.FindOrAdd(second.data(), second.size(), &index));
+    REQUIRE(index == gfxrecon::format::kUnreferencedCommandRecording);
+
+    // A recording that fits in the remaining budget is still added, and cached recordings are still found.
+    REQUIRE_FALSE(cache.FindOrAdd(third.data(), third.size(), &index));
+    REQUIRE(index == 1);
+    REQUIRE(cache.FindOrAdd(first.data(), first.size(), &index));
+    REQUIRE(index == 0);
+}
+
+TEST_CASE("CommandRecordingCache - clearing starts a new generation", "[recording_cache]")
+{
+    CommandRecordingCache cache(1024);
+
+    const std::vector<uint8_t> recording = { 4, 3, 2, 1 };
+    uint32_t                   index     = 0;
+
+    REQUIRE_FALSE(cache.FindOrAdd(recording.data(), recording.size(), &index));
+    const uint32_t generation = cache.GetGeneration();
+
+    cache.Clear();
+    REQUIRE(cache.GetGeneration() != generation);
+
+    // The recording belongs to the previous capture file, so it is added again with the first index.
+    REQUIRE_FALSE(cache.FindOrAdd(recording.data(), recording.size(), &index));
+    REQUIRE(index == 0);
+    REQUIRE(cache.FindOrAdd(recording.data(), recording.size(), &index));
+    REQUIRE(index == 0);
+}
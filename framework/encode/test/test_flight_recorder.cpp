@@ -0,0 +1,168 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "encode/flight_recorder.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <string>
+
+using gfxrecon::encode::FlightRecorder;
+
+namespace
+{
+
+class StringOutputStream : public gfxrecon::util::OutputStream
+{
+  public:
+    bool IsValid() override { return true; }
+
+    bool Write(const void* data, size_t len) override
+    {
+        contents.append(reinterpret_cast<const char*>(data), len);
+        return true;
+    }
+
+    std::string contents;
+};
+
+class FailingOutputStream : public gfxrecon::util::OutputStream
+{
+  public:
+    bool Write(const void*, size_t) override { return false; }
+};
+
+void Write(FlightRecorder* recorder, const std::string& data)
+{
+    recorder->Write(data.data(), data.size());
+}
+
+void WriteCheckpoint(FlightRecorder* recorder, uint32_t frame, const std::string& data)
+{
+    recorder->BeginCheckpoint(frame);
+    Write(recorder, data);
+    recorder->EndCheckpoint();
+}
+
+std::string WriteRecording(FlightRecorder* recorder)
+{
+    StringOutputStream output;
+    REQUIRE(recorder->WriteRecording(&output));
+    return output.contents;
+}
+
+} // namespace
+
+TEST_CASE("FlightRecorder - recording without checkpoints", "[flight_recorder]")
+{
+    FlightRecorder recorder(4, 2, 10);
+
+    REQUIRE(WriteRecording(&recorder).empty());
+
+    Write(&recorder, "b10,");
+    Write(&recorder, "b11,");
+
+    REQUIRE(WriteRecording(&recorder) == "b10,b11,");
+    REQUIRE(recorder.GetFirstFrame() == 10);
+    REQUIRE(recorder.GetDataSize() == 8);
+
+    REQUIRE_FALSE(recorder.IsCheckpointDue(11));
+    REQUIRE(recorder.IsCheckpointDue(12));
+}
+
+TEST_CASE("FlightRecorder - old segments are evicted once newer segments cover the frames", "[flight_recorder]")
+{
+    // Keeps at least four frames, with a checkpoint every two frames.
+    FlightRecorder recorder(4, 2, 0);
+
+    Write(&recorder, "b0,");
+    WriteCheckpoint(&recorder, 2, "c2,");
+    Write(&recorder, "b2,");
+    WriteCheckpoint(&recorder, 4, "c4,");
+    Write(&recorder, "b4,");
+
+    // Only the checkpoint of the oldest segment is written, followed by the blocks of every segment.
+    REQUIRE(recorder.GetFirstFrame() == 0);
+    REQUIRE(WriteRecording(&recorder) == "b0,b2,b4,");
+
+    // At frame 6, the segments from frame 2 cover the four frames, so the segment from frame 0 is released.
+    WriteCheckpoint(&recorder, 6, "c6,");
+    Write(&recorder, "b6,");
+
+    REQUIRE(recorder.GetFirstFrame() == 2);
+    REQUIRE(WriteRecording(&recorder) == "c2,b2,b4,b6,");
+
+    // The checkpoints of the later segments still count towards the data held by the recorder.
+    REQUIRE(recorder.GetDataSize() == std::string("c2,b2,c4,b4,c6,b6,").size());
+
+    WriteCheckpoint(&recorder, 8, "c8,");
+    Write(&recorder, "b8,");
+
+    REQUIRE(recorder.GetFirstFrame() == 4);
+    REQUIRE(WriteRecording(&recorder) == "c4,b4,b6,b8,");
+
+    // A checkpoint that is taken late releases every segment that is no longer needed.
+    WriteCheckpoint(&recorder, 20, "c20,");
+    Write(&recorder, "b20,");
+
+    REQUIRE(recorder.GetFirstFrame() == 8);
+    REQUIRE(WriteRecording(&recorder) == "c8,b8,b20,");
+}
+
+TEST_CASE("FlightRecorder - recording after a crash", "[flight_recorder]")
+{
+    FlightRecorder recorder(2, 1, 0);
+
+    Write(&recorder, "b0,");
+    WriteCheckpoint(&recorder, 1, "c1,");
+    Write(&recorder, "b1,");
+    WriteCheckpoint(&recorder, 2, "c2,");
+    Write(&recorder, "b2,");
+
+    StringOutputStream output;
+    REQUIRE(recorder.WriteRecordingAfterCrash(&output));
+    REQUIRE(output.contents == WriteRecording(&recorder));
+    REQUIRE(output.contents == "b0,b1,b2,");
+
+    FailingOutputStream failing_output;
+    REQUIRE_FALSE(recorder.WriteRecording(&failing_output));
+    REQUIRE_FALSE(recorder.WriteRecordingAfterCrash(&failing_output));
+}
+
+TEST_CASE("FlightRecorder - data larger than a chunk", "[flight_recorder]")
+{
+    FlightRecorder recorder(1, 1, 0);
+
+    const std::string checkpoint(FlightRecorder::kChunkSize + 17, 'c');
+    const std::string blocks(FlightRecorder::kChunkSize * 2 + 5, 'b');
+
+    WriteCheckpoint(&recorder, 1, checkpoint);
+    Write(&recorder, blocks);
+    WriteCheckpoint(&recorder, 2, "c2,");
+    Write(&recorder, "b2,");
+
+    // Compared as a single condition, so that a failure does not print the large strings.
+    REQUIRE(recorder.GetFirstFrame() == 1);
+    REQUIRE((WriteRecording(&recorder) == (checkpoint + blocks + "b2,")));
+}
@@ -0,0 +1,237 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "encode/ordered_block_writer.h"
+#include "format/format.h"
+#include "util/output_stream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using gfxrecon::encode::OrderedBlockWriter;
+
+namespace format = gfxrecon::format;
+
+namespace
+{
+
+class VectorOutputStream : public gfxrecon::util::OutputStream
+{
+  public:
+    bool IsValid() override { return true; }
+
+    bool Write(const void* data, size_t len) override
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        contents.insert(contents.end(), bytes, bytes + len);
+        return true;
+    }
+
+    std::vector<uint8_t> contents;
+};
+
+// Compresses data made of a single repeated byte to the byte and the data size, and leaves other data uncompressed.
+// Compression takes longer for lower block indices, stored in the first byte, so that later blocks complete before
+// earlier ones.
+class RepeatedByteCompressor : public gfxrecon::util::Compressor
+{
+  public:
+    size_t Compress(const size_t          uncompressed_size,
+                    const uint8_t*        uncompressed_data,
+                    std::vector<uint8_t>* compressed_data,
+                    size_t                compressed_data_offset) override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds((16 - (uncompressed_data[0] % 16)) * 100));
+
+        for (size_t i = 1; i < uncompressed_size; ++i)
+        {
+            if (uncompressed_data[i] != uncompressed_data[0])
+            {
+                return 0;
+            }
+        }
+
+        const uint64_t size = uncompressed_size;
+        compressed_data->resize(compressed_data_offset + 1 + sizeof(size));
+        (*compressed_data)[compressed_data_offset] = uncompressed_data[0];
+        std::memcpy(compressed_data->data() + compressed_data_offset + 1, &size, sizeof(size));
+        return 1 + sizeof(size);
+    }
+
+    size_t Decompress(const size_t                compressed_size,
+                      const std::vector<uint8_t>& compressed_data,
+                      const size_t                expected_uncompressed_size,
+                      std::vector<uint8_t>*       uncompressed_data) override
+    {
+        uncompressed_data->assign(expected_uncompressed_size, compressed_data[0]);
+        return expected_uncompressed_size;
+    }
+};
+
+// Even blocks repeat a single byte and can be compressed, odd blocks can't.
+std::vector<uint8_t> MakeBlockData(uint32_t index)
+{
+    std::vector<uint8_t> data(64 + (index % 5) * 200, static_cast<uint8_t>(index));
+    if ((index % 2) != 0)
+    {
+        data.back() = static_cast<uint8_t>(index + 1);
+    }
+    return data;
+}
+
+format::FillMemoryCommandHeader MakeHeader(uint32_t index, size_t data_size)
+{
+    format::FillMemoryCommandHeader header = {};
+    header.meta_header.block_header.type   = format::BlockType::kMetaDataBlock;
+    header.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kFillMemoryCommand);
+    header.memory_offset = index;
+    header.memory_size   = data_size;
+    return header;
+}
+
+// Submits the blocks, alternating between payloads that are moved to the writer and payloads that are referenced by
+// pointer, which are overwritten after submission to check that the writer made its own copy. Every third block has
+// an uncompressed prefix.
+void WriteBlocks(OrderedBlockWriter* writer, uint32_t block_count)
+{
+    for (uint32_t i = 0; i < block_count; ++i)
+    {
+        std::vector<uint8_t> data   = MakeBlockData(i);
+        const size_t         size   = data.size();
+        const auto           header = MakeHeader(i, size);
+        const uint32_t       prefix = i;
+
+        const void*  prefix_data = ((i % 3) == 0) ? &prefix : nullptr;
+        const size_t prefix_size = ((i % 3) == 0) ? sizeof(prefix) : 0;
+
+        if ((i % 4) < 2)
+        {
+            writer->WriteMetaDataBlock(header, prefix_data, prefix_size, std::move(data), size);
+        }
+        else
+        {
+            writer->WriteMetaDataBlock(header, prefix_data, prefix_size, data.data(), size);
+            std::fill(data.begin(), data.end(), 0xff);
+        }
+    }
+
+    writer->Flush();
+}
+
+// Checks that the output holds the blocks in submission order, compressed when expected.
+void CheckBlocks(const std::vector<uint8_t>& contents, uint32_t block_count, bool compressed)
+{
+    size_t offset = 0;
+
+    for (uint32_t i = 0; i < block_count; ++i)
+    {
+        INFO("Block " << i);
+
+        const std::vector<uint8_t> expected    = MakeBlockData(i);
+        const size_t               prefix_size = ((i % 3) == 0) ? sizeof(uint32_t) : 0;
+
+        format::FillMemoryCommandHeader header;
+        REQUIRE((contents.size() - offset) >= sizeof(header));
+        std::memcpy(&header, contents.data() + offset, sizeof(header));
+
+        const size_t block_size = sizeof(format::BlockHeader) + header.meta_header.block_header.size;
+        REQUIRE((contents.size() - offset) >= block_size);
+
+        REQUIRE(header.memory_offset == i);
+        REQUIRE(header.memory_size == expected.size());
+
+        const uint8_t* payload      = contents.data() + offset + sizeof(header) + prefix_size;
+        const size_t   payload_size = block_size - sizeof(header) - prefix_size;
+
+        if (prefix_size > 0)
+        {
+            uint32_t prefix = 0;
+            std::memcpy(&prefix, contents.data() + offset + sizeof(header), sizeof(prefix));
+            REQUIRE(prefix == i);
+        }
+
+        if (compressed && ((i % 2) == 0))
+        {
+            REQUIRE(header.meta_header.block_header.type == format::BlockType::kCompressedMetaDataBlock);
+            REQUIRE(payload_size == (1 + sizeof(uint64_t)));
+            REQUIRE(payload[0] == expected[0]);
+        }
+        else
+        {
+            REQUIRE(header.meta_header.block_header.type == format::BlockType::kMetaDataBlock);
+            REQUIRE(std::vector<uint8_t>(payload, payload + payload_size) == expected);
+        }
+
+        offset += block_size;
+    }
+
+    REQUIRE(offset == contents.size());
+}
+
+} // namespace
+
+TEST_CASE("OrderedBlockWriter - blocks completed out of order are written in submission order", "[block_writer]")
+{
+    RepeatedByteCompressor compressor;
+    VectorOutputStream     output;
+
+    // More blocks than the writer keeps pending, so that blocks are also written while others are submitted.
+    const uint32_t block_count = 48;
+
+    {
+        OrderedBlockWriter writer(&output, &compressor, 4);
+        REQUIRE(writer.GetThreadCount() == 4);
+        WriteBlocks(&writer, block_count);
+    }
+
+    CheckBlocks(output.contents, block_count, true);
+
+    // The output does not depend on the number of threads.
+    VectorOutputStream synchronous_output;
+
+    {
+        OrderedBlockWriter writer(&synchronous_output, &compressor, 0);
+        WriteBlocks(&writer, block_count);
+    }
+
+    REQUIRE(synchronous_output.contents == output.contents);
+}
+
+TEST_CASE("OrderedBlockWriter - blocks are written uncompressed without a compressor", "[block_writer]")
+{
+    VectorOutputStream output;
+    const uint32_t     block_count = 12;
+
+    {
+        OrderedBlockWriter writer(&output, nullptr, 4);
+        WriteBlocks(&writer, block_count);
+    }
+
+    CheckBlocks(output.contents, block_count, false);
+}
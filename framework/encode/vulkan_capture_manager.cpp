@@ -941,6 +941,49 @@ VulkanCaptureManager::OverrideCreateAccelerationStructureKHR(VkDevice
     return result;
 }
 
+bool VulkanCaptureManager::DeferCommandForDedup(VkCommandBuffer command_buffer, format::ApiCallId call_id)
+{
+    CommandRecordingCache* cache = GetCommandRecordingCache();
+    if (cache == nullptr)
+    {
+        return false;
+    }
+
+    auto wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(command_buffer);
+    GFXRECON_ASSERT(wrapper != nullptr);
+
+    if (call_id == format::ApiCallId::ApiCall_vkBeginCommandBuffer)
+    {
+        // The begin command is written as usual, as its parameters usually differ between recordings.
+        wrapper->dedup_recording.clear();
+        wrapper->dedup_generation = cache->GetGeneration();
+        wrapper->dedup_active     = IsCaptureModeWrite();
+        return false;
+    }
+
+    // Commands recorded before the capture file changed are part of the new file's state snapshot, and the commands
+    // that follow are written individually.
+    bool active =
+        wrapper->dedup_active && IsCaptureModeWrite() && (wrapper->dedup_generation == cache->GetGeneration());
+
+    if (active && (call_id != format::ApiCallId::ApiCall_vkEndCommandBuffer) &&
+        (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer))
+    {
+        AppendToCommandRecording(&wrapper->dedup_recording);
+        return true;
+    }
+
+    if (active && (call_id == format::ApiCallId::ApiCall_vkEndCommandBuffer))
+    {
+        WriteCommandBufferRecording(wrapper->handle_id, wrapper->dedup_recording);
+    }
+
+    wrapper->dedup_recording.clear();
+    wrapper->dedup_active = false;
+
+    return false;
+}
+
 void VulkanCaptureManager::OverrideCmdBuildAccelerationStructuresKHR(
     VkCommandBuffer                                        commandBuffer,
     uint32_t                                               infoCount,
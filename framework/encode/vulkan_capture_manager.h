@@ -231,6 +231,10 @@ class VulkanCaptureManager : public ApiCaptureManager
         }
     }
 
+    // Adds a command to the command buffer's deduplication recording instead of writing it to the capture file, and
+    // writes the recording on vkEndCommandBuffer. Returns true when the command was added to the recording.
+    bool DeferCommandForDedup(VkCommandBuffer command_buffer, format::ApiCallId call_id);
+
     void EndCommandApiCallCapture(VkCommandBuffer command_buffer)
     {
         auto thread_data = GetThreadData();
@@ -244,7 +248,10 @@ class VulkanCaptureManager : public ApiCaptureManager
 
         ProcessEndCommandApiCallCapture(command_buffer, thread_data->call_id_);
 
-        EndApiCallCapture();
+        if (!DeferCommandForDedup(command_buffer, thread_data->call_id_))
+        {
+            EndApiCallCapture();
+        }
     }
 
     template <typename GetHandlesFunc, typename... GetHandlesArgs>
@@ -262,7 +269,10 @@ class VulkanCaptureManager : public ApiCaptureManager
 
         ProcessEndCommandApiCallCapture(command_buffer, thread_data->call_id_);
 
-        EndApiCallCapture();
+        if (!DeferCommandForDedup(command_buffer, thread_data->call_id_))
+        {
+            EndApiCallCapture();
+        }
     }
 
     bool GetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate update_template,
@@ -369,6 +369,7 @@ inline void CreateWrappedHandle<DeviceWrapper, CommandPoolWrapper, CommandBuffer
 
     wrapper->layer_table_ref = &parent_wrapper->layer_table;
     wrapper->parent_pool     = co_parent_wrapper;
+    wrapper->command_data.SetArena(&co_parent_wrapper->command_data_arena);
     co_parent_wrapper->child_buffers.insert(std::make_pair(wrapper->handle_id, wrapper));
 }
 
@@ -30,6 +30,7 @@
 #include "format/format.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "graphics/vulkan_device_util.h"
+#include "util/chunk_arena.h"
 #include "util/defines.h"
 #include "util/memory_output_stream.h"
 #include "util/page_guard_manager.h"
@@ -397,8 +398,10 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     CommandPoolWrapper* parent_pool{ nullptr };
 
     // Members for trimming state tracking.
+    // Recorded commands are stored in chunks from the parent pool's command_data_arena, which are recycled when the
+    // command buffer is reset or freed.
     VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
+    util::ChunkedBuffer        command_data;
     std::set<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
 
     // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
@@ -419,6 +422,12 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     // Treat the sumbission of this command buffer as a frame boundary.
     bool is_frame_boundary{ false };
 
+    // Commands recorded since vkBeginCommandBuffer when command buffer deduplication is enabled. The commands are
+    // written as a single block on vkEndCommandBuffer, unless the capture file changed while they were recorded.
+    std::vector<uint8_t> dedup_recording;
+    uint32_t             dedup_generation{ 0 };
+    bool                 dedup_active{ false };
+
     // Corellation between TLASes that are being build in this command buffer and the device addresses
     // used to reference BLASes.
     struct tlas_build_info
@@ -465,8 +474,9 @@ struct CommandPoolWrapper : public HandleWrapper<VkCommandPool>
     // Members for trimming state tracking.
     uint32_t queue_family_index{ 0 };
 
-    DeviceWrapper* device{ nullptr };
-    bool           trim_command_pool{ false };
+    DeviceWrapper*   device{ nullptr };
+    bool             trim_command_pool{ false };
+    util::ChunkArena command_data_arena;
 };
 
 // For vkGetPhysicalDeviceSurfaceCapabilitiesKHR
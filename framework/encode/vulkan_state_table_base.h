@@ -25,13 +25,17 @@
 
 #include "encode/vulkan_handle_wrappers.h"
 #include "format/format.h"
+#include "format/format_util.h"
+#include "util/concurrent_pointer_map.h"
 #include "util/defines.h"
+#include "util/reader_biased_shared_mutex.h"
 
 #include "vulkan/vulkan.h"
 
 #include <cassert>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -73,44 +77,42 @@ class VulkanStateTableBase
         return (entry != map.end()) ? entry->second : nullptr;
     }
 
+    // The handle maps are read for nearly every handle parameter of every API call, and written only when handles are
+    // created or destroyed. Lookups only acquire the shared reclaim lock, which does not write to memory that is shared
+    // with other threads, and then probe the map without locking. Inserts and removals are serialized by write_mutex_,
+    // and the exclusive reclaim lock is only acquired to free a map table that was replaced when the map was resized.
     template <typename Wrapper>
-    bool InsertEntry(typename Wrapper::HandleType                                handle,
-                     Wrapper*                                                    wrapper,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool InsertEntry(typename Wrapper::HandleType handle, Wrapper* wrapper, util::ConcurrentPointerMap<Wrapper>& map)
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        const auto&                               inserted = map.insert(std::make_pair(handle, wrapper));
-        return inserted.second;
-    }
+        const std::lock_guard<std::mutex> lock(write_mutex_);
+        const bool                        inserted = map.Insert(format::ToHandleId(handle), wrapper);
 
-    template <typename Wrapper>
-    bool RemoveEntry(const typename Wrapper::HandleType                          handle,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
-    {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        return (map.erase(handle) != 0);
+        if (map.HasRetiredTables())
+        {
+            const std::unique_lock<util::ReaderBiasedSharedMutex> reclaim_lock(reclaim_mutex_);
+            map.ReclaimRetiredTables();
+        }
+
+        return inserted;
     }
 
     template <typename Wrapper>
-    Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                        const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool RemoveEntry(const typename Wrapper::HandleType handle, util::ConcurrentPointerMap<Wrapper>& map)
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        const std::lock_guard<std::mutex> lock(write_mutex_);
+        return map.Remove(format::ToHandleId(handle));
     }
 
     template <typename Wrapper>
-    const Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                              const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map) const
+    Wrapper* GetWrapper(typename Wrapper::HandleType handle, const util::ConcurrentPointerMap<Wrapper>& map) const
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        const std::shared_lock<util::ReaderBiasedSharedMutex> reclaim_lock(reclaim_mutex_);
+        return map.Find(format::ToHandleId(handle));
     }
 
   private:
-    mutable std::shared_mutex mutex_;
+    std::mutex                            write_mutex_;
+    mutable util::ReaderBiasedSharedMutex reclaim_mutex_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
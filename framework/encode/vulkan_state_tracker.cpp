@@ -82,10 +82,13 @@ void VulkanStateTracker::TrackCommandExecution(vulkan_wrappers::CommandBufferWra
     if (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer)
     {
         // Append the command data.
-        size_t size = parameter_buffer->GetDataSize();
-        wrapper->command_data.Write(&size, sizeof(size));
-        wrapper->command_data.Write(&call_id, sizeof(call_id));
-        wrapper->command_data.Write(parameter_buffer->GetData(), size);
+        size_t   size   = parameter_buffer->GetDataSize();
+        uint8_t* record = wrapper->command_data.Allocate(sizeof(size) + sizeof(call_id) + size);
+        util::platform::MemoryCopy(record, sizeof(size), &size, sizeof(size));
+        record += sizeof(size);
+        util::platform::MemoryCopy(record, sizeof(call_id), &call_id, sizeof(call_id));
+        record += sizeof(call_id);
+        util::platform::MemoryCopy(record, size, parameter_buffer->GetData(), size);
     }
 }
 
@@ -96,6 +99,9 @@ void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool com
     auto wrapper               = vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(command_pool);
     wrapper->trim_command_pool = true;
 
+    // Trimming the pool returns unused memory to the system, which includes the recycled command data chunks.
+    wrapper->command_data_arena.Trim();
+
     auto device_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceWrapper>(device);
     wrapper->device     = device_wrapper;
 }
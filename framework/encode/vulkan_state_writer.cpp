@@ -29,6 +29,7 @@
 #include "encode/vulkan_capture_common.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "util/hash.h"
 #include "util/logging.h"
 #include "custom_vulkan_array_size_2d.h"
 
@@ -48,6 +49,9 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 const uint32_t kDefaultQueueFamilyIndex = 0;
 
+// Buffers that are read back through a staging copy are batched until the total size of the batch reaches this limit.
+const VkDeviceSize kMaxStagingBatchSize = 32 * 1024 * 1024;
+
 static bool IsMemoryCoherent(VkMemoryPropertyFlags property_flags)
 {
     return ((property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
@@ -105,7 +109,8 @@ VulkanStateWriter::VulkanStateWriter(util::FileOutputStream*                  ou
 
 uint64_t VulkanStateWriter::WriteAssets(const VulkanStateTable& state_table)
 {
-    blocks_written_ = 0;
+    blocks_written_   = 0;
+    snapshot_timings_ = SnapshotTimings{};
 
     WriteResourceMemoryState(state_table, false);
     WriteDescriptorSetStateWithAssetFile(state_table);
@@ -117,6 +122,7 @@ uint64_t VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint
 {
     // clang-format off
     blocks_written_ = 0;
+    snapshot_timings_ = SnapshotTimings{};
 
     auto started = std::chrono::high_resolution_clock::now();
 
@@ -236,9 +242,12 @@ uint64_t VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint
 
     auto done = std::chrono::high_resolution_clock::now();
     uint32_t time = std::chrono::duration_cast<std::chrono::milliseconds>(done - started).count();
+    snapshot_timings_.total = std::chrono::duration<double, std::milli>(done - started).count();
     GFXRECON_LOG_INFO("--------------------------------------")
     GFXRECON_LOG_INFO("%s()", __func__)
     GFXRECON_LOG_INFO("  saved in %u ms", time);
+    GFXRECON_LOG_INFO("    resource memory: %.1f ms", snapshot_timings_.resource_memory);
+    GFXRECON_LOG_INFO("    other state:     %.1f ms", snapshot_timings_.total - snapshot_timings_.resource_memory);
     GFXRECON_LOG_INFO("--------------------------------------")
 
     return blocks_written_;
@@ -1024,8 +1033,8 @@ void VulkanStateWriter::WriteDescriptorSetStateWithAssetFile(const VulkanStateTa
             {
                 if (wrapper->dirty)
                 {
-                    const int64_t offset                       = asset_file_stream_->GetOffset();
-                    (*asset_file_offsets_)[wrapper->handle_id] = offset;
+                    const int64_t offset                              = asset_file_stream_->GetOffset();
+                    (*asset_file_offsets_)[wrapper->handle_id].offset = offset;
                     WriteFunctionCall(
                         wrapper->set_layout_dependency.create_call_id, dep_create_parameters, asset_file_stream_);
                     if (output_stream_ != nullptr)
@@ -1038,7 +1047,7 @@ void VulkanStateWriter::WriteDescriptorSetStateWithAssetFile(const VulkanStateTa
                     if (output_stream_ != nullptr)
                     {
                         assert((*asset_file_offsets_).find(wrapper->handle_id) != (*asset_file_offsets_).end());
-                        const int64_t offset = (*asset_file_offsets_)[wrapper->handle_id];
+                        const int64_t offset = (*asset_file_offsets_)[wrapper->handle_id].offset;
                         WriteExecuteFromFile(asset_file_name_, 1, offset);
                     }
                 }
@@ -1060,7 +1069,7 @@ void VulkanStateWriter::WriteDescriptorSetStateWithAssetFile(const VulkanStateTa
         else
         {
             assert((*asset_file_offsets_).find(wrapper->handle_id) != (*asset_file_offsets_).end());
-            offset = (*asset_file_offsets_)[wrapper->handle_id];
+            offset = (*asset_file_offsets_)[wrapper->handle_id].offset;
         }
 
         // Filter duplicate calls to vkAllocateDescriptorSets for descriptor sets that were allocated by the same
@@ -1153,8 +1162,8 @@ void VulkanStateWriter::WriteDescriptorSetStateWithAssetFile(const VulkanStateTa
 
         if (wrapper->dirty)
         {
-            wrapper->dirty                             = false;
-            (*asset_file_offsets_)[wrapper->handle_id] = offset;
+            wrapper->dirty                                    = false;
+            (*asset_file_offsets_)[wrapper->handle_id].offset = offset;
         }
     });
 
@@ -2005,102 +2014,147 @@ bool VulkanStateWriter::OutputStreamWrite(const void* data, size_t len)
     return output_stream_->Write(data, len);
 }
 
+format::InitBufferCommandHeader
+VulkanStateWriter::MakeInitBufferCommandHeader(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                               const vulkan_wrappers::BufferWrapper* buffer_wrapper)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
+
+    format::InitBufferCommandHeader upload_cmd;
+
+    upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+    upload_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+    upload_cmd.thread_id = thread_id_;
+    upload_cmd.device_id = device_wrapper->handle_id;
+    upload_cmd.buffer_id = buffer_wrapper->handle_id;
+    upload_cmd.data_size = static_cast<size_t>(buffer_wrapper->size);
+
+    return upload_cmd;
+}
+
+void VulkanStateWriter::ProcessBufferStagingBatch(const vulkan_wrappers::DeviceWrapper*         device_wrapper,
+                                                  const std::vector<const BufferSnapshotInfo*>& staging_batch,
+                                                  graphics::VulkanResourcesUtil&                resource_util,
+                                                  OrderedBlockWriter&                           block_writer)
+{
+    assert(!staging_batch.empty());
+
+    std::vector<graphics::VulkanResourcesUtil::BufferReadRegion> regions;
+    std::vector<std::vector<uint8_t>>                            data;
+
+    regions.reserve(staging_batch.size());
+    for (const BufferSnapshotInfo* snapshot_entry : staging_batch)
+    {
+        regions.push_back({ snapshot_entry->buffer_wrapper->handle, snapshot_entry->buffer_wrapper->size, 0 });
+    }
+
+    auto     started = std::chrono::high_resolution_clock::now();
+    VkResult result  = resource_util.ReadFromBufferResources(
+        regions, staging_batch.front()->buffer_wrapper->queue_family_index, data);
+    snapshot_timings_.resource_readback +=
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - started).count();
+
+    for (size_t i = 0; i < staging_batch.size(); ++i)
+    {
+        const vulkan_wrappers::BufferWrapper* buffer_wrapper = staging_batch[i]->buffer_wrapper;
+
+        if (result == VK_SUCCESS)
+        {
+            size_t data_size = static_cast<size_t>(buffer_wrapper->size);
+
+            block_writer.WriteMetaDataBlock(
+                MakeInitBufferCommandHeader(device_wrapper, buffer_wrapper), nullptr, 0, std::move(data[i]), data_size);
+            ++blocks_written_;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                               buffer_wrapper->handle_id);
+        }
+    }
+}
+
 void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                             const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                            graphics::VulkanResourcesUtil&         resource_util)
+                                            graphics::VulkanResourcesUtil&         resource_util,
+                                            OrderedBlockWriter&                    block_writer)
 {
     assert(device_wrapper != nullptr);
 
-    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
+    const VulkanDeviceTable*               device_table = &device_wrapper->layer_table;
+    std::vector<const BufferSnapshotInfo*> staging_batch;
+    VkDeviceSize                           staging_batch_size = 0;
 
     for (const auto& snapshot_entry : buffer_snapshot_info)
     {
         const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
         const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
 
         assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
 
         if (snapshot_entry.need_staging_copy)
         {
-            VkResult result = resource_util.ReadFromBufferResource(
-                buffer_wrapper->handle, buffer_wrapper->size, 0, buffer_wrapper->queue_family_index, data);
-
-            if (result == VK_SUCCESS)
+            // Buffers that need a staging copy are read back in batches, with one queue submission and fence wait per
+            // batch instead of per buffer.
+            if (!staging_batch.empty() && ((staging_batch_size + buffer_wrapper->size) > kMaxStagingBatchSize))
             {
-                bytes = data.data();
+                ProcessBufferStagingBatch(device_wrapper, staging_batch, resource_util, block_writer);
+                staging_batch.clear();
+                staging_batch_size = 0;
             }
+
+            staging_batch.push_back(&snapshot_entry);
+            staging_batch_size += buffer_wrapper->size;
+            continue;
         }
-        else
-        {
-            assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            VkResult result = VK_SUCCESS;
+        assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            if (memory_wrapper->mapped_data == nullptr)
-            {
-                void* map_ptr = nullptr;
-                result        = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 buffer_wrapper->bind_offset,
-                                                 buffer_wrapper->size,
-                                                 0,
-                                                 &map_ptr);
+        auto     started = std::chrono::high_resolution_clock::now();
+        VkResult result  = VK_SUCCESS;
 
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
-            }
+        if (memory_wrapper->mapped_data == nullptr)
+        {
+            void* map_ptr = nullptr;
+            result        = device_table->MapMemory(device_wrapper->handle,
+                                             memory_wrapper->handle,
+                                             buffer_wrapper->bind_offset,
+                                             buffer_wrapper->size,
+                                             0,
+                                             &map_ptr);
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+            if (result == VK_SUCCESS)
             {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
+                bytes = reinterpret_cast<const uint8_t*>(map_ptr);
             }
         }
-
-        if (bytes != nullptr)
+        else
         {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
-
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-            format::InitBufferCommandHeader upload_cmd;
-
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
-
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+            bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+        }
 
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+        {
+            InvalidateMappedMemoryRange(
+                device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
+        }
 
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
-            }
+        snapshot_timings_.resource_readback +=
+            std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - started).count();
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+        if (bytes != nullptr)
+        {
+            size_t data_size = static_cast<size_t>(buffer_wrapper->size);
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
+            // The block writer copies the data when it is compressed asynchronously, so the memory can be unmapped
+            // immediately.
+            block_writer.WriteMetaDataBlock(
+                MakeInitBufferCommandHeader(device_wrapper, buffer_wrapper), nullptr, 0, bytes, data_size);
             ++blocks_written_;
 
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+            if (memory_wrapper->mapped_data == nullptr)
             {
                 device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
@@ -2111,6 +2165,11 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
                                buffer_wrapper->handle_id);
         }
     }
+
+    if (!staging_batch.empty())
+    {
+        ProcessBufferStagingBatch(device_wrapper, staging_batch, resource_util, block_writer);
+    }
 }
 
 void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
@@ -2185,41 +2244,57 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
             {
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
 
-                size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-                format::InitBufferCommandHeader upload_cmd;
+                size_t         data_size   = static_cast<size_t>(buffer_wrapper->size);
+                const uint64_t data_hash   = util::hash::GenerateDataHash(bytes, data_size);
+                const auto     asset_entry = asset_file_offsets_->find(buffer_wrapper->handle_id);
 
-                upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-                upload_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
-                                                                             format::MetaDataType::kInitBufferCommand);
-                upload_cmd.thread_id                     = thread_id_;
-                upload_cmd.device_id                     = device_wrapper->handle_id;
-                upload_cmd.buffer_id                     = buffer_wrapper->handle_id;
-                upload_cmd.data_size                     = data_size;
-
-                if (compressor_ != nullptr)
+                if ((asset_entry != asset_file_offsets_->end()) && (asset_entry->second.data_hash == data_hash))
                 {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+                    // The buffer was marked dirty, but its contents match the data that was written to the asset file
+                    // for a previous trim range, so the existing asset file entry is reused.
+                    if (output_stream_ != nullptr)
+                    {
+                        WriteExecuteFromFile(asset_file_name_, 1, asset_entry->second.offset);
+                    }
+                }
+                else
+                {
+                    format::InitBufferCommandHeader upload_cmd;
+
+                    upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+                    upload_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(
+                        format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+                    upload_cmd.thread_id = thread_id_;
+                    upload_cmd.device_id = device_wrapper->handle_id;
+                    upload_cmd.buffer_id = buffer_wrapper->handle_id;
+                    upload_cmd.data_size = data_size;
 
-                    if ((compressed_size > 0) && (compressed_size < data_size))
+                    if (compressor_ != nullptr)
                     {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                        size_t compressed_size =
+                            compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
+                        if ((compressed_size > 0) && (compressed_size < data_size))
+                        {
+                            upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                            bytes     = compressed_parameter_buffer_.data();
+                            data_size = compressed_size;
+                        }
                     }
-                }
 
-                // Calculate size of packet with compressed or uncompressed data size.
-                upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+                    // Calculate size of packet with compressed or uncompressed data size.
+                    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
 
-                const int64_t offset = asset_file_stream_->GetOffset();
-                asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                asset_file_stream_->Write(bytes, data_size);
-                (*asset_file_offsets_)[buffer_wrapper->handle_id] = offset;
+                    const int64_t offset = asset_file_stream_->GetOffset();
+                    asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                    asset_file_stream_->Write(bytes, data_size);
+                    (*asset_file_offsets_)[buffer_wrapper->handle_id] = { offset, data_hash };
 
-                if (output_stream_ != nullptr)
-                {
-                    WriteExecuteFromFile(asset_file_name_, 1, offset);
+                    if (output_stream_ != nullptr)
+                    {
+                        WriteExecuteFromFile(asset_file_name_, 1, offset);
+                    }
                 }
 
                 if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
@@ -2238,7 +2313,7 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
             if (output_stream_ != nullptr)
             {
                 assert((*asset_file_offsets_).find(buffer_wrapper->handle_id) != (*asset_file_offsets_).end());
-                const int64_t offset = (*asset_file_offsets_)[buffer_wrapper->handle_id];
+                const int64_t offset = (*asset_file_offsets_)[buffer_wrapper->handle_id].offset;
                 WriteExecuteFromFile(asset_file_name_, 1, offset);
             }
         }
@@ -2247,7 +2322,8 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
 
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                            const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                           graphics::VulkanResourcesUtil&        resource_util)
+                                           graphics::VulkanResourcesUtil&        resource_util,
+                                           OrderedBlockWriter&                   block_writer)
 {
     assert(device_wrapper != nullptr);
 
@@ -2263,6 +2339,8 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
         assert((image_wrapper != nullptr) && ((image_wrapper->is_swapchain_image && memory_wrapper == nullptr) ||
                                               (!image_wrapper->is_swapchain_image && memory_wrapper != nullptr)));
 
+        auto started = std::chrono::high_resolution_clock::now();
+
         if (snapshot_entry.need_staging_copy)
         {
             std::vector<uint64_t> subresource_offsets;
@@ -2325,12 +2403,13 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
             }
         }
 
+        snapshot_timings_.resource_readback +=
+            std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - started).count();
+
         if (!image_wrapper->is_swapchain_image)
         {
             format::InitImageCommandHeader upload_cmd;
 
-            // Packet size without the resource data.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
             upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
             upload_cmd.meta_header.meta_data_id =
                 format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
@@ -2350,29 +2429,20 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = data_size;
                 upload_cmd.level_count = image_wrapper->mip_levels;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
-
-                // Calculate size of packet with compressed or uncompressed data size.
                 assert(!snapshot_entry.level_sizes.empty() &&
                        (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
                 size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                upload_cmd.meta_header.block_header.size += levels_size + data_size;
-
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                output_stream_->Write(bytes, data_size);
+                if (snapshot_entry.need_staging_copy)
+                {
+                    block_writer.WriteMetaDataBlock(
+                        upload_cmd, snapshot_entry.level_sizes.data(), levels_size, std::move(data), data_size);
+                }
+                else
+                {
+                    block_writer.WriteMetaDataBlock(
+                        upload_cmd, snapshot_entry.level_sizes.data(), levels_size, bytes, data_size);
+                }
 
                 if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
                 {
@@ -2386,7 +2456,7 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = 0;
                 upload_cmd.level_count = 0;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                block_writer.WriteMetaDataBlock(upload_cmd, nullptr, 0, nullptr, 0);
             }
 
             ++blocks_written_;
@@ -2504,40 +2574,60 @@ void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::D
 
                     size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
 
-                    // Store uncompressed data size in packet.
-                    upload_cmd.data_size   = data_size;
-                    upload_cmd.level_count = image_wrapper->mip_levels;
+                    // The layout and aspect are stored in the asset file entry with the image data, so they are
+                    // included in the hash.
+                    const uint64_t hash_seed =
+                        (static_cast<uint64_t>(upload_cmd.layout) << 32) | static_cast<uint64_t>(upload_cmd.aspect);
+                    const uint64_t data_hash   = util::hash::GenerateDataHash(bytes, data_size, hash_seed);
+                    const auto     asset_entry = asset_file_offsets_->find(image_wrapper->handle_id);
 
-                    if (compressor_ != nullptr)
+                    if ((asset_entry != asset_file_offsets_->end()) && (asset_entry->second.data_hash == data_hash))
                     {
-                        size_t compressed_size =
-                            compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+                        // The image was marked dirty, but its contents match the data that was written to the asset
+                        // file for a previous trim range, so the existing asset file entry is reused.
+                        if (output_stream_ != nullptr)
+                        {
+                            WriteExecuteFromFile(asset_file_name_, 1, asset_entry->second.offset);
+                        }
+                    }
+                    else
+                    {
+                        // Store uncompressed data size in packet.
+                        upload_cmd.data_size   = data_size;
+                        upload_cmd.level_count = image_wrapper->mip_levels;
 
-                        if ((compressed_size > 0) && (compressed_size < data_size))
+                        if (compressor_ != nullptr)
                         {
-                            upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                            size_t compressed_size =
+                                compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-                            bytes     = compressed_parameter_buffer_.data();
-                            data_size = compressed_size;
+                            if ((compressed_size > 0) && (compressed_size < data_size))
+                            {
+                                upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+                                bytes     = compressed_parameter_buffer_.data();
+                                data_size = compressed_size;
+                            }
                         }
-                    }
 
-                    // Calculate size of packet with compressed or uncompressed data size.
-                    assert(!snapshot_entry.level_sizes.empty() &&
-                           (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
-                    size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+                        // Calculate size of packet with compressed or uncompressed data size.
+                        assert(!snapshot_entry.level_sizes.empty() &&
+                               (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
+                        size_t levels_size =
+                            snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                    upload_cmd.meta_header.block_header.size += levels_size + data_size;
+                        upload_cmd.meta_header.block_header.size += levels_size + data_size;
 
-                    const int64_t offset                             = asset_file_stream_->GetOffset();
-                    (*asset_file_offsets_)[image_wrapper->handle_id] = offset;
-                    asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                    asset_file_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                    asset_file_stream_->Write(bytes, data_size);
+                        const int64_t offset                             = asset_file_stream_->GetOffset();
+                        (*asset_file_offsets_)[image_wrapper->handle_id] = { offset, data_hash };
+                        asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                        asset_file_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
+                        asset_file_stream_->Write(bytes, data_size);
 
-                    if (output_stream_ != nullptr)
-                    {
-                        WriteExecuteFromFile(asset_file_name_, 1, offset);
+                        if (output_stream_ != nullptr)
+                        {
+                            WriteExecuteFromFile(asset_file_name_, 1, offset);
+                        }
                     }
 
                     if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
@@ -2565,7 +2655,7 @@ void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::D
             if (output_stream_ != nullptr)
             {
                 assert((*asset_file_offsets_).find(image_wrapper->handle_id) != (*asset_file_offsets_).end());
-                const int64_t offset = (*asset_file_offsets_)[image_wrapper->handle_id];
+                const int64_t offset = (*asset_file_offsets_)[image_wrapper->handle_id].offset;
                 WriteExecuteFromFile(asset_file_name_, 1, offset);
             }
         }
@@ -2905,18 +2995,33 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
                 ++blocks_written_;
             }
 
-            for (const auto& queue_family_entry : resource_entry.second)
+            if (asset_file_stream_ != nullptr)
             {
-                if (asset_file_stream_ != nullptr)
+                for (const auto& queue_family_entry : resource_entry.second)
                 {
                     ProcessBufferMemoryWithAssetFile(device_wrapper, queue_family_entry.second.buffers, resource_util);
                     ProcessImageMemoryWithAssetFile(device_wrapper, queue_family_entry.second.images, resource_util);
                 }
-                else
+            }
+            else
+            {
+                // Resource data is compressed on worker threads while the next resource is read back, and written in
+                // submission order.
+                OrderedBlockWriter block_writer(
+                    output_stream_, compressor_, OrderedBlockWriter::GetDefaultThreadCount());
+
+                for (const auto& queue_family_entry : resource_entry.second)
                 {
-                    ProcessBufferMemory(device_wrapper, queue_family_entry.second.buffers, resource_util);
-                    ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util);
+                    ProcessBufferMemory(
+                        device_wrapper, queue_family_entry.second.buffers, resource_util, block_writer);
+                    ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util, block_writer);
                 }
+
+                block_writer.Flush();
+
+                snapshot_timings_.resource_compression += block_writer.GetCompressTime();
+                snapshot_timings_.resource_write += block_writer.GetWriteTime();
+                snapshot_timings_.compression_threads = block_writer.GetThreadCount();
             }
 
             if (output_stream_ != nullptr)
@@ -2942,9 +3047,16 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
     auto     done = std::chrono::high_resolution_clock::now();
     uint32_t time = std::chrono::duration_cast<std::chrono::milliseconds>(done - started).count();
 
+    snapshot_timings_.resource_memory += std::chrono::duration<double, std::milli>(done - started).count();
+
     GFXRECON_LOG_INFO("--------------------------------------")
     GFXRECON_LOG_INFO("%s()", __func__)
     GFXRECON_LOG_INFO("  saved in %u ms", time);
+    GFXRECON_LOG_INFO("    readback:    %.1f ms", snapshot_timings_.resource_readback);
+    GFXRECON_LOG_INFO("    compression: %.1f ms (%u worker threads)",
+                      snapshot_timings_.resource_compression,
+                      snapshot_timings_.compression_threads);
+    GFXRECON_LOG_INFO("    write:       %.1f ms", snapshot_timings_.resource_write);
     GFXRECON_LOG_INFO("--------------------------------------")
 }
 
@@ -3393,26 +3505,33 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
 
     if (CheckCommandHandles(wrapper, state_table))
     {
-        // Replay each of the commands that was recorded for the command buffer.
-        size_t         offset    = 0;
-        size_t         data_size = wrapper->command_data.GetDataSize();
-        const uint8_t* data      = wrapper->command_data.GetData();
+        // Replay each of the commands that was recorded for the command buffer. Commands never span chunks.
+        const util::ChunkArena::Chunk* chunk = wrapper->command_data.GetFirstChunk();
 
-        while (offset < data_size)
+        while (chunk != nullptr)
         {
-            const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
-            const format::ApiCallId* call_id =
-                reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
-            const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
+            size_t         offset    = 0;
+            size_t         data_size = chunk->size;
+            const uint8_t* data      = chunk->GetData();
 
-            parameter_stream_.Write(parameter_data, (*parameter_size));
-            WriteFunctionCall((*call_id), &parameter_stream_);
-            parameter_stream_.Clear();
+            while (offset < data_size)
+            {
+                const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
+                const format::ApiCallId* call_id =
+                    reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
+                const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
 
-            offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
-        }
+                parameter_stream_.Write(parameter_data, (*parameter_size));
+                WriteFunctionCall((*call_id), &parameter_stream_);
+                parameter_stream_.Clear();
+
+                offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
+            }
 
-        assert(offset == data_size);
+            assert(offset == data_size);
+
+            chunk = chunk->next;
+        }
     }
 }
 
@@ -24,6 +24,7 @@
 #ifndef GFXRECON_ENCODE_VULKAN_STATE_WRITER_H
 #define GFXRECON_ENCODE_VULKAN_STATE_WRITER_H
 
+#include "encode/ordered_block_writer.h"
 #include "encode/parameter_encoder.h"
 #include "encode/vulkan_handle_wrappers.h"
 #include "generated/generated_vulkan_state_table.h"
@@ -49,7 +50,25 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    using AssetFileOffsetsInfo = std::unordered_map<uint64_t, int64_t>;
+    struct AssetFileOffset
+    {
+        int64_t  offset{ 0 };
+        uint64_t data_hash{ 0 }; // Hash of the buffer or image contents stored at offset.
+    };
+
+    using AssetFileOffsetsInfo = std::unordered_map<uint64_t, AssetFileOffset>;
+
+    // Time spent in the phases of the last state snapshot, in milliseconds. Compression time is summed over the worker
+    // threads and overlaps with resource readback.
+    struct SnapshotTimings
+    {
+        double   total{ 0 };
+        double   resource_memory{ 0 };
+        double   resource_readback{ 0 };
+        double   resource_compression{ 0 };
+        double   resource_write{ 0 };
+        uint32_t compression_threads{ 0 };
+    };
 
     VulkanStateWriter(util::FileOutputStream*                  output_stream,
                       util::Compressor*                        compressor,
@@ -68,6 +87,8 @@ class VulkanStateWriter
 
     void WriteFillMemoryCmd(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size, const void* data);
 
+    const SnapshotTimings& GetSnapshotTimings() const { return snapshot_timings_; }
+
   private:
     // Data structures for processing resource memory snapshots.
     struct BufferSnapshotInfo
@@ -166,7 +187,16 @@ class VulkanStateWriter
 
     void ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                              const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                             graphics::VulkanResourcesUtil&         resource_util);
+                             graphics::VulkanResourcesUtil&         resource_util,
+                             OrderedBlockWriter&                    block_writer);
+
+    void ProcessBufferStagingBatch(const vulkan_wrappers::DeviceWrapper*         device_wrapper,
+                                   const std::vector<const BufferSnapshotInfo*>& staging_batch,
+                                   graphics::VulkanResourcesUtil&                resource_util,
+                                   OrderedBlockWriter&                           block_writer);
+
+    format::InitBufferCommandHeader MakeInitBufferCommandHeader(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                                                const vulkan_wrappers::BufferWrapper* buffer_wrapper);
 
     void ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                           const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
@@ -174,7 +204,8 @@ class VulkanStateWriter
 
     void ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                            graphics::VulkanResourcesUtil&        resource_util);
+                            graphics::VulkanResourcesUtil&        resource_util,
+                            OrderedBlockWriter&                   block_writer);
 
     void ProcessImageMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                          const std::vector<ImageSnapshotInfo>& image_snapshot_info,
@@ -431,6 +462,7 @@ class VulkanStateWriter
     util::MemoryOutputStream parameter_stream_;
     ParameterEncoder         encoder_;
     uint64_t                 blocks_written_{ 0 };
+    SnapshotTimings          snapshot_timings_;
 
     // helper to retrieve a unique id, e.g. from a CaptureManager
     std::function<format::HandleId()> get_unique_id_;
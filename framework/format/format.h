@@ -65,6 +65,9 @@ const HandleId kNullHandleId              = 0;
 const size_t   kAdapterDescriptionSize    = 128;
 const int8_t   kNoneIndex                 = -1;
 
+/// Recording index of a CommandBufferRecording block whose recording is not kept for reuse by later blocks.
+const uint32_t kUnreferencedCommandRecording = 0xffffffff;
+
 /// Label for operation annotation, which captures parameters used by tools
 /// operating on a capture file.
 const char* const kAnnotationLabelOperation          = "operation";
@@ -73,6 +76,10 @@ const char* const kAnnotationLabelRemovedResource    = "removed-resource";
 const char* const kAnnotationLabelTransformer        = "transformer";
 const char* const kAnnotationPipelineCreationAttempt = "pipelinecreationattempt";
 
+/// Label for the annotation at the start of each file of a segmented capture, which names the file of the following
+/// segment so that it can be prefetched before the ExecuteBlocksFromFile block at the end of the file is reached.
+const char* const kAnnotationLabelNextSegment = "next-segment";
+
 const char* const kOperationAnnotationGfxreconstructVersion = "gfxrecon-version";
 const char* const kOperationAnnotationVulkanVersion         = "vulkan-version";
 const char* const kOperationAnnotationTimestamp             = "timestamp";
@@ -156,7 +163,8 @@ enum class MetaDataType : uint16_t
     kReserved31                             = 31,
     kSetEnvironmentVariablesCommand         = 32,
     kViewRelativeLocation                   = 33,
-    kExecuteBlocksFromFile                  = 34
+    kExecuteBlocksFromFile                  = 34,
+    kCommandBufferRecording                 = 35
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -695,6 +703,26 @@ struct ExecuteBlocksFromFile
     uint32_t filename_length;
 };
 
+// Commands recorded to a command buffer between its begin and end commands, written as a single block when command
+// buffer deduplication is enabled. The recorded commands are function call blocks with the thread ID and the command
+// buffer handle ID, which is the first parameter of each command, set to zero. The block either carries the recorded
+// blocks, or references the blocks of an earlier recording with identical content when recording_size is zero. The
+// thread_id and command_buffer_id are patched into the blocks when they are processed. Each recorded command is counted
+// as a block for block indices, following the index of the CommandBufferRecording block.
+struct CommandBufferRecording
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    format::HandleId command_buffer_id;
+
+    // Index that identifies the recording, or kUnreferencedCommandRecording when the recording cannot be referenced.
+    uint32_t recording_index;
+
+    // Uncompressed size of the recorded blocks that follow the header, or 0 to process the blocks of a previous
+    // recording with the same index.
+    uint64_t recording_size;
+};
+
 // Restore size_t to normal behavior.
 #undef size_t
 
@@ -1356,26 +1356,7 @@ void VulkanCppConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    FILE* file = GetFrameFile();
-    fprintf(file, "\t{\n");
-    std::string pdata_array = "pData_" + std::to_string(this->GetNextId());
-    if (dataSize > 0) {
-        std::string pdata_values = toStringJoin(pData->GetPointer(),
-                                                pData->GetPointer() + dataSize,
-                                                [&](const auto current) { return std::to_string(current) + ""; },
-                                                ", ");
-        fprintf(file, "\t\tuint8_t %s[] = { %s };\n", pdata_array.c_str(), pdata_values.c_str());
-    } else {
-        pdata_array = "NULL";
-    }
-    fprintf(file,
-            "\t\tvkCmdUpdateBuffer(%s, %s, %" PRIu64 "UL, %" PRIu64 "UL, %s);\n",
-            this->GetHandle(commandBuffer).c_str(),
-            this->GetHandle(dstBuffer).c_str(),
-            dstOffset,
-            dataSize,
-            pdata_array.c_str());
-    fprintf(file, "\t}\n");
+    Generate_vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     Post_APICall(format::ApiCallId::ApiCall_vkCmdUpdateBuffer);
 }
 
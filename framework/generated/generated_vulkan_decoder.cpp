@@ -16248,6 +16248,246 @@ void VulkanDecoder::DecodeFunctionCall(format::ApiCallId             call_id,
     }
 }
 
+bool VulkanDecoder::IsCommandRecordingCall(format::ApiCallId call_id) const
+{
+    switch(call_id)
+    {
+    case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+    case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+    case format::ApiCallId::ApiCall_vkCmdSetViewport:
+    case format::ApiCallId::ApiCall_vkCmdSetScissor:
+    case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+    case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+    case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+    case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+    case format::ApiCallId::ApiCall_vkCmdDraw:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+    case format::ApiCallId::ApiCall_vkCmdDispatch:
+    case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+    case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+    case format::ApiCallId::ApiCall_vkCmdCopyImage:
+    case format::ApiCallId::ApiCall_vkCmdBlitImage:
+    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+    case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+    case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+    case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+    case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+    case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+    case format::ApiCallId::ApiCall_vkCmdResolveImage:
+    case format::ApiCallId::ApiCall_vkCmdSetEvent:
+    case format::ApiCallId::ApiCall_vkCmdResetEvent:
+    case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+    case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+    case format::ApiCallId::ApiCall_vkCmdEndQuery:
+    case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+    case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+    case format::ApiCallId::ApiCall_vkCmdPushConstants:
+    case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+    case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+    case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
+    case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+    case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+    case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+    case format::ApiCallId::ApiCall_vkCmdSetEvent2:
+    case format::ApiCallId::ApiCall_vkCmdResetEvent2:
+    case format::ApiCallId::ApiCall_vkCmdWaitEvents2:
+    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2:
+    case format::ApiCallId::ApiCall_vkCmdCopyBuffer2:
+    case format::ApiCallId::ApiCall_vkCmdCopyImage2:
+    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2:
+    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2:
+    case format::ApiCallId::ApiCall_vkCmdBlitImage2:
+    case format::ApiCallId::ApiCall_vkCmdResolveImage2:
+    case format::ApiCallId::ApiCall_vkCmdBeginRendering:
+    case format::ApiCallId::ApiCall_vkCmdEndRendering:
+    case format::ApiCallId::ApiCall_vkCmdSetCullMode:
+    case format::ApiCallId::ApiCall_vkCmdSetFrontFace:
+    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopology:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportWithCount:
+    case format::ApiCallId::ApiCall_vkCmdSetScissorWithCount:
+    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOp:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilOp:
+    case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnable:
+    case format::ApiCallId::ApiCall_vkCmdSetLineStipple:
+    case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer2:
+    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet:
+    case format::ApiCallId::ApiCall_vkCmdSetRenderingAttachmentLocations:
+    case format::ApiCallId::ApiCall_vkCmdSetRenderingInputAttachmentIndices:
+    case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2:
+    case format::ApiCallId::ApiCall_vkCmdPushConstants2:
+    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet2:
+    case format::ApiCallId::ApiCall_vkCmdBeginVideoCodingKHR:
+    case format::ApiCallId::ApiCall_vkCmdEndVideoCodingKHR:
+    case format::ApiCallId::ApiCall_vkCmdControlVideoCodingKHR:
+    case format::ApiCallId::ApiCall_vkCmdDecodeVideoKHR:
+    case format::ApiCallId::ApiCall_vkCmdBeginRenderingKHR:
+    case format::ApiCallId::ApiCall_vkCmdEndRenderingKHR:
+    case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+    case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+    case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+    case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+    case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
+    case format::ApiCallId::ApiCall_vkCmdSetRenderingAttachmentLocationsKHR:
+    case format::ApiCallId::ApiCall_vkCmdSetRenderingInputAttachmentIndicesKHR:
+    case format::ApiCallId::ApiCall_vkCmdEncodeVideoKHR:
+    case format::ApiCallId::ApiCall_vkCmdSetEvent2KHR:
+    case format::ApiCallId::ApiCall_vkCmdResetEvent2KHR:
+    case format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR:
+    case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR:
+    case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+    case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+    case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+    case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+    case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+    case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+    case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer2KHR:
+    case format::ApiCallId::ApiCall_vkCmdSetLineStippleKHR:
+    case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2KHR:
+    case format::ApiCallId::ApiCall_vkCmdPushConstants2KHR:
+    case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet2KHR:
+    case format::ApiCallId::ApiCall_vkCmdSetDescriptorBufferOffsets2EXT:
+    case format::ApiCallId::ApiCall_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT:
+    case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+    case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+    case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+    case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+    case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+    case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+    case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+    case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+    case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+    case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+    case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+    case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+    case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+    case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+    case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+    case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+    case format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+    case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+    case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+    case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+    case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+    case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+    case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+    case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+    case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+    case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBias2EXT:
+    case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+    case format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT:
+    case format::ApiCallId::ApiCall_vkCmdBindInvocationMaskHUAWEI:
+    case format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawMultiEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT:
+    case format::ApiCallId::ApiCall_vkCmdBuildMicromapsEXT:
+    case format::ApiCallId::ApiCall_vkCmdCopyMicromapEXT:
+    case format::ApiCallId::ApiCall_vkCmdCopyMicromapToMemoryEXT:
+    case format::ApiCallId::ApiCall_vkCmdCopyMemoryToMicromapEXT:
+    case format::ApiCallId::ApiCall_vkCmdWriteMicromapsPropertiesEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawClusterHUAWEI:
+    case format::ApiCallId::ApiCall_vkCmdDrawClusterIndirectHUAWEI:
+    case format::ApiCallId::ApiCall_vkCmdUpdatePipelineIndirectBufferNV:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthClampEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetPolygonModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetRasterizationSamplesEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetSampleMaskEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetAlphaToCoverageEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetAlphaToOneEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetLogicOpEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetColorBlendEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetColorBlendEquationEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetColorWriteMaskEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetTessellationDomainOriginEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetRasterizationStreamEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetConservativeRasterizationModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetExtraPrimitiveOverestimationSizeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthClipEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetColorBlendAdvancedEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetProvokingVertexModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetLineRasterizationModeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetLineStippleEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthClipNegativeOneToOneEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetViewportSwizzleNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorLocationNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationModeNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetShadingRateImageEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetRepresentativeFragmentTestEnableNV:
+    case format::ApiCallId::ApiCall_vkCmdSetCoverageReductionModeNV:
+    case format::ApiCallId::ApiCall_vkCmdOpticalFlowExecuteNV:
+    case format::ApiCallId::ApiCall_vkCmdBindShadersEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetDepthClampRangeEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetAttachmentFeedbackLoopEnableEXT:
+    case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsEXT:
+    case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsEXT:
+    case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectEXT:
+    case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountEXT:
+        return true;
+    default:
+        return false;
+    }
+}
+
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
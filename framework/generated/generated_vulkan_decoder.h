@@ -57,6 +57,8 @@ class VulkanDecoder : public VulkanDecoderBase
                                     const uint8_t*                parameter_buffer,
                                     size_t                        buffer_size) override;
 
+    virtual bool IsCommandRecordingCall(format::ApiCallId call_id) const override;
+
   private:
     size_t Decode_vkCreateInstance(const ApiCallInfo& call_info, const uint8_t* parameter_buffer, size_t buffer_size);
 
@@ -287,6 +287,58 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void VisitVkVideoSessionKHRInfo(std::function<void(const VulkanVideoSessionKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionKHR_map_) { visitor(&entry.second); }  }
     void VisitVkVideoSessionParametersKHRInfo(std::function<void(const VulkanVideoSessionParametersKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionParametersKHR_map_) { visitor(&entry.second); }  }
 
+    void GetMemoryUsage(std::vector<ObjectInfoMemoryUsage>* usage) const
+    {
+        AddMemoryUsage("VkAccelerationStructureKHR", accelerationStructureKHR_map_, usage);
+        AddMemoryUsage("VkAccelerationStructureNV", accelerationStructureNV_map_, usage);
+        AddMemoryUsage("VkBuffer", buffer_map_, usage);
+        AddMemoryUsage("VkBufferView", bufferView_map_, usage);
+        AddMemoryUsage("VkCommandBuffer", commandBuffer_map_, usage);
+        AddMemoryUsage("VkCommandPool", commandPool_map_, usage);
+        AddMemoryUsage("VkDebugReportCallbackEXT", debugReportCallbackEXT_map_, usage);
+        AddMemoryUsage("VkDebugUtilsMessengerEXT", debugUtilsMessengerEXT_map_, usage);
+        AddMemoryUsage("VkDeferredOperationKHR", deferredOperationKHR_map_, usage);
+        AddMemoryUsage("VkDescriptorPool", descriptorPool_map_, usage);
+        AddMemoryUsage("VkDescriptorSet", descriptorSet_map_, usage);
+        AddMemoryUsage("VkDescriptorSetLayout", descriptorSetLayout_map_, usage);
+        AddMemoryUsage("VkDescriptorUpdateTemplate", descriptorUpdateTemplate_map_, usage);
+        AddMemoryUsage("VkDevice", device_map_, usage);
+        AddMemoryUsage("VkDeviceMemory", deviceMemory_map_, usage);
+        AddMemoryUsage("VkDisplayKHR", displayKHR_map_, usage);
+        AddMemoryUsage("VkDisplayModeKHR", displayModeKHR_map_, usage);
+        AddMemoryUsage("VkEvent", event_map_, usage);
+        AddMemoryUsage("VkFence", fence_map_, usage);
+        AddMemoryUsage("VkFramebuffer", framebuffer_map_, usage);
+        AddMemoryUsage("VkImage", image_map_, usage);
+        AddMemoryUsage("VkImageView", imageView_map_, usage);
+        AddMemoryUsage("VkIndirectCommandsLayoutEXT", indirectCommandsLayoutEXT_map_, usage);
+        AddMemoryUsage("VkIndirectCommandsLayoutNV", indirectCommandsLayoutNV_map_, usage);
+        AddMemoryUsage("VkIndirectExecutionSetEXT", indirectExecutionSetEXT_map_, usage);
+        AddMemoryUsage("VkInstance", instance_map_, usage);
+        AddMemoryUsage("VkMicromapEXT", micromapEXT_map_, usage);
+        AddMemoryUsage("VkOpticalFlowSessionNV", opticalFlowSessionNV_map_, usage);
+        AddMemoryUsage("VkPerformanceConfigurationINTEL", performanceConfigurationINTEL_map_, usage);
+        AddMemoryUsage("VkPhysicalDevice", physicalDevice_map_, usage);
+        AddMemoryUsage("VkPipeline", pipeline_map_, usage);
+        AddMemoryUsage("VkPipelineBinaryKHR", pipelineBinaryKHR_map_, usage);
+        AddMemoryUsage("VkPipelineCache", pipelineCache_map_, usage);
+        AddMemoryUsage("VkPipelineLayout", pipelineLayout_map_, usage);
+        AddMemoryUsage("VkPrivateDataSlot", privateDataSlot_map_, usage);
+        AddMemoryUsage("VkQueryPool", queryPool_map_, usage);
+        AddMemoryUsage("VkQueue", queue_map_, usage);
+        AddMemoryUsage("VkRenderPass", renderPass_map_, usage);
+        AddMemoryUsage("VkSampler", sampler_map_, usage);
+        AddMemoryUsage("VkSamplerYcbcrConversion", samplerYcbcrConversion_map_, usage);
+        AddMemoryUsage("VkSemaphore", semaphore_map_, usage);
+        AddMemoryUsage("VkShaderEXT", shaderEXT_map_, usage);
+        AddMemoryUsage("VkShaderModule", shaderModule_map_, usage);
+        AddMemoryUsage("VkSurfaceKHR", surfaceKHR_map_, usage);
+        AddMemoryUsage("VkSwapchainKHR", swapchainKHR_map_, usage);
+        AddMemoryUsage("VkValidationCacheEXT", validationCacheEXT_map_, usage);
+        AddMemoryUsage("VkVideoSessionKHR", videoSessionKHR_map_, usage);
+        AddMemoryUsage("VkVideoSessionParametersKHR", videoSessionParametersKHR_map_, usage);
+    }
+
   protected:
      std::unordered_map<format::HandleId, VulkanAccelerationStructureKHRInfo> accelerationStructureKHR_map_;
      std::unordered_map<format::HandleId, VulkanAccelerationStructureNVInfo> accelerationStructureNV_map_;
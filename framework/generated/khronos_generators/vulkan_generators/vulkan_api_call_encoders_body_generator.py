@@ -22,6 +22,7 @@
 # FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 # IN THE SOFTWARE.
 
+import re
 import sys
 from base_generator import BaseGenerator, BaseGeneratorOptions, ValueInfo, json, write
 
@@ -72,6 +73,28 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
     # Functions that can activate trimming from a post call command.
     POSTCALL_TRIM_TRIGGERS = ['vkQueueSubmit', 'vkQueueSubmit2', 'vkQueueSubmit2KHR', 'vkQueuePresentKHR', 'vkFrameBoundaryANDROID']
 
+    # Encoded types for the value encoder methods supported by FixedParameterEncoder, keyed by the method name without
+    # the 'Encode' prefix and 'Value' suffix.
+    FIXED_ENCODE_TYPES = {
+        'Int8': 'int8_t',
+        'UInt8': 'uint8_t',
+        'Int16': 'int16_t',
+        'UInt16': 'uint16_t',
+        'Int32': 'int32_t',
+        'UInt32': 'uint32_t',
+        'Int64': 'int64_t',
+        'UInt64': 'uint64_t',
+        'Float': 'float',
+        'Double': 'double',
+        'SizeT': 'format::SizeTEncodeType',
+        'HandleId': 'format::HandleEncodeType',
+        'VulkanHandle': 'format::HandleEncodeType',
+        'VkDeviceAddress': 'format::DeviceSizeEncodeType',
+        'Enum': 'format::EnumEncodeType',
+        'Flags': 'format::FlagsEncodeType',
+        'Flags64': 'format::Flags64EncodeType'
+    }
+
     def __init__(
         self, err_file=sys.stderr, warn_file=sys.stderr, diag_file=sys.stdout
     ):
@@ -385,7 +408,10 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         self, name, values, return_type, indent, omit_output_param
     ):
         body = '\n'
-        body += indent + self.make_begin_api_call(name, values)
+        body += indent + self.make_begin_api_call(
+            name, values,
+            self.make_fixed_parameter_size(name, values, return_type)
+        )
         body += indent + 'if (encoder)\n'
         body += indent + '{\n'
         indent += ' ' * self.INDENT_SIZE
@@ -408,11 +434,43 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         body += indent + '}\n'
         return body
 
-    def make_begin_api_call(self, name, values):
+    def make_fixed_parameter_size(self, name, values, return_type):
+        """Return an expression for the encoded size of the command's parameters when the command can be encoded with
+        FixedParameterEncoder, or None when it cannot. Only commands recorded to command buffers that return no
+        value and have only scalar and handle parameters qualify."""
+        if (return_type and return_type != 'void') or (values[0].base_type != 'VkCommandBuffer'):
+            return None
+
+        sizes = []
+        for value in values:
+            if value.is_pointer or value.is_array or self.is_struct(value.base_type):
+                return None
+
+            method_call = self.make_encoder_method_call(name, value, values, '')
+            match = re.match(r'encoder->Encode(\w+?)Value(<.*>)?\(', method_call)
+            if not match or match.group(1) not in self.FIXED_ENCODE_TYPES:
+                return None
+
+            sizes.append('sizeof({})'.format(self.FIXED_ENCODE_TYPES[match.group(1)]))
+
+        return ' + '.join(sizes)
+
+    def make_begin_api_call(self, name, values, fixed_parameter_size=None):
         capture_manager = 'manager'
         if name == 'vkCreateInstance':
             capture_manager = 'VulkanCaptureManager::Get()'
 
+        fixed = ''
+        fixed_arg = ''
+        if fixed_parameter_size:
+            fixed = 'Fixed'
+            fixed_arg = ', ' + fixed_parameter_size
+        elif values[0].base_type == 'VkCommandBuffer':
+            # Other command buffer commands use the command variant, which can omit pointer addresses.
+            return 'auto encoder = {}->BeginTrackedCommandApiCallCapture(format::ApiCallId::ApiCall_{});\n'.format(
+                capture_manager, name
+            )
+
         if name.startswith('vkCreate') or name.startswith(
             'vkAllocate'
         ) or name.startswith('vkDestroy') or name.startswith(
@@ -421,12 +479,12 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         ) or self.retrieves_handles(values) or (
             values[0].base_type == 'VkCommandBuffer'
         ) or (name == 'vkReleasePerformanceConfigurationINTEL'):
-            return 'auto encoder = {}->BeginTrackedApiCallCapture(format::ApiCallId::ApiCall_{});\n'.format(
-                capture_manager, name
+            return 'auto encoder = {}->BeginTracked{}ApiCallCapture(format::ApiCallId::ApiCall_{}{});\n'.format(
+                capture_manager, fixed, name, fixed_arg
             )
         else:
-            return 'auto encoder = {}->BeginApiCallCapture(format::ApiCallId::ApiCall_{});\n'.format(
-                capture_manager, name
+            return 'auto encoder = {}->Begin{}ApiCallCapture(format::ApiCallId::ApiCall_{}{});\n'.format(
+                capture_manager, fixed, name, fixed_arg
             )
 
     def get_struct_handle_member_info(self, members):
@@ -103,6 +103,7 @@ CPP_CONSUMER_VULKAN_VERSION_PAT = makeREstring(CPP_CONSUMER_VULKAN_VERSION)
 CPP_APICALL_GENERATE = [
     # Core functionality - Alphabetical
     'vkAllocateMemory',
+    'vkCmdUpdateBuffer',
     'vkCreateBuffer',
     'vkCreateComputePipelines',
     'vkCreateDescriptorUpdateTemplate',
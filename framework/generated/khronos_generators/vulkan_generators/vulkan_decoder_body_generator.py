@@ -108,6 +108,7 @@ class VulkanDecoderBodyGenerator(KhronosBaseDecoderBodyGenerator, BaseGenerator)
         self.newline()
         # Generate the VulkanDecoder::DecodeFunctionCall method for all of the commands processed by the generator.
         self.generate_decode_cases()
+        self.generate_command_recording_cases()
         self.newline()
         write('GFXRECON_END_NAMESPACE(decode)', file=self.outFile)
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
@@ -115,6 +116,39 @@ class VulkanDecoderBodyGenerator(KhronosBaseDecoderBodyGenerator, BaseGenerator)
         # Finish processing in superclass
         BaseGenerator.endFile(self)
 
+    def is_command_recording_cmd(self, cmd):
+        """Determines if a command only records into its command buffer, and can be decoded in parallel with the
+        commands recorded into other command buffers. Commands with replay overrides that access state shared with
+        other command buffers are excluded."""
+        if cmd == 'vkBeginCommandBuffer':
+            return True
+        if not cmd.startswith('vkCmd'):
+            return False
+        if cmd.startswith('vkCmdPipelineBarrier') or cmd.startswith('vkCmdBeginRenderPass'):
+            return False
+        if ('AccelerationStructure' in cmd) or ('TraceRays' in cmd):
+            return False
+        return True
+
+    def generate_command_recording_cases(self):
+        """Generate the VulkanDecoder::IsCommandRecordingCall method."""
+        body = 'bool VulkanDecoder::IsCommandRecordingCall(format::ApiCallId call_id) const\n'
+        body += '{\n'
+        body += '    switch(call_id)\n'
+        body += '    {'
+        write(body, file=self.outFile)
+
+        for cmd in self.get_all_filtered_cmd_names():
+            if self.is_command_recording_cmd(cmd):
+                write('    case format::ApiCallId::ApiCall_{}:'.format(cmd), file=self.outFile)
+
+        body = '        return true;\n'
+        body += '    default:\n'
+        body += '        return false;\n'
+        body += '    }\n'
+        body += '}\n'
+        write(body, file=self.outFile)
+
     def need_feature_generation(self):
         """Indicates that the current feature has C++ code to generate."""
         if self.feature_cmd_params:
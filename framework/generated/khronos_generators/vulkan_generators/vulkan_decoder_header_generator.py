@@ -105,6 +105,10 @@ class VulkanDecoderHeaderGenerator(BaseGenerator):
             '                                    size_t                        buffer_size) override;\n',
             file=self.outFile
         )
+        write(
+            '    virtual bool IsCommandRecordingCall(format::ApiCallId call_id) const override;\n',
+            file=self.outFile
+        )
         write('  private:', end='', file=self.outFile)
 
     def endFile(self):
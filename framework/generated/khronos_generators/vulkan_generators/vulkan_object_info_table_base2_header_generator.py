@@ -91,6 +91,7 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
         const_get_code = ''
         get_code = ''
         visit_code = ''
+        memory_usage_code = ''
         map_code = ''
 
         for handle_name in sorted(self.handle_names):
@@ -105,6 +106,7 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
             const_get_code += '    const Vulkan{0}* Get{1}(format::HandleId id) const {{ return GetVkObjectInfo<Vulkan{0}>(id, &{2}); }}\n'.format(handle_info, function_info, handle_map)
             get_code += '    Vulkan{0}* Get{1}(format::HandleId id) {{ return GetVkObjectInfo<Vulkan{0}>(id, &{2}); }}\n'.format(handle_info, function_info, handle_map)
             visit_code += '    void Visit{0}(std::function<void(const Vulkan{1}*)> visitor) const {{  for (const auto& entry : {2}) {{ visitor(&entry.second); }}  }}\n'.format(function_info, handle_info, handle_map)
+            memory_usage_code += '        AddMemoryUsage("{0}", {1}, usage);\n'.format(handle_name, handle_map)
             map_code += '     std::unordered_map<format::HandleId, Vulkan{0}> {1};\n'.format(handle_info, handle_map)
 
         self.newline()
@@ -124,6 +126,11 @@ class VulkanObjectInfoTableBase2HeaderGenerator(BaseGenerator):
         code += '\n'
         code += visit_code
         code += '\n'
+        code += '    void GetMemoryUsage(std::vector<ObjectInfoMemoryUsage>* usage) const\n'
+        code += '    {\n'
+        code += memory_usage_code
+        code += '    }\n'
+        code += '\n'
         code += '  protected:\n'
         code += map_code
         code += '};\n'
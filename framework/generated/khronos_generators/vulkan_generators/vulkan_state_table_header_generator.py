@@ -121,7 +121,7 @@ class VulkanStateTableHeaderGenerator(BaseGenerator):
             vk_remove_code += '    }\n'
             vk_get_code += 'template<> inline {0}* VulkanStateHandleTable::GetWrapper<{0}>({1} handle) {{ return VulkanStateTableBase::GetWrapper(handle, {2}); }}\n'.format(handle_wrapper_type, vkhandle_name, handle_map)
             vk_const_get_code += 'template<> inline const {0}* VulkanStateHandleTable::GetWrapper<{0}>({1} handle) const {{ return VulkanStateTableBase::GetWrapper(handle, {2}); }}\n'.format(handle_wrapper_type, vkhandle_name, handle_map)
-            vk_map_code += '    std::unordered_map<{0}, {1}*> {2};\n'.format(vkhandle_name, handle_wrapper_type, handle_map)
+            vk_map_code += '    util::ConcurrentPointerMap<{0}> {1};\n'.format(handle_wrapper_type, handle_map)
 
         self.newline()
         code = 'class VulkanStateTable : VulkanStateTableBase\n'
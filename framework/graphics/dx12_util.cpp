@@ -270,8 +270,8 @@ void TakeScreenshot(std::unique_ptr<graphics::DX12ImageRenderer>& image_renderer
                             switch (screenshot_format)
                             {
                                 default:
-                                    GFXRECON_LOG_ERROR(
-                                        "Screenshot format invalid!  Expected BMP or PNG, falling back to BMP.");
+                                    GFXRECON_LOG_ERROR("Screenshot format invalid!  Expected BMP, PNG, QOI or ZSTD, "
+                                                       "falling back to BMP.");
                                     // Intentional fall-through
                                 case gfxrecon::util::ScreenshotFormat::kBmp:
                                     if (!util::imagewriter::WriteBmpImage(filename + ".bmp",
@@ -300,6 +300,34 @@ void TakeScreenshot(std::unique_ptr<graphics::DX12ImageRenderer>& image_renderer
                                             filename.c_str());
                                     }
                                     break;
+                                case gfxrecon::util::ScreenshotFormat::kQoi:
+                                    if (!util::imagewriter::WriteQoiImage(filename + ".qoi",
+                                                                          static_cast<unsigned int>(fb_desc.Width),
+                                                                          static_cast<unsigned int>(fb_desc.Height),
+                                                                          datasize,
+                                                                          std::data(captured_image.data),
+                                                                          static_cast<unsigned int>(pitch),
+                                                                          util::imagewriter::kFormat_RGBA))
+                                    {
+                                        GFXRECON_LOG_ERROR(
+                                            "Screenshot could not be created: failed to write QOI file %s",
+                                            filename.c_str());
+                                    }
+                                    break;
+                                case gfxrecon::util::ScreenshotFormat::kZstd:
+                                    if (!util::imagewriter::WriteZstdImage(filename + ".zst",
+                                                                           static_cast<unsigned int>(fb_desc.Width),
+                                                                           static_cast<unsigned int>(fb_desc.Height),
+                                                                           datasize,
+                                                                           std::data(captured_image.data),
+                                                                           static_cast<unsigned int>(pitch),
+                                                                           util::imagewriter::kFormat_RGBA))
+                                    {
+                                        GFXRECON_LOG_ERROR(
+                                            "Screenshot could not be created: failed to write ZSTD file %s",
+                                            filename.c_str());
+                                    }
+                                    break;
                             }
                         }
                     }
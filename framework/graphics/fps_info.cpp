@@ -29,7 +29,11 @@
 #include "util/json_util.h"
 
 #include "nlohmann/json.hpp"
+#include <algorithm>
 #include <cinttypes>
+#include <cmath>
+#include <numeric>
+#include <sstream>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -58,6 +62,36 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+// Returns the nearest-rank percentile of the durations.
+static int64_t GetPercentile(std::vector<int64_t> durations, double percentile)
+{
+    if (durations.empty())
+    {
+        return 0;
+    }
+
+    size_t rank  = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(durations.size())));
+    size_t index = std::max<size_t>(rank, 1) - 1;
+    std::nth_element(durations.begin(), durations.begin() + index, durations.end());
+    return durations[index];
+}
+
+static nlohmann::json GetPercentiles(const std::vector<int64_t>& durations)
+{
+    return { { "p50", GetPercentile(durations, 50.0) },
+             { "p95", GetPercentile(durations, 95.0) },
+             { "p99", GetPercentile(durations, 99.0) } };
+}
+
+static void WritePercentilesToConsole(const char* prefix, const std::vector<int64_t>& durations)
+{
+    GFXRECON_WRITE_CONSOLE("%s p50 %f ms, p95 %f ms, p99 %f ms",
+                           prefix,
+                           static_cast<double>(GetPercentile(durations, 50.0)) / 1000000.0,
+                           static_cast<double>(GetPercentile(durations, 95.0)) / 1000000.0,
+                           static_cast<double>(GetPercentile(durations, 99.0)) / 1000000.0);
+}
+
 FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  uint64_t               measurement_end_frame,
                  bool                   has_measurement_range,
@@ -67,14 +101,19 @@ FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  bool                   preload_measurement_range,
                  const std::string_view measurement_file_name,
                  bool                   quit_after_frame,
-                 uint64_t               quit_frame) :
+                 uint64_t               quit_frame,
+                 uint32_t               measurement_range_loop_count,
+                 bool                   detailed_frame_timing) :
     measurement_start_frame_(measurement_start_frame),
     measurement_end_frame_(measurement_end_frame), measurement_start_time_(0), measurement_end_time_(0),
     has_measurement_range_(has_measurement_range), quit_after_range_(quit_after_range),
     flush_measurement_range_(flush_measurement_range), flush_inside_measurement_range_(flush_inside_measurement_range),
     started_measurement_(false), ended_measurement_(false), frame_start_time_(0), frame_durations_(),
     measurement_file_name_(measurement_file_name), preload_measurement_range_(preload_measurement_range),
-    quit_after_frame_(quit_after_frame), quit_frame_(quit_frame)
+    quit_after_frame_(quit_after_frame), quit_frame_(quit_frame),
+    measurement_range_loop_count_(std::max(1u, measurement_range_loop_count)), loop_start_time_(0), loop_durations_(),
+    detailed_frame_timing_(detailed_frame_timing), frame_read_durations_(), frame_gpu_durations_(),
+    pending_gpu_times_(0), wrote_measurement_file_(false)
 {
     if (has_measurement_range_)
     {
@@ -106,78 +145,187 @@ void FpsInfo::BeginFrame(uint64_t frame)
         if (frame >= measurement_start_frame_)
         {
             measurement_start_time_ = util::datetime::GetTimestamp();
+            loop_start_time_        = measurement_start_time_;
             started_measurement_    = true;
             frame_durations_.clear();
+            loop_durations_.clear();
+            frame_read_durations_.clear();
+            frame_gpu_durations_.clear();
         }
     }
+    else if (!ended_measurement_ && (frame == measurement_start_frame_))
+    {
+        // The measurement range is replayed again.
+        loop_start_time_ = util::datetime::GetTimestamp();
+    }
 
     frame_start_time_ = util::datetime::GetTimestamp();
 }
 
-void FpsInfo::EndFrame(uint64_t frame)
+void FpsInfo::EndFrame(uint64_t frame, int64_t read_time)
 {
     if (started_measurement_ && !ended_measurement_)
     {
-        frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, util::datetime::GetTimestamp()));
+        int64_t frame_end_time = util::datetime::GetTimestamp();
+        frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, frame_end_time));
+
+        if (detailed_frame_timing_)
+        {
+            frame_read_durations_.push_back(read_time);
+        }
 
         // Measurement frame range end is non-inclusive, as opposed to trim frame range
         if (frame >= measurement_end_frame_ - 1)
         {
-            measurement_end_time_ = util::datetime::GetTimestamp();
+            loop_durations_.push_back(util::datetime::DiffTimestamps(loop_start_time_, frame_end_time));
+
+            if (loop_durations_.size() < measurement_range_loop_count_)
+            {
+                // The measurement ends with the last loop over the measurement range.
+                return;
+            }
+
+            measurement_end_time_ = frame_end_time;
             ended_measurement_    = true;
 
-            // Save measurements to file
-            if (!measurement_file_name_.empty())
+            // The measurements are saved when the GPU times of the measured frames are available.
+            if (pending_gpu_times_ == 0)
+            {
+                WriteMeasurementFile();
+            }
+        }
+    }
+}
+
+size_t FpsInfo::BeginGpuTime()
+{
+    ++pending_gpu_times_;
+    return frame_durations_.size();
+}
+
+void FpsInfo::EndGpuTime(size_t frame_index, int64_t duration)
+{
+    assert(pending_gpu_times_ > 0);
+
+    if (frame_index >= frame_gpu_durations_.size())
+    {
+        frame_gpu_durations_.resize(frame_index + 1, 0);
+    }
+
+    // A frame can have multiple queue submissions.
+    frame_gpu_durations_[frame_index] += duration;
+
+    if ((--pending_gpu_times_ == 0) && ended_measurement_)
+    {
+        WriteMeasurementFile();
+    }
+}
+
+void FpsInfo::WriteMeasurementFile()
+{
+    if (measurement_file_name_.empty() || wrote_measurement_file_)
+    {
+        return;
+    }
+
+    wrote_measurement_file_ = true;
+
+    if (frame_gpu_durations_.size() < frame_durations_.size())
+    {
+        frame_gpu_durations_.resize(frame_durations_.size(), 0);
+    }
+
+    // The file is written as CSV when requested by the file extension, and as JSON otherwise.
+    const std::string csv_extension = ".csv";
+    const bool        write_csv =
+        (measurement_file_name_.size() >= csv_extension.size()) &&
+        (util::platform::StringCompareNoCase(
+             measurement_file_name_.c_str() + (measurement_file_name_.size() - csv_extension.size()),
+             csv_extension.c_str()) == 0);
+    const std::string file_content = write_csv ? GetMeasurementCsv() : GetMeasurementJson();
+
+    FILE*   file_pointer = nullptr;
+    int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
+    if (result == 0)
+    {
+        // It either writes a fully valid file, or it doesn't write anything !
+        if (!util::platform::FileWrite(file_content.data(), file_content.size(), file_pointer))
+        {
+            GFXRECON_LOG_ERROR("Failed to write to measurements file '%s'.", measurement_file_name_.c_str());
+
+            // Try to delete the partial file from disk using <cstdio>
+            const int remove_result = std::remove(measurement_file_name_.c_str());
+            if (remove_result != 0)
             {
-                double   start_time   = util::datetime::ConvertTimestampToSeconds(measurement_start_time_);
-                double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
-                double   diff_time    = GetElapsedSeconds(static_cast<uint64_t>(measurement_start_time_),
-                                                     static_cast<uint64_t>(measurement_end_time_));
-                uint64_t total_frames = measurement_end_frame_ - measurement_start_frame_;
-                double   fps          = static_cast<double>(total_frames) / diff_time;
-
-                nlohmann::json file_content = { { "frame_range",
-                                                  { { "start_frame", measurement_start_frame_ },
-                                                    { "end_frame", measurement_end_frame_ },
-                                                    { "frame_count", total_frames },
-                                                    { "start_time_monotonic", start_time },
-                                                    { "end_time_monotonic", end_time },
-                                                    { "duration", diff_time },
-                                                    { "fps", fps },
-                                                    { "frame_durations", frame_durations_ } } } };
-
-                FILE*   file_pointer = nullptr;
-                int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
-                if (result == 0)
-                {
-                    const std::string json_string = file_content.dump(util::kJsonIndentWidth);
-
-                    // It either writes a fully valid file, or it doesn't write anything !
-                    if (!util::platform::FileWrite(json_string.data(), json_string.size(), file_pointer))
-                    {
-                        GFXRECON_LOG_ERROR("Failed to write to measurements file '%s'.",
-                                           measurement_file_name_.c_str());
-
-                        // Try to delete the partial file from disk using <cstdio>
-                        const int remove_result = std::remove(measurement_file_name_.c_str());
-                        if (remove_result != 0)
-                        {
-                            GFXRECON_LOG_ERROR("Failed to remove measurements file '%s' (Error %i).",
-                                               measurement_file_name_.c_str(),
-                                               remove_result);
-                        }
-                    }
-                    util::platform::FileClose(file_pointer);
-                }
-                else
-                {
-                    GFXRECON_LOG_ERROR(
-                        "Failed to open measurements file '%s' (Error %i).", measurement_file_name_.c_str(), result);
-                    GFXRECON_LOG_ERROR("%s", std::strerror(result));
-                }
+                GFXRECON_LOG_ERROR("Failed to remove measurements file '%s' (Error %i).",
+                                   measurement_file_name_.c_str(),
+                                   remove_result);
             }
         }
+        util::platform::FileClose(file_pointer);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to open measurements file '%s' (Error %i).", measurement_file_name_.c_str(), result);
+        GFXRECON_LOG_ERROR("%s", std::strerror(result));
+    }
+}
+
+std::string FpsInfo::GetMeasurementJson() const
+{
+    double   start_time   = util::datetime::ConvertTimestampToSeconds(measurement_start_time_);
+    double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
+    double   diff_time    = GetMeasurementSeconds();
+    uint64_t total_frames = measurement_end_frame_ - measurement_start_frame_;
+    double   fps          = static_cast<double>(total_frames * loop_durations_.size()) / diff_time;
+
+    nlohmann::json frame_range = { { "start_frame", measurement_start_frame_ },
+                                   { "end_frame", measurement_end_frame_ },
+                                   { "frame_count", total_frames },
+                                   { "loop_count", loop_durations_.size() },
+                                   { "start_time_monotonic", start_time },
+                                   { "end_time_monotonic", end_time },
+                                   { "duration", diff_time },
+                                   { "fps", fps },
+                                   { "loop_durations", loop_durations_ },
+                                   { "frame_durations", frame_durations_ },
+                                   { "frame_duration_percentiles", GetPercentiles(frame_durations_) } };
+
+    if (detailed_frame_timing_)
+    {
+        frame_range["frame_read_durations"]           = frame_read_durations_;
+        frame_range["frame_gpu_durations"]            = frame_gpu_durations_;
+        frame_range["frame_gpu_duration_percentiles"] = GetPercentiles(frame_gpu_durations_);
+    }
+
+    nlohmann::json file_content = { { "frame_range", frame_range } };
+    return file_content.dump(util::kJsonIndentWidth);
+}
+
+std::string FpsInfo::GetMeasurementCsv() const
+{
+    // One row per measured frame, with durations in nanoseconds.
+    std::ostringstream csv;
+    csv << "loop,frame,duration";
+    if (detailed_frame_timing_)
+    {
+        csv << ",read_duration,gpu_duration";
+    }
+    csv << "\n";
+
+    uint64_t total_frames = std::max<uint64_t>(1, measurement_end_frame_ - measurement_start_frame_);
+    for (size_t i = 0; i < frame_durations_.size(); ++i)
+    {
+        csv << (i / total_frames) << "," << (measurement_start_frame_ + (i % total_frames)) << ","
+            << frame_durations_[i];
+        if (detailed_frame_timing_)
+        {
+            csv << "," << frame_read_durations_[i] << "," << frame_gpu_durations_[i];
+        }
+        csv << "\n";
     }
+
+    return csv.str();
 }
 
 bool FpsInfo::ShouldWaitIdleAfterFrame(uint64_t frame)
@@ -194,6 +342,12 @@ void FpsInfo::EndFile(uint64_t frame)
         measurement_end_time_  = gfxrecon::util::datetime::GetTimestamp();
         measurement_end_frame_ = frame;
     }
+    else if (pending_gpu_times_ > 0)
+    {
+        GFXRECON_LOG_WARNING("The GPU times of %zu submissions were not available when the replay ended",
+                             pending_gpu_times_);
+        WriteMeasurementFile();
+    }
 }
 
 void FpsInfo::ProcessStateEndMarker(uint64_t frame_number)
@@ -226,29 +380,89 @@ void FpsInfo::LogToConsole()
     {
         // There was a measurement range, emit only statistics about the
         // measurement range
-        double   diff_time_sec = GetElapsedSeconds(static_cast<uint64_t>(measurement_start_time_),
-                                                 static_cast<uint64_t>(measurement_end_time_));
+        size_t   loop_count    = std::max<size_t>(1, loop_durations_.size());
+        double   diff_time_sec = GetMeasurementSeconds();
         uint64_t total_frames  = measurement_end_frame_ - measurement_start_frame_;
-        double   fps           = static_cast<double>(total_frames) / diff_time_sec;
-        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %lu frame%s, 1 loop, framerange [%lu-%lu)",
+        double   fps           = static_cast<double>(total_frames * loop_count) / diff_time_sec;
+        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %lu frame%s, %zu loop%s, framerange "
+                               "[%lu-%lu)",
                                fps,
                                diff_time_sec,
                                total_frames,
                                total_frames > 1 ? "s" : "",
+                               loop_count,
+                               loop_count > 1 ? "s" : "",
                                measurement_start_frame_,
                                measurement_end_frame_);
+
+        if (loop_durations_.size() > 1)
+        {
+            const auto minmax = std::minmax_element(loop_durations_.begin(), loop_durations_.end());
+            GFXRECON_WRITE_CONSOLE("Measurement range loop time: min %f seconds, max %f seconds, average %f seconds",
+                                   util::datetime::ConvertTimestampToSeconds(*minmax.first),
+                                   util::datetime::ConvertTimestampToSeconds(*minmax.second),
+                                   diff_time_sec / static_cast<double>(loop_durations_.size()));
+        }
+
+        WritePercentilesToConsole("Measurement range frame time:", frame_durations_);
+
+        if (detailed_frame_timing_ && !frame_durations_.empty())
+        {
+            int64_t total_read_time =
+                std::accumulate(frame_read_durations_.begin(), frame_read_durations_.end(), int64_t{ 0 });
+            int64_t total_frame_time = std::accumulate(frame_durations_.begin(), frame_durations_.end(), int64_t{ 0 });
+            GFXRECON_WRITE_CONSOLE("Measurement range CPU time: read %f ms, replay %f ms per frame",
+                                   static_cast<double>(total_read_time) / frame_durations_.size() / 1000000.0,
+                                   static_cast<double>(total_frame_time - total_read_time) / frame_durations_.size() /
+                                       1000000.0);
+            WritePercentilesToConsole("Measurement range GPU time:", frame_gpu_durations_);
+        }
     }
 }
 
+double FpsInfo::GetMeasurementSeconds() const
+{
+    if (loop_durations_.empty())
+    {
+        return GetElapsedSeconds(static_cast<uint64_t>(measurement_start_time_),
+                                 static_cast<uint64_t>(measurement_end_time_));
+    }
+
+    // The time that is spent to restore the resource state between loops is not included.
+    return util::datetime::ConvertTimestampToSeconds(
+        std::accumulate(loop_durations_.begin(), loop_durations_.end(), int64_t{ 0 }));
+}
+
 uint64_t FpsInfo::ShouldPreloadFrames(uint64_t current_frame) const
 {
     uint64_t result = 0;
-    if (preload_measurement_range_ && current_frame == measurement_start_frame_)
+    if (preload_measurement_range_ && !started_measurement_ && current_frame == measurement_start_frame_)
     {
         result = measurement_end_frame_ - measurement_start_frame_;
     }
     return result;
 }
 
+bool FpsInfo::ShouldRepeatMeasurementRange(uint64_t frame) const
+{
+    return started_measurement_ && !ended_measurement_ && (frame >= measurement_end_frame_ - 1) &&
+           !loop_durations_.empty() && (loop_durations_.size() < measurement_range_loop_count_);
+}
+
+void FpsInfo::EndMeasurementRangeLoops()
+{
+    if (started_measurement_ && !ended_measurement_ && !loop_durations_.empty())
+    {
+        measurement_range_loop_count_ = static_cast<uint32_t>(loop_durations_.size());
+        measurement_end_time_         = util::datetime::GetTimestamp();
+        ended_measurement_            = true;
+
+        if (pending_gpu_times_ == 0)
+        {
+            WriteMeasurementFile();
+        }
+    }
+}
+
 GFXRECON_END_NAMESPACE(graphics)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -45,7 +45,9 @@ class FpsInfo
                      bool             preload_measurement_range      = false,
                      std::string_view measurement_file_name          = "",
                      bool             quit_after_frame               = false,
-                     uint64_t         quit_frame                     = std::numeric_limits<uint64_t>::max());
+                     uint64_t         quit_frame                     = std::numeric_limits<uint64_t>::max(),
+                     uint32_t         measurement_range_loop_count   = 1,
+                     bool             detailed_frame_timing          = false);
 
     void LogToConsole();
 
@@ -54,12 +56,36 @@ class FpsInfo
     bool                   ShouldWaitIdleAfterFrame(uint64_t file_processor_frame);
     bool                   ShouldQuit(uint64_t file_processor_frame);
     void                   BeginFrame(uint64_t file_processor_frame);
-    void                   EndFrame(uint64_t file_processor_frame);
+    void                   EndFrame(uint64_t file_processor_frame, int64_t read_time = 0);
     void                   EndFile(uint64_t end_file_processor_frame);
     void                   ProcessStateEndMarker(uint64_t file_processor_frame);
     [[nodiscard]] uint64_t ShouldPreloadFrames(uint64_t current_frame) const;
+    [[nodiscard]] bool     ShouldLoopMeasurementRange() const { return measurement_range_loop_count_ > 1; }
+    [[nodiscard]] bool     ShouldRepeatMeasurementRange(uint64_t file_processor_frame) const;
+
+    // Ends the measurement after the loops over the measurement range that were already replayed, when the range
+    // cannot be replayed again.
+    void EndMeasurementRangeLoops();
+
+    // GPU frame times are measured asynchronously. BeginGpuTime returns the index of the measured frame that the GPU
+    // time of a submission belongs to, and EndGpuTime adds the GPU time to that frame once it is available. The
+    // measurement file is written after the GPU times of all frames have been added.
+    [[nodiscard]] bool IsMeasuringGpuTime() const
+    {
+        return detailed_frame_timing_ && started_measurement_ && !ended_measurement_;
+    }
+    size_t BeginGpuTime();
+    void   EndGpuTime(size_t frame_index, int64_t duration);
 
   private:
+    double GetMeasurementSeconds() const;
+
+    void WriteMeasurementFile();
+
+    std::string GetMeasurementJson() const;
+
+    std::string GetMeasurementCsv() const;
+
     uint64_t start_time_{};
 
     uint64_t measurement_start_frame_;
@@ -88,6 +114,16 @@ class FpsInfo
 
     bool     quit_after_frame_;
     uint64_t quit_frame_;
+
+    uint32_t             measurement_range_loop_count_;
+    int64_t              loop_start_time_;
+    std::vector<int64_t> loop_durations_;
+
+    bool                 detailed_frame_timing_;
+    std::vector<int64_t> frame_read_durations_;
+    std::vector<int64_t> frame_gpu_durations_;
+    size_t               pending_gpu_times_;
+    bool                 wrote_measurement_file_;
 };
 
 GFXRECON_END_NAMESPACE(graphics)
@@ -1335,14 +1335,15 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
 void VulkanResourcesUtil::CopyBuffer(VkBuffer source_buffer,
                                      VkBuffer destination_buffer,
                                      uint64_t size,
-                                     uint64_t src_offset)
+                                     uint64_t src_offset,
+                                     uint64_t dst_offset)
 {
     assert(source_buffer != VK_NULL_HANDLE);
     assert(command_buffer_ != VK_NULL_HANDLE);
 
     VkBufferCopy copy_region;
     copy_region.srcOffset = src_offset;
-    copy_region.dstOffset = 0;
+    copy_region.dstOffset = dst_offset;
     copy_region.size      = size;
 
     device_table_.CmdCopyBuffer(command_buffer_, source_buffer, destination_buffer, 1, &copy_region);
@@ -1975,6 +1976,81 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
     return result;
 }
 
+VkResult VulkanResourcesUtil::ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                                      uint32_t                             queue_family_index,
+                                                      std::vector<std::vector<uint8_t>>&   data)
+{
+    assert(!regions.empty());
+
+    const VkQueue queue = GetQueue(queue_family_index, 0);
+    if (queue == VK_NULL_HANDLE)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    uint64_t total_size = 0;
+    for (const auto& region : regions)
+    {
+        assert((region.buffer != VK_NULL_HANDLE) && (region.size > 0));
+        total_size += region.size;
+    }
+
+    VkResult result = CreateStagingBuffer(total_size);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandPool(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandBuffer(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    // Pack the buffers back to back in the staging buffer.
+    uint64_t staging_offset = 0;
+    for (const auto& region : regions)
+    {
+        CopyBuffer(region.buffer, staging_buffer_.buffer, region.size, region.offset, staging_offset);
+        staging_offset += region.size;
+    }
+
+    result = SubmitCommandBuffer(queue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = MapStagingBuffer();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    InvalidateStagingBuffer();
+
+    data.resize(regions.size());
+    staging_offset = 0;
+
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        const size_t size = static_cast<size_t>(regions[i].size);
+
+        data[i].resize(size);
+        util::platform::MemoryCopy(
+            data[i].data(), size, static_cast<const uint8_t*>(staging_buffer_.mapped_ptr) + staging_offset, size);
+        staging_offset += size;
+    }
+
+    return result;
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -153,6 +153,19 @@ class VulkanResourcesUtil
     VkResult ReadFromBufferResource(
         VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    struct BufferReadRegion
+    {
+        VkBuffer buffer;
+        uint64_t size;
+        uint64_t offset;
+    };
+
+    // Dumps the content of multiple buffers that are owned by the same queue family with a single queue submission.
+    // The content of each region is copied to the data vector at the same index.
+    VkResult ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                     uint32_t                             queue_family_index,
+                                     std::vector<std::vector<uint8_t>>&   data);
+
     bool IsBlitSupported(VkFormat       src_format,
                          VkImageTiling  src_image_tiling,
                          VkFormat       dst_format,
@@ -210,7 +223,11 @@ class VulkanResourcesUtil
                          bool                         all_layers_per_level,
                          CopyBufferImageDirection     copy_direction);
 
-    void CopyBuffer(VkBuffer source_buffer, VkBuffer destination_buffer, uint64_t size, uint64_t offset);
+    void CopyBuffer(VkBuffer source_buffer,
+                    VkBuffer destination_buffer,
+                    uint64_t size,
+                    uint64_t offset,
+                    uint64_t destination_offset = 0);
 
     VkResult ResolveImage(VkImage           image,
                           VkFormat          format,
@@ -0,0 +1,161 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/chunk_arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+ChunkArena::~ChunkArena()
+{
+    Trim();
+}
+
+ChunkArena::Chunk* ChunkArena::AllocateChunk(size_t capacity)
+{
+    uint8_t* memory = new uint8_t[sizeof(Chunk) + capacity];
+    Chunk*   chunk  = new (memory) Chunk;
+    chunk->capacity = capacity;
+    return chunk;
+}
+
+void ChunkArena::FreeChunk(Chunk* chunk)
+{
+    chunk->~Chunk();
+    delete[] reinterpret_cast<uint8_t*>(chunk);
+}
+
+ChunkArena::Chunk* ChunkArena::AcquireChunk(size_t min_capacity)
+{
+    if (min_capacity > chunk_size_)
+    {
+        return AllocateChunk(min_capacity);
+    }
+
+    if (free_chunks_ != nullptr)
+    {
+        Chunk* chunk = free_chunks_;
+        free_chunks_ = chunk->next;
+        chunk->next  = nullptr;
+        chunk->size  = 0;
+        return chunk;
+    }
+
+    return AllocateChunk(chunk_size_);
+}
+
+void ChunkArena::ReleaseChunks(Chunk* first)
+{
+    while (first != nullptr)
+    {
+        Chunk* next = first->next;
+
+        if (first->capacity == chunk_size_)
+        {
+            first->next  = free_chunks_;
+            free_chunks_ = first;
+        }
+        else
+        {
+            FreeChunk(first);
+        }
+
+        first = next;
+    }
+}
+
+void ChunkArena::Trim()
+{
+    while (free_chunks_ != nullptr)
+    {
+        Chunk* next = free_chunks_->next;
+        FreeChunk(free_chunks_);
+        free_chunks_ = next;
+    }
+}
+
+void ChunkedBuffer::SetArena(ChunkArena* arena)
+{
+    assert(first_chunk_ == nullptr);
+    arena_ = arena;
+}
+
+uint8_t* ChunkedBuffer::Allocate(size_t size)
+{
+    if ((last_chunk_ == nullptr) || ((last_chunk_->capacity - last_chunk_->size) < size))
+    {
+        ChunkArena::Chunk* chunk = nullptr;
+
+        if (arena_ != nullptr)
+        {
+            chunk = arena_->AcquireChunk(size);
+        }
+        else
+        {
+            chunk = ChunkArena::AllocateChunk(std::max(size, ChunkArena::kDefaultChunkSize));
+        }
+
+        if (last_chunk_ != nullptr)
+        {
+            last_chunk_->next = chunk;
+        }
+        else
+        {
+            first_chunk_ = chunk;
+        }
+
+        last_chunk_ = chunk;
+    }
+
+    uint8_t* data = last_chunk_->GetData() + last_chunk_->size;
+    last_chunk_->size += size;
+    data_size_ += size;
+    return data;
+}
+
+void ChunkedBuffer::Clear()
+{
+    if (arena_ != nullptr)
+    {
+        arena_->ReleaseChunks(first_chunk_);
+    }
+    else
+    {
+        while (first_chunk_ != nullptr)
+        {
+            ChunkArena::Chunk* next = first_chunk_->next;
+            ChunkArena::FreeChunk(first_chunk_);
+            first_chunk_ = next;
+        }
+    }
+
+    first_chunk_ = nullptr;
+    last_chunk_  = nullptr;
+    data_size_   = 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,119 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CHUNK_ARENA_H
+#define GFXRECON_UTIL_CHUNK_ARENA_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Allocates fixed size memory chunks and keeps released chunks in a free list for reuse, so that buffers which are
+// repeatedly filled and cleared stop allocating once the arena holds enough chunks. Requests that are larger than the
+// chunk size receive a dedicated chunk, which is freed instead of recycled when it is released.
+//
+// The arena is not thread safe. It is intended to be owned by an object that is externally synchronized, such as a
+// Vulkan command pool.
+class ChunkArena
+{
+  public:
+    static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+    struct Chunk
+    {
+        Chunk* next{ nullptr };
+        size_t size{ 0 };
+        size_t capacity{ 0 };
+
+        uint8_t*       GetData() { return reinterpret_cast<uint8_t*>(this + 1); }
+        const uint8_t* GetData() const { return reinterpret_cast<const uint8_t*>(this + 1); }
+    };
+
+  public:
+    explicit ChunkArena(size_t chunk_size = kDefaultChunkSize) : chunk_size_(chunk_size) {}
+
+    ~ChunkArena();
+
+    ChunkArena(const ChunkArena&) = delete;
+
+    ChunkArena& operator=(const ChunkArena&) = delete;
+
+    // Returns an empty chunk with a capacity of at least min_capacity bytes.
+    Chunk* AcquireChunk(size_t min_capacity);
+
+    // Releases a list of chunks that are linked through Chunk::next.
+    void ReleaseChunks(Chunk* first);
+
+    // Frees the chunks that are currently in the free list.
+    void Trim();
+
+    size_t GetChunkSize() const { return chunk_size_; }
+
+    static Chunk* AllocateChunk(size_t capacity);
+
+    static void FreeChunk(Chunk* chunk);
+
+  private:
+    size_t chunk_size_;
+    Chunk* free_chunks_{ nullptr };
+};
+
+// Append-only buffer that stores its data in chunks obtained from a ChunkArena. Each allocation is contiguous, and never
+// spans chunk boundaries. Chunks are returned to the arena when the buffer is cleared or destroyed, so the arena must
+// outlive the buffer. Without an arena, chunks are allocated and freed directly.
+class ChunkedBuffer
+{
+  public:
+    ChunkedBuffer() = default;
+
+    ~ChunkedBuffer() { Clear(); }
+
+    ChunkedBuffer(const ChunkedBuffer&) = delete;
+
+    ChunkedBuffer& operator=(const ChunkedBuffer&) = delete;
+
+    // Must be called while the buffer is empty.
+    void SetArena(ChunkArena* arena);
+
+    uint8_t* Allocate(size_t size);
+
+    void Clear();
+
+    size_t GetDataSize() const { return data_size_; }
+
+    const ChunkArena::Chunk* GetFirstChunk() const { return first_chunk_; }
+
+  private:
+    ChunkArena*        arena_{ nullptr };
+    ChunkArena::Chunk* first_chunk_{ nullptr };
+    ChunkArena::Chunk* last_chunk_{ nullptr };
+    size_t             data_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CHUNK_ARENA_H
@@ -0,0 +1,235 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CONCURRENT_POINTER_MAP_H
+#define GFXRECON_UTIL_CONCURRENT_POINTER_MAP_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Open addressing hash map from non-zero 64-bit keys to pointers, with lookups that do not write to shared memory.
+//
+// Synchronization is split between the map and its owner:
+//  - Find() may run concurrently with any other operation, provided that the caller holds a read-side guard that
+//    prevents ReclaimRetiredTables() from running.
+//  - Insert() and Remove() must be serialized with each other by the caller.
+//  - ReclaimRetiredTables() must only be called when no Find() can be in progress, for example while holding an
+//    exclusive lock that excludes the read-side guard. It only needs to be called when HasRetiredTables() is true.
+//
+// Keys are never removed from a table. Remove() clears the slot's value, which leaves a tombstone that is reused if the
+// same key is inserted again, as is common for Vulkan handles that are recycled by the driver. When the live entries
+// and tombstones exceed half of the capacity, the live entries are copied to a new table, and the old table is retired
+// until the owner reclaims it.
+template <typename T>
+class ConcurrentPointerMap
+{
+  public:
+    static constexpr size_t kInitialCapacity = 64;
+
+  public:
+    ConcurrentPointerMap() = default;
+
+    ~ConcurrentPointerMap() { delete table_.load(std::memory_order_relaxed); }
+
+    ConcurrentPointerMap(const ConcurrentPointerMap&) = delete;
+
+    ConcurrentPointerMap& operator=(const ConcurrentPointerMap&) = delete;
+
+    T* Find(uint64_t key) const
+    {
+        const Table* table = table_.load(std::memory_order_acquire);
+        if (table == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (size_t index = Hash(key) & table->mask;; index = (index + 1) & table->mask)
+        {
+            const Slot&    slot     = table->slots[index];
+            const uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+
+            if (slot_key == key)
+            {
+                return slot.value.load(std::memory_order_acquire);
+            }
+            else if (slot_key == 0)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    bool Insert(uint64_t key, T* value)
+    {
+        assert((key != 0) && (value != nullptr));
+
+        Table* table = table_.load(std::memory_order_relaxed);
+        if ((table == nullptr) || (((table->used_count + 1) * 2) > (table->mask + 1)))
+        {
+            table = Rehash(table);
+        }
+
+        Slot* slot = FindSlot(table, key);
+        if (slot->key.load(std::memory_order_relaxed) == key)
+        {
+            if (slot->value.load(std::memory_order_relaxed) != nullptr)
+            {
+                return false;
+            }
+
+            slot->value.store(value, std::memory_order_release);
+        }
+        else
+        {
+            // Publish the value before the key, so that a reader that observes the key also observes the value.
+            slot->value.store(value, std::memory_order_relaxed);
+            slot->key.store(key, std::memory_order_release);
+            ++table->used_count;
+        }
+
+        ++table->live_count;
+        return true;
+    }
+
+    bool Remove(uint64_t key)
+    {
+        Table* table = table_.load(std::memory_order_relaxed);
+        if (table == nullptr)
+        {
+            return false;
+        }
+
+        Slot* slot = FindSlot(table, key);
+        if ((slot->key.load(std::memory_order_relaxed) != key) ||
+            (slot->value.load(std::memory_order_relaxed) == nullptr))
+        {
+            return false;
+        }
+
+        slot->value.store(nullptr, std::memory_order_release);
+        --table->live_count;
+        return true;
+    }
+
+    bool HasRetiredTables() const { return !retired_tables_.empty(); }
+
+    void ReclaimRetiredTables() { retired_tables_.clear(); }
+
+  private:
+    struct Slot
+    {
+        std::atomic<uint64_t> key{ 0 };
+        std::atomic<T*>       value{ nullptr };
+    };
+
+    struct Table
+    {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(std::make_unique<Slot[]>(capacity)) {}
+
+        size_t                  mask;
+        size_t                  used_count{ 0 }; // Live entries and tombstones.
+        size_t                  live_count{ 0 };
+        std::unique_ptr<Slot[]> slots;
+    };
+
+  private:
+    static size_t Hash(uint64_t key)
+    {
+        // Handle values are frequently aligned pointers or sequential indices, so mix all bits into the low bits.
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+    static Slot* FindSlot(Table* table, uint64_t key)
+    {
+        for (size_t index = Hash(key) & table->mask;; index = (index + 1) & table->mask)
+        {
+            Slot&          slot     = table->slots[index];
+            const uint64_t slot_key = slot.key.load(std::memory_order_relaxed);
+
+            if ((slot_key == key) || (slot_key == 0))
+            {
+                return &slot;
+            }
+        }
+    }
+
+    Table* Rehash(Table* old_table)
+    {
+        const size_t live_count = (old_table != nullptr) ? old_table->live_count : 0;
+        size_t       capacity   = kInitialCapacity;
+
+        // Size the new table for at most 25% occupancy, leaving room to grow before the next rehash.
+        while (((live_count + 1) * 4) > capacity)
+        {
+            capacity *= 2;
+        }
+
+        Table* new_table = new Table(capacity);
+
+        if (old_table != nullptr)
+        {
+            for (size_t i = 0; i <= old_table->mask; ++i)
+            {
+                const Slot& old_slot = old_table->slots[i];
+                T*          value    = old_slot.value.load(std::memory_order_relaxed);
+
+                if (value != nullptr)
+                {
+                    const uint64_t key  = old_slot.key.load(std::memory_order_relaxed);
+                    Slot*          slot = FindSlot(new_table, key);
+                    slot->key.store(key, std::memory_order_relaxed);
+                    slot->value.store(value, std::memory_order_relaxed);
+                }
+            }
+
+            new_table->used_count = live_count;
+            new_table->live_count = live_count;
+
+            // Readers may still be probing the old table, so it is kept until the owner reclaims it.
+            retired_tables_.emplace_back(old_table);
+        }
+
+        table_.store(new_table, std::memory_order_release);
+        return new_table;
+    }
+
+  private:
+    std::atomic<Table*>                 table_{ nullptr };
+    std::vector<std::unique_ptr<Table>> retired_tables_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CONCURRENT_POINTER_MAP_H
@@ -0,0 +1,328 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/direct_file_output_stream.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#if !defined(WIN32)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+DirectFileOutputStream::DirectFileOutputStream(const std::string& filename,
+                                               size_t             buffer_size,
+                                               bool               flush_partial_blocks) :
+    FileOutputStream(nullptr, false), fd_(-1), buffer_size_(0), buffers_{ nullptr, nullptr }, active_buffer_(0),
+    active_size_(0), active_offset_(0), pending_data_(nullptr), pending_size_(0), pending_offset_(0),
+    write_error_(false), stop_(false), flush_partial_blocks_(flush_partial_blocks)
+{
+#if defined(WIN32)
+    GFXRECON_UNREFERENCED_PARAMETER(buffer_size);
+    GFXRECON_LOG_WARNING("Direct I/O is not supported on this platform; unable to open %s for direct I/O",
+                         filename.c_str());
+#else
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    const int mode  = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+
+#if defined(O_DIRECT)
+    fd_ = open(filename.c_str(), flags | O_DIRECT, mode);
+    if ((fd_ < 0) && (errno == EINVAL))
+    {
+        GFXRECON_LOG_WARNING("The file system does not support direct I/O for %s; using regular I/O",
+                             filename.c_str());
+        fd_ = open(filename.c_str(), flags, mode);
+    }
+#else
+    fd_ = open(filename.c_str(), flags, mode);
+#if defined(__APPLE__)
+    if (fd_ >= 0)
+    {
+        fcntl(fd_, F_NOCACHE, 1);
+    }
+#endif
+#endif
+
+    if (fd_ < 0)
+    {
+        int result = errno;
+        GFXRECON_LOG_ERROR("open(%s) failed (errno = %d: %s)", filename.c_str(), result, strerror(result));
+        return;
+    }
+
+    buffer_size_ = std::max(((buffer_size + kAlignment - 1) / kAlignment) * kAlignment, kAlignment);
+
+    // Direct I/O requires the memory of each write to be aligned, in addition to its size and file offset.
+    storage_.resize((buffer_size_ * 2) + kAlignment);
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage_.data());
+    address           = ((address + kAlignment - 1) / kAlignment) * kAlignment;
+    buffers_[0]       = reinterpret_cast<uint8_t*>(address);
+    buffers_[1]       = buffers_[0] + buffer_size_;
+
+    writer_thread_ = std::thread(&DirectFileOutputStream::WriterThreadMain, this);
+#endif
+}
+
+DirectFileOutputStream::~DirectFileOutputStream()
+{
+    Close();
+}
+
+void DirectFileOutputStream::Reset(FILE* file)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(file);
+    GFXRECON_LOG_ERROR("DirectFileOutputStream does not support replacing its file with a FILE stream");
+}
+
+bool DirectFileOutputStream::Write(const void* data, size_t len)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (fd_ < 0)
+    {
+        return false;
+    }
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
+    while (len > 0)
+    {
+        size_t copy_size = std::min(len, buffer_size_ - active_size_);
+        memcpy(buffers_[active_buffer_] + active_size_, bytes, copy_size);
+
+        active_size_ += copy_size;
+        bytes += copy_size;
+        len -= copy_size;
+
+        if (active_size_ == buffer_size_)
+        {
+            SubmitActiveBuffer(active_size_);
+        }
+    }
+
+    std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+    return !write_error_;
+}
+
+void DirectFileOutputStream::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (fd_ < 0)
+    {
+        return;
+    }
+
+    if (flush_partial_blocks_)
+    {
+        if (WaitForWriter())
+        {
+            WriteActiveBuffer();
+        }
+    }
+    else
+    {
+        // Writing the whole blocks from the background thread keeps the caller, which flushes on every present, from
+        // waiting for the disk. When the background thread is busy, the blocks are written with the next buffer.
+        const size_t full_size = (active_size_ / kAlignment) * kAlignment;
+        if ((full_size > 0) && IsWriterIdle())
+        {
+            SubmitActiveBuffer(full_size);
+        }
+    }
+}
+
+int64_t DirectFileOutputStream::GetOffset() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return active_offset_ + static_cast<int64_t>(active_size_);
+}
+
+bool DirectFileOutputStream::WriteAt(const uint8_t* data, size_t size, int64_t offset)
+{
+#if defined(WIN32)
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    return false;
+#else
+    while (size > 0)
+    {
+        ssize_t result = pwrite(fd_, data, size, static_cast<off_t>(offset));
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            int error = errno;
+            GFXRECON_LOG_ERROR("pwrite() failed (errno = %d: %s)", error, strerror(error));
+            return false;
+        }
+
+        data += result;
+        size -= static_cast<size_t>(result);
+        offset += result;
+    }
+
+    return true;
+#endif
+}
+
+bool DirectFileOutputStream::WaitForWriter()
+{
+    std::unique_lock<std::mutex> writer_lock(writer_mutex_);
+    writer_condition_.wait(writer_lock, [this]() { return pending_data_ == nullptr; });
+    return !write_error_;
+}
+
+bool DirectFileOutputStream::IsWriterIdle()
+{
+    std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+    return (pending_data_ == nullptr);
+}
+
+void DirectFileOutputStream::WriteActiveBuffer()
+{
+    if (active_size_ > 0)
+    {
+        uint8_t*     buffer       = buffers_[active_buffer_];
+        const size_t aligned_size = ((active_size_ + kAlignment - 1) / kAlignment) * kAlignment;
+        const size_t full_size    = (active_size_ / kAlignment) * kAlignment;
+
+        memset(buffer + active_size_, 0, aligned_size - active_size_);
+
+#if !defined(WIN32)
+        if (!WriteAt(buffer, aligned_size, active_offset_) || (ftruncate(fd_, active_offset_ + active_size_) != 0))
+        {
+            std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+            write_error_ = true;
+            return;
+        }
+#endif
+
+        // Keep the partial block at the start of the buffer, so that it is rewritten in place when it is filled.
+        if (full_size > 0)
+        {
+            memmove(buffer, buffer + full_size, active_size_ - full_size);
+            active_offset_ += full_size;
+            active_size_ -= full_size;
+        }
+    }
+}
+
+void DirectFileOutputStream::SubmitActiveBuffer(size_t size)
+{
+    assert((size % kAlignment) == 0);
+
+    // The other buffer can only be filled once the writer thread has finished with it.
+    WaitForWriter();
+
+    // The partial block that follows the submitted blocks continues at the start of the other buffer.
+    uint8_t*     buffer         = buffers_[active_buffer_];
+    const size_t remaining_size = active_size_ - size;
+    memcpy(buffers_[active_buffer_ ^ 1], buffer + size, remaining_size);
+
+    {
+        std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+        pending_data_   = buffer;
+        pending_size_   = size;
+        pending_offset_ = active_offset_;
+    }
+
+    writer_condition_.notify_all();
+
+    active_buffer_ ^= 1;
+    active_offset_ += static_cast<int64_t>(size);
+    active_size_ = remaining_size;
+}
+
+void DirectFileOutputStream::WriterThreadMain()
+{
+    std::unique_lock<std::mutex> writer_lock(writer_mutex_);
+
+    while (true)
+    {
+        writer_condition_.wait(writer_lock, [this]() { return (pending_data_ != nullptr) || stop_; });
+
+        if (pending_data_ == nullptr)
+        {
+            break;
+        }
+
+        const uint8_t* data   = pending_data_;
+        size_t         size   = pending_size_;
+        int64_t        offset = pending_offset_;
+
+        writer_lock.unlock();
+        bool success = WriteAt(data, size, offset);
+        writer_lock.lock();
+
+        write_error_  = write_error_ || !success;
+        pending_data_ = nullptr;
+        writer_condition_.notify_all();
+    }
+}
+
+void DirectFileOutputStream::Close()
+{
+    if (fd_ < 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (WaitForWriter())
+        {
+            WriteActiveBuffer();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+        stop_ = true;
+    }
+
+    writer_condition_.notify_all();
+    writer_thread_.join();
+
+#if !defined(WIN32)
+    close(fd_);
+#endif
+    fd_ = -1;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+/// @file Streaming into a file with large aligned writes that bypass the page cache.
+
+#ifndef GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/file_output_stream.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+/// @brief A FileOutputStream that writes through a file descriptor opened for direct I/O instead of a FILE.
+///
+/// Data is collected in two aligned buffers. When one buffer is full it is written to the file by a background thread
+/// while the caller continues to fill the other one, so the application only waits for the disk when both buffers are
+/// full. Direct I/O keeps capture data out of the page cache, which avoids the stalls caused by page cache writeback
+/// at high capture rates. When the file system does not support direct I/O, the file is opened for regular I/O and
+/// the buffers are still written by the background thread.
+///
+/// Direct I/O only writes whole blocks, so the last, partially filled block is written padded to the direct I/O
+/// alignment when the stream is closed, and the file is then truncated to the size of the data.
+///
+/// Direct I/O is only available on Linux, Android and macOS. On other platforms IsValid() returns false after
+/// construction.
+class DirectFileOutputStream : public FileOutputStream
+{
+  public:
+    /// @param buffer_size Size of each of the two write buffers. The size is rounded up to a multiple of the direct
+    /// I/O alignment.
+    /// @param flush_partial_blocks When true, Flush() also writes the last, partially filled block and waits for the
+    /// data to be written, as required for forced flushes.
+    DirectFileOutputStream(const std::string& filename, size_t buffer_size, bool flush_partial_blocks = false);
+
+    virtual ~DirectFileOutputStream() override;
+
+    virtual void Reset(FILE* file) override;
+
+    virtual bool IsValid() override { return (fd_ >= 0); }
+
+    virtual bool Write(const void* data, size_t len) override;
+
+    /// @brief Hands the buffered whole blocks to the background thread when it is idle, without waiting for them to be
+    /// written. When the stream was created with flush_partial_blocks, all buffered data is written before returning;
+    /// the last, partially filled block is written padded and the file is truncated to the size of the data, and the
+    /// block stays buffered to be written again when it is filled.
+    virtual void Flush() override;
+
+    virtual int64_t GetOffset() const override;
+
+  private:
+    bool WriteAt(const uint8_t* data, size_t size, int64_t offset);
+
+    bool WaitForWriter();
+
+    bool IsWriterIdle();
+
+    void WriteActiveBuffer();
+
+    void SubmitActiveBuffer(size_t size);
+
+    void WriterThreadMain();
+
+    void Close();
+
+  private:
+    static constexpr size_t kAlignment = 4096;
+
+    int                     fd_;
+    size_t                  buffer_size_;
+    std::vector<uint8_t>    storage_;
+    uint8_t*                buffers_[2];
+    uint32_t                active_buffer_;
+    size_t                  active_size_;
+    int64_t                 active_offset_;
+    mutable std::mutex      mutex_;
+    std::mutex              writer_mutex_;
+    std::condition_variable writer_condition_;
+    std::thread             writer_thread_;
+    const uint8_t*          pending_data_;
+    size_t                  pending_size_;
+    int64_t                 pending_offset_;
+    bool                    write_error_;
+    bool                    stop_;
+    bool                    flush_partial_blocks_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
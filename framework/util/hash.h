@@ -30,6 +30,8 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -154,6 +156,68 @@ static inline uint32_t murmur3_32(const K& key, uint32_t seed)
     return h;
 }
 
+inline uint64_t data_hash_64_round(uint64_t accumulator, uint64_t value)
+{
+    accumulator += value * 0xc2b2ae3d27d4eb4full;
+    accumulator = (accumulator << 31) | (accumulator >> 33);
+    accumulator *= 0x9e3779b185ebca87ull;
+    return accumulator;
+}
+
+// 64-bit hash for large blocks of memory, such as resource data. The data is consumed 32 bytes at a time by four
+// independent accumulators, which is considerably faster than GenerateCheckSum's byte at a time loop.
+inline uint64_t GenerateDataHash(const void* data, size_t size, uint64_t seed = 0)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end   = bytes + size;
+    uint64_t       h     = seed ^ (static_cast<uint64_t>(size) * 0x9e3779b185ebca87ull);
+
+    if (size >= 32)
+    {
+        uint64_t lanes[4] = {
+            seed + 0x60ea27eeadc0b5d6ull, seed + 0xc2b2ae3d27d4eb4full, seed, seed - 0x61c8864e7a143579ull
+        };
+
+        for (; (bytes + 32) <= end; bytes += 32)
+        {
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                uint64_t value;
+                memcpy(&value, bytes + (i * sizeof(uint64_t)), sizeof(value));
+                lanes[i] = data_hash_64_round(lanes[i], value);
+            }
+        }
+
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            h ^= data_hash_64_round(0, lanes[i]);
+            h = (h * 0x9e3779b185ebca87ull) + 0x85ebca77c2b2ae63ull;
+        }
+    }
+
+    for (; (bytes + sizeof(uint64_t)) <= end; bytes += sizeof(uint64_t))
+    {
+        uint64_t value;
+        memcpy(&value, bytes, sizeof(value));
+        h ^= data_hash_64_round(0, value);
+        h = (((h << 27) | (h >> 37)) * 0x9e3779b185ebca87ull) + 0x85ebca77c2b2ae63ull;
+    }
+
+    for (; bytes < end; ++bytes)
+    {
+        h ^= (*bytes) * 0x27d4eb2f165667c5ull;
+        h = ((h << 11) | (h >> 53)) * 0x9e3779b185ebca87ull;
+    }
+
+    // finalize
+    h ^= h >> 33;
+    h *= 0xc2b2ae3d27d4eb4full;
+    h ^= h >> 29;
+    h *= 0x165667b19e3779f9ull;
+    h ^= h >> 32;
+    return h;
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
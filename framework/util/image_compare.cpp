@@ -0,0 +1,319 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/image_compare.h"
+
+#include "util/file_path.h"
+#include "util/json_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(imagecompare)
+
+// The tile hash keeps kHashLanes independent 32-bit accumulators that each consume every kHashLanes'th pixel of a row.
+// The lanes have no dependencies on each other, which allows the compiler to map the inner loop to SIMD registers.
+static constexpr uint32_t kHashLanes    = 8;
+static constexpr uint32_t kHashPrime    = 0x9e3779b1;
+static constexpr uint64_t kCombinePrime = 0x100000001b3ull;
+static constexpr uint32_t kAlphaMask    = 0x00ffffff; // RGBA8 pixels loaded as little-endian 32-bit values.
+static constexpr double   kMaxValue     = 255.0;
+
+static inline uint32_t HashStep(uint32_t lane, uint32_t value)
+{
+    uint32_t v = (lane ^ value) * kHashPrime;
+    return (v << 13) | (v >> 19);
+}
+
+static uint64_t HashTile(const uint32_t* pixels,
+                         uint32_t        image_width,
+                         uint32_t        x_begin,
+                         uint32_t        y_begin,
+                         uint32_t        tile_width,
+                         uint32_t        tile_height,
+                         uint32_t        mask)
+{
+    uint32_t lanes[kHashLanes];
+    for (uint32_t i = 0; i < kHashLanes; ++i)
+    {
+        lanes[i] = i + 1;
+    }
+
+    for (uint32_t y = 0; y < tile_height; ++y)
+    {
+        const uint32_t* row = pixels + static_cast<size_t>(y_begin + y) * image_width + x_begin;
+        uint32_t        x   = 0;
+
+        for (; (x + kHashLanes) <= tile_width; x += kHashLanes)
+        {
+            for (uint32_t i = 0; i < kHashLanes; ++i)
+            {
+                lanes[i] = HashStep(lanes[i], row[x + i] & mask);
+            }
+        }
+
+        for (; x < tile_width; ++x)
+        {
+            lanes[x % kHashLanes] = HashStep(lanes[x % kHashLanes], row[x] & mask);
+        }
+    }
+
+    uint64_t hash = (static_cast<uint64_t>(tile_width) << 32) | tile_height;
+    for (uint32_t i = 0; i < kHashLanes; ++i)
+    {
+        hash = (hash ^ lanes[i]) * kCombinePrime;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+std::vector<uint64_t> ComputeTileHashes(const imagereader::ImageData& image, uint32_t tile_size, bool include_alpha)
+{
+    std::vector<uint64_t> hashes;
+
+    if ((tile_size == 0) || (image.pixels.size() < (static_cast<size_t>(image.width) * image.height * 4)))
+    {
+        return hashes;
+    }
+
+    const uint32_t  tiles_x = (image.width + tile_size - 1) / tile_size;
+    const uint32_t  tiles_y = (image.height + tile_size - 1) / tile_size;
+    const uint32_t  mask    = include_alpha ? 0xffffffff : kAlphaMask;
+    const uint32_t* pixels  = reinterpret_cast<const uint32_t*>(image.pixels.data());
+
+    hashes.reserve(static_cast<size_t>(tiles_x) * tiles_y);
+
+    for (uint32_t ty = 0; ty < tiles_y; ++ty)
+    {
+        const uint32_t y_begin     = ty * tile_size;
+        const uint32_t tile_height = std::min(tile_size, image.height - y_begin);
+
+        for (uint32_t tx = 0; tx < tiles_x; ++tx)
+        {
+            const uint32_t x_begin    = tx * tile_size;
+            const uint32_t tile_width = std::min(tile_size, image.width - x_begin);
+
+            hashes.push_back(HashTile(pixels, image.width, x_begin, y_begin, tile_width, tile_height, mask));
+        }
+    }
+
+    return hashes;
+}
+
+bool CompareImages(const imagereader::ImageData& reference,
+                   const imagereader::ImageData& test,
+                   CompareResult*                result,
+                   uint32_t                      tile_size)
+{
+    if ((result == nullptr) || (tile_size == 0))
+    {
+        return false;
+    }
+
+    *result = CompareResult{};
+
+    if ((reference.width != test.width) || (reference.height != test.height))
+    {
+        result->mismatched_pixels = std::max(static_cast<uint64_t>(reference.width) * reference.height,
+                                             static_cast<uint64_t>(test.width) * test.height);
+        return true;
+    }
+
+    result->size_match = true;
+
+    const bool     compare_alpha = reference.has_alpha && test.has_alpha;
+    const uint32_t channels      = compare_alpha ? 4 : 3;
+    const uint32_t tiles_x       = (reference.width + tile_size - 1) / tile_size;
+
+    const std::vector<uint64_t> reference_hashes = ComputeTileHashes(reference, tile_size, compare_alpha);
+    const std::vector<uint64_t> test_hashes      = ComputeTileHashes(test, tile_size, compare_alpha);
+
+    if (reference_hashes.size() != test_hashes.size())
+    {
+        return false;
+    }
+
+    result->tile_count = static_cast<uint32_t>(reference_hashes.size());
+
+    uint64_t squared_error_sum = 0;
+
+    for (size_t tile = 0; tile < reference_hashes.size(); ++tile)
+    {
+        if (reference_hashes[tile] == test_hashes[tile])
+        {
+            continue;
+        }
+
+        const uint32_t x_begin     = static_cast<uint32_t>(tile % tiles_x) * tile_size;
+        const uint32_t y_begin     = static_cast<uint32_t>(tile / tiles_x) * tile_size;
+        const uint32_t x_end       = std::min(x_begin + tile_size, reference.width);
+        const uint32_t y_end       = std::min(y_begin + tile_size, reference.height);
+        bool           tile_differ = false;
+
+        for (uint32_t y = y_begin; y < y_end; ++y)
+        {
+            const size_t   row_offset = static_cast<size_t>(y) * reference.width * 4;
+            const uint8_t* ref_row    = reference.pixels.data() + row_offset;
+            const uint8_t* test_row   = test.pixels.data() + row_offset;
+
+            for (uint32_t x = x_begin; x < x_end; ++x)
+            {
+                bool pixel_differ = false;
+
+                for (uint32_t c = 0; c < channels; ++c)
+                {
+                    const uint32_t error =
+                        static_cast<uint32_t>(std::abs(static_cast<int32_t>(ref_row[x * 4 + c]) - test_row[x * 4 + c]));
+
+                    if (error != 0)
+                    {
+                        pixel_differ      = true;
+                        result->max_error = std::max(result->max_error, error);
+                        squared_error_sum += static_cast<uint64_t>(error) * error;
+                    }
+                }
+
+                if (pixel_differ)
+                {
+                    ++result->mismatched_pixels;
+                    tile_differ = true;
+                }
+            }
+        }
+
+        if (tile_differ)
+        {
+            ++result->mismatched_tiles;
+        }
+    }
+
+    const double sample_count = static_cast<double>(reference.width) * reference.height * channels;
+    if ((squared_error_sum > 0) && (sample_count > 0))
+    {
+        result->mean_squared_error = static_cast<double>(squared_error_sum) / sample_count;
+        result->psnr               = 10.0 * std::log10((kMaxValue * kMaxValue) / result->mean_squared_error);
+    }
+
+    return true;
+}
+
+std::string FindImageFile(const std::string& directory, const std::string& basename)
+{
+    for (size_t i = 0; i < imagereader::kSupportedImageExtensionCount; ++i)
+    {
+        std::string filename = util::filepath::Join(directory, basename + imagereader::kSupportedImageExtensions[i]);
+        if (util::filepath::IsFile(filename))
+        {
+            return filename;
+        }
+    }
+
+    return std::string();
+}
+
+bool WriteJsonReport(const std::string& filename, const std::vector<CompareEntry>& entries)
+{
+    nlohmann::ordered_json report;
+    nlohmann::ordered_json images = nlohmann::ordered_json::array();
+
+    uint32_t identical_count = 0;
+    uint32_t different_count = 0;
+    uint32_t missing_count   = 0;
+
+    for (const auto& entry : entries)
+    {
+        nlohmann::ordered_json image;
+        image["name"]      = entry.name;
+        image["reference"] = entry.reference_file;
+        image["test"]      = entry.test_file;
+
+        if (!entry.reference_found || !entry.test_found)
+        {
+            image["status"] = "missing";
+            ++missing_count;
+        }
+        else
+        {
+            const CompareResult& result = entry.result;
+
+            image["status"]            = result.IsIdentical() ? "identical" : "different";
+            image["size_match"]        = result.size_match;
+            image["tile_count"]        = result.tile_count;
+            image["mismatched_tiles"]  = result.mismatched_tiles;
+            image["mismatched_pixels"] = result.mismatched_pixels;
+            image["max_error"]         = result.max_error;
+            image["mse"]               = result.mean_squared_error;
+
+            if (result.IsIdentical())
+            {
+                image["psnr"] = nullptr;
+                ++identical_count;
+            }
+            else
+            {
+                image["psnr"] = result.psnr;
+                ++different_count;
+            }
+        }
+
+        images.push_back(std::move(image));
+    }
+
+    report["summary"]["total"]     = entries.size();
+    report["summary"]["identical"] = identical_count;
+    report["summary"]["different"] = different_count;
+    report["summary"]["missing"]   = missing_count;
+    report["images"]               = std::move(images);
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open image comparison report file %s", filename.c_str());
+        return false;
+    }
+
+    const std::string report_string = report.dump(util::kJsonIndentWidth);
+    bool              success       = util::platform::FilePuts(report_string.c_str(), file);
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write image comparison report file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(imagecompare)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,84 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_IMAGE_COMPARE_H
+#define GFXRECON_UTIL_IMAGE_COMPARE_H
+
+#include "util/defines.h"
+#include "util/image_reader.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(imagecompare)
+
+const uint32_t kDefaultTileSize = 64;
+
+struct CompareResult
+{
+    bool     size_match{ false };
+    uint32_t tile_count{ 0 };
+    uint32_t mismatched_tiles{ 0 };
+    uint64_t mismatched_pixels{ 0 };
+    uint32_t max_error{ 0 };     // Largest absolute per-channel difference.
+    double   mean_squared_error{ 0.0 };
+    double   psnr{ 0.0 };        // Peak signal-to-noise ratio in dB; only meaningful when mismatched_pixels > 0.
+
+    bool IsIdentical() const { return size_match && (mismatched_pixels == 0); }
+};
+
+struct CompareEntry
+{
+    std::string   name;
+    std::string   reference_file;
+    std::string   test_file;
+    bool          reference_found{ false };
+    bool          test_found{ false };
+    CompareResult result;
+};
+
+// Computes one hash per tile_size x tile_size tile, in row-major tile order. The alpha channel is only hashed when
+// include_alpha is true.
+std::vector<uint64_t>
+ComputeTileHashes(const imagereader::ImageData& image, uint32_t tile_size, bool include_alpha);
+
+// Compares two images tile by tile. Tiles are first compared by hash, and only tiles with different hashes are compared
+// pixel by pixel to compute the error metrics. Alpha is only compared when both images have an alpha channel.
+bool CompareImages(const imagereader::ImageData& reference,
+                   const imagereader::ImageData& test,
+                   CompareResult*                result,
+                   uint32_t                      tile_size = kDefaultTileSize);
+
+// Searches directory for a file named basename with one of the extensions supported by imagereader::ReadImage.
+// Returns an empty string if no such file exists.
+std::string FindImageFile(const std::string& directory, const std::string& basename);
+
+bool WriteJsonReport(const std::string& filename, const std::vector<CompareEntry>& entries);
+
+GFXRECON_END_NAMESPACE(imagecompare)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_IMAGE_COMPARE_H
@@ -0,0 +1,683 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/image_reader.h"
+
+#include "util/file_path.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+#include <zlib.h>
+#endif
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+#include "zstd.h"
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(imagereader)
+
+const char* const kSupportedImageExtensions[] = { ".bmp", ".png", ".qoi", ".zst" };
+const size_t      kSupportedImageExtensionCount =
+    sizeof(kSupportedImageExtensions) / sizeof(kSupportedImageExtensions[0]);
+
+static const uint8_t kPngSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+const size_t kPngChunkOverhead = 12;
+const size_t kPngIhdrLength    = 13;
+const size_t kQoiHeaderSize    = 14;
+
+// Upper bounds on how much the pixel data can expand while decoding, used to reject image dimensions that the file
+// could not possibly contain before allocating memory for them. Deflate expands data by at most 1032:1, a 4 byte zstd
+// RLE block decodes to at most 128 KiB, and a single QOI run byte encodes at most 62 pixels.
+const size_t kMaxDeflateRatio = 1032;
+const size_t kMaxZstdRatio    = 32768;
+const size_t kMaxQoiRunLength = 62;
+
+static uint32_t ReadBigEndianUint32(const uint8_t* src)
+{
+    return (static_cast<uint32_t>(src[0]) << 24) | (static_cast<uint32_t>(src[1]) << 16) |
+           (static_cast<uint32_t>(src[2]) << 8) | static_cast<uint32_t>(src[3]);
+}
+
+static bool ReadFileData(const std::string& filename, std::vector<uint8_t>* file_data)
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open image file %s", filename.c_str());
+        return false;
+    }
+
+    bool success = false;
+
+    if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        int64_t file_size = util::platform::FileTell(file);
+        if ((file_size > 0) && util::platform::FileSeek(file, 0, util::platform::FileSeekSet))
+        {
+            file_data->resize(static_cast<size_t>(file_size));
+            success = util::platform::FileRead(file_data->data(), file_data->size(), file);
+        }
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to read image file %s", filename.c_str());
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+// Computes width * height * element_size, failing for empty images and for sizes that do not fit in a size_t.
+static bool GetImageByteSize(uint32_t width, uint32_t height, size_t element_size, size_t* byte_size)
+{
+    const size_t max_size = std::numeric_limits<size_t>::max();
+
+    if ((width == 0) || (height == 0) || (element_size == 0) || ((max_size / element_size) < width) ||
+        ((max_size / (element_size * width)) < height))
+    {
+        return false;
+    }
+
+    *byte_size = element_size * width * height;
+    return true;
+}
+
+static void InitializeImage(uint32_t width, uint32_t height, bool has_alpha, ImageData* image)
+{
+    image->width     = width;
+    image->height    = height;
+    image->has_alpha = has_alpha;
+    image->pixels.resize(static_cast<size_t>(width) * height * 4);
+}
+
+bool ReadImage(const std::string& filename, ImageData* image)
+{
+    const std::string extension = util::filepath::GetFilenameExtension(filename);
+
+    if (util::platform::StringCompareNoCase(extension.c_str(), ".bmp") == 0)
+    {
+        return ReadBmpImage(filename, image);
+    }
+    else if (util::platform::StringCompareNoCase(extension.c_str(), ".png") == 0)
+    {
+        return ReadPngImage(filename, image);
+    }
+    else if (util::platform::StringCompareNoCase(extension.c_str(), ".qoi") == 0)
+    {
+        return ReadQoiImage(filename, image);
+    }
+    else if (util::platform::StringCompareNoCase(extension.c_str(), ".zst") == 0)
+    {
+        return ReadZstdImage(filename, image);
+    }
+
+    GFXRECON_LOG_ERROR("Unrecognized image file extension for %s", filename.c_str());
+    return false;
+}
+
+bool ReadBmpImage(const std::string& filename, ImageData* image)
+{
+    std::vector<uint8_t> file_data;
+    if ((image == nullptr) || !ReadFileData(filename, &file_data))
+    {
+        return false;
+    }
+
+    imagewriter::BmpFileHeader file_header;
+    imagewriter::BmpInfoHeader info_header;
+
+    if (file_data.size() < (sizeof(file_header) + sizeof(info_header)))
+    {
+        GFXRECON_LOG_ERROR("Invalid BMP file %s: file is too small", filename.c_str());
+        return false;
+    }
+
+    memcpy(&file_header, file_data.data(), sizeof(file_header));
+    memcpy(&info_header, file_data.data() + sizeof(file_header), sizeof(info_header));
+
+    if ((file_header.type != (('M' << 8) | 'B')) || (info_header.compression != 0) ||
+        ((info_header.bit_count != 24) && (info_header.bit_count != 32)))
+    {
+        GFXRECON_LOG_ERROR("Unsupported BMP file %s: only uncompressed 24 and 32 bit images are supported",
+                           filename.c_str());
+        return false;
+    }
+
+    if ((info_header.width <= 0) || (info_header.height == 0))
+    {
+        GFXRECON_LOG_ERROR("Invalid BMP file %s: invalid image dimensions", filename.c_str());
+        return false;
+    }
+
+    const bool     top_down  = info_header.height < 0;
+    const uint32_t width     = static_cast<uint32_t>(info_header.width);
+    const uint32_t height    = top_down ? (0u - static_cast<uint32_t>(info_header.height))
+                                        : static_cast<uint32_t>(info_header.height);
+    const uint32_t bpp       = info_header.bit_count / 8;
+    const size_t   data_size = (file_header.off_bits < file_data.size()) ? (file_data.size() - file_header.off_bits)
+                                                                         : 0;
+    size_t         row_size  = 0;
+
+    if (!GetImageByteSize(width, 1, bpp, &row_size) || (row_size > data_size))
+    {
+        GFXRECON_LOG_ERROR("Invalid BMP file %s: pixel data is truncated", filename.c_str());
+        return false;
+    }
+
+    // The height is compared against the number of rows that fit in the file, instead of multiplying it by the row
+    // pitch, so that a large height cannot overflow the pixel data size and wrap around to a value that fits.
+    const size_t row_pitch = (row_size + 3) & ~static_cast<size_t>(3);
+    if (height > (data_size / row_pitch))
+    {
+        GFXRECON_LOG_ERROR("Invalid BMP file %s: pixel data is truncated", filename.c_str());
+        return false;
+    }
+
+    InitializeImage(width, height, bpp == 4, image);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const uint32_t src_row = top_down ? y : (height - 1 - y);
+        const uint8_t* src     = file_data.data() + file_header.off_bits + src_row * row_pitch;
+        uint8_t*       dst     = image->pixels.data() + static_cast<size_t>(y) * width * 4;
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            dst[0] = src[2];
+            dst[1] = src[1];
+            dst[2] = src[0];
+            dst[3] = (bpp == 4) ? src[3] : 0xff;
+            src += bpp;
+            dst += 4;
+        }
+    }
+
+    return true;
+}
+
+bool ReadPngImage(const std::string& filename, ImageData* image)
+{
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+    std::vector<uint8_t> file_data;
+    if ((image == nullptr) || !ReadFileData(filename, &file_data))
+    {
+        return false;
+    }
+
+    if ((file_data.size() < sizeof(kPngSignature)) ||
+        (memcmp(file_data.data(), kPngSignature, sizeof(kPngSignature)) != 0))
+    {
+        GFXRECON_LOG_ERROR("Invalid PNG file %s: missing PNG signature", filename.c_str());
+        return false;
+    }
+
+    uint32_t             width      = 0;
+    uint32_t             height     = 0;
+    uint32_t             channels   = 0;
+    uint8_t              color_type = 0;
+    std::vector<uint8_t> compressed;
+
+    size_t offset = sizeof(kPngSignature);
+    while ((file_data.size() - offset) >= kPngChunkOverhead)
+    {
+        const uint32_t length = ReadBigEndianUint32(&file_data[offset]);
+        const uint8_t* type   = &file_data[offset + 4];
+        const uint8_t* data   = &file_data[offset + 8];
+
+        if (length > (file_data.size() - offset - kPngChunkOverhead))
+        {
+            GFXRECON_LOG_ERROR("Invalid PNG file %s: chunk data is truncated", filename.c_str());
+            return false;
+        }
+
+        // The IHDR chunk must be the first chunk and must appear exactly once.
+        const bool is_header = (memcmp(type, "IHDR", 4) == 0);
+        if ((is_header != (offset == sizeof(kPngSignature))) || (is_header && (length != kPngIhdrLength)))
+        {
+            GFXRECON_LOG_ERROR("Invalid PNG file %s: invalid image header chunk", filename.c_str());
+            return false;
+        }
+
+        if (is_header)
+        {
+            width      = ReadBigEndianUint32(&data[0]);
+            height     = ReadBigEndianUint32(&data[4]);
+            color_type = data[9];
+
+            // Only the non-interlaced 8 bit images produced by imagewriter are supported.
+            if ((data[8] != 8) || (data[12] != 0))
+            {
+                GFXRECON_LOG_ERROR("Unsupported PNG file %s: only non-interlaced 8 bit images are supported",
+                                   filename.c_str());
+                return false;
+            }
+
+            switch (color_type)
+            {
+                case 0:
+                    channels = 1;
+                    break;
+                case 2:
+                    channels = 3;
+                    break;
+                case 4:
+                    channels = 2;
+                    break;
+                case 6:
+                    channels = 4;
+                    break;
+                default:
+                    GFXRECON_LOG_ERROR("Unsupported PNG file %s: color type %u", filename.c_str(), color_type);
+                    return false;
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0)
+        {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            break;
+        }
+
+        offset += kPngChunkOverhead + length;
+    }
+
+    if ((channels == 0) || compressed.empty())
+    {
+        GFXRECON_LOG_ERROR("Invalid PNG file %s: missing image header or data", filename.c_str());
+        return false;
+    }
+
+    // Each row of the decompressed data is prefixed with a filter type byte.
+    size_t row_pitch   = 0;
+    size_t data_size   = 0;
+    size_t pixels_size = 0;
+    if (!GetImageByteSize(width, 1, channels, &row_pitch) || !GetImageByteSize(1, height, row_pitch + 1, &data_size) ||
+        !GetImageByteSize(width, height, 4, &pixels_size) || ((data_size / kMaxDeflateRatio) > compressed.size()))
+    {
+        GFXRECON_LOG_ERROR("Invalid PNG file %s: invalid image dimensions %ux%u", filename.c_str(), width, height);
+        return false;
+    }
+
+    std::vector<uint8_t> filtered(data_size);
+    uLongf               filtered_size = static_cast<uLongf>(filtered.size());
+
+    if ((uncompress(filtered.data(), &filtered_size, compressed.data(), static_cast<uLong>(compressed.size())) !=
+         Z_OK) ||
+        (filtered_size != filtered.size()))
+    {
+        GFXRECON_LOG_ERROR("Invalid PNG file %s: failed to decompress image data", filename.c_str());
+        return false;
+    }
+
+    // Reverse the per-row PNG filters in place.
+    std::vector<uint8_t> zero_row(row_pitch, 0);
+    const uint8_t*       prev = zero_row.data();
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        uint8_t*      row    = &filtered[y * (row_pitch + 1)];
+        const uint8_t filter = *(row++);
+
+        for (size_t x = 0; x < row_pitch; ++x)
+        {
+            const int32_t a = (x >= channels) ? row[x - channels] : 0;
+            const int32_t b = prev[x];
+            const int32_t c = (x >= channels) ? prev[x - channels] : 0;
+
+            switch (filter)
+            {
+                case 0:
+                    break;
+                case 1:
+                    row[x] = static_cast<uint8_t>(row[x] + a);
+                    break;
+                case 2:
+                    row[x] = static_cast<uint8_t>(row[x] + b);
+                    break;
+                case 3:
+                    row[x] = static_cast<uint8_t>(row[x] + ((a + b) >> 1));
+                    break;
+                case 4:
+                {
+                    const int32_t p  = a + b - c;
+                    const int32_t pa = std::abs(p - a);
+                    const int32_t pb = std::abs(p - b);
+                    const int32_t pc = std::abs(p - c);
+                    row[x] = static_cast<uint8_t>(row[x] + (((pa <= pb) && (pa <= pc)) ? a : ((pb <= pc) ? b : c)));
+                    break;
+                }
+                default:
+                    GFXRECON_LOG_ERROR("Invalid PNG file %s: unknown filter type %u", filename.c_str(), filter);
+                    return false;
+            }
+        }
+
+        prev = row;
+    }
+
+    InitializeImage(width, height, (color_type == 4) || (color_type == 6), image);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const uint8_t* src = &filtered[y * (row_pitch + 1) + 1];
+        uint8_t*       dst = image->pixels.data() + static_cast<size_t>(y) * width * 4;
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            if (channels <= 2)
+            {
+                dst[0] = src[0];
+                dst[1] = src[0];
+                dst[2] = src[0];
+                dst[3] = (channels == 2) ? src[1] : 0xff;
+            }
+            else
+            {
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+                dst[3] = (channels == 4) ? src[3] : 0xff;
+            }
+            src += channels;
+            dst += 4;
+        }
+    }
+
+    return true;
+#else
+    GFXRECON_LOG_ERROR("Cannot read PNG file %s: zlib support is not available in this build", filename.c_str());
+    return false;
+#endif
+}
+
+bool ReadQoiImage(const std::string& filename, ImageData* image)
+{
+    std::vector<uint8_t> file_data;
+    if ((image == nullptr) || !ReadFileData(filename, &file_data))
+    {
+        return false;
+    }
+
+    if ((file_data.size() < kQoiHeaderSize) || (memcmp(file_data.data(), "qoif", 4) != 0))
+    {
+        GFXRECON_LOG_ERROR("Invalid QOI file %s: missing QOI header", filename.c_str());
+        return false;
+    }
+
+    const uint32_t width       = ReadBigEndianUint32(&file_data[4]);
+    const uint32_t height      = ReadBigEndianUint32(&file_data[8]);
+    const uint8_t  channels    = file_data[12];
+    size_t         pixel_count = 0;
+    size_t         pixels_size = 0;
+
+    if (!GetImageByteSize(width, height, 1, &pixel_count) || !GetImageByteSize(width, height, 4, &pixels_size) ||
+        ((pixel_count / kMaxQoiRunLength) > (file_data.size() - kQoiHeaderSize)))
+    {
+        GFXRECON_LOG_ERROR("Invalid QOI file %s: invalid image dimensions %ux%u", filename.c_str(), width, height);
+        return false;
+    }
+
+    InitializeImage(width, height, channels == 4, image);
+
+    const size_t end          = file_data.size();
+    size_t       pos          = kQoiHeaderSize;
+    uint8_t      index[64][4] = {};
+    uint8_t      px[4]        = { 0, 0, 0, 255 };
+    uint32_t     run          = 0;
+
+    for (size_t i = 0; i < pixel_count; ++i)
+    {
+        if (run > 0)
+        {
+            --run;
+        }
+        else if (pos < end)
+        {
+            const uint8_t b1 = file_data[pos++];
+
+            if (b1 == 0xfe)
+            {
+                if ((pos + 3) > end)
+                {
+                    break;
+                }
+                px[0] = file_data[pos++];
+                px[1] = file_data[pos++];
+                px[2] = file_data[pos++];
+            }
+            else if (b1 == 0xff)
+            {
+                if ((pos + 4) > end)
+                {
+                    break;
+                }
+                px[0] = file_data[pos++];
+                px[1] = file_data[pos++];
+                px[2] = file_data[pos++];
+                px[3] = file_data[pos++];
+            }
+            else if ((b1 & 0xc0) == 0x00)
+            {
+                memcpy(px, index[b1], sizeof(px));
+            }
+            else if ((b1 & 0xc0) == 0x40)
+            {
+                px[0] = static_cast<uint8_t>(px[0] + ((b1 >> 4) & 0x03) - 2);
+                px[1] = static_cast<uint8_t>(px[1] + ((b1 >> 2) & 0x03) - 2);
+                px[2] = static_cast<uint8_t>(px[2] + (b1 & 0x03) - 2);
+            }
+            else if ((b1 & 0xc0) == 0x80)
+            {
+                if (pos >= end)
+                {
+                    break;
+                }
+                const uint8_t b2 = file_data[pos++];
+                const int32_t vg = (b1 & 0x3f) - 32;
+                px[0]            = static_cast<uint8_t>(px[0] + vg - 8 + ((b2 >> 4) & 0x0f));
+                px[1]            = static_cast<uint8_t>(px[1] + vg);
+                px[2]            = static_cast<uint8_t>(px[2] + vg - 8 + (b2 & 0x0f));
+            }
+            else
+            {
+                run = b1 & 0x3f;
+            }
+
+            memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, sizeof(px));
+        }
+        else
+        {
+            break;
+        }
+
+        uint8_t* dst = &image->pixels[i * 4];
+        dst[0]       = px[0];
+        dst[1]       = px[1];
+        dst[2]       = px[2];
+        dst[3]       = (channels == 4) ? px[3] : 0xff;
+
+        if ((i + 1) == pixel_count)
+        {
+            return true;
+        }
+    }
+
+    GFXRECON_LOG_ERROR("Invalid QOI file %s: pixel data is truncated", filename.c_str());
+    return false;
+}
+
+bool ReadZstdImage(const std::string& filename, ImageData* image)
+{
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    std::vector<uint8_t> file_data;
+    if ((image == nullptr) || !ReadFileData(filename, &file_data))
+    {
+        return false;
+    }
+
+    const unsigned long long content_size = ZSTD_getFrameContentSize(file_data.data(), file_data.size());
+    if ((content_size == ZSTD_CONTENTSIZE_UNKNOWN) || (content_size == ZSTD_CONTENTSIZE_ERROR) ||
+        (content_size < sizeof(imagewriter::RawImageHeader)))
+    {
+        GFXRECON_LOG_ERROR("Invalid zstd image file %s: unknown content size", filename.c_str());
+        return false;
+    }
+
+    // The content size comes from the frame header, so it is checked against what the frame could actually contain
+    // before allocating the decompression buffer.
+    if ((content_size > std::numeric_limits<size_t>::max()) || ((content_size / kMaxZstdRatio) > file_data.size()))
+    {
+        GFXRECON_LOG_ERROR("Invalid zstd image file %s: content size %llu exceeds the file data",
+                           filename.c_str(),
+                           content_size);
+        return false;
+    }
+
+    std::vector<uint8_t> content(static_cast<size_t>(content_size));
+    const size_t         result = ZSTD_decompress(content.data(), content.size(), file_data.data(), file_data.size());
+    if (ZSTD_isError(result) || (result != content.size()))
+    {
+        GFXRECON_LOG_ERROR("Invalid zstd image file %s: failed to decompress image data", filename.c_str());
+        return false;
+    }
+
+    imagewriter::RawImageHeader header;
+    memcpy(&header, content.data(), sizeof(header));
+
+    size_t pixel_data_size = 0;
+    if ((header.magic != imagewriter::kRawImageMagic) || ((header.channels != 3) && (header.channels != 4)) ||
+        !GetImageByteSize(header.width, header.height, header.channels, &pixel_data_size) ||
+        (pixel_data_size > (content.size() - sizeof(header))))
+    {
+        GFXRECON_LOG_ERROR("Invalid zstd image file %s: invalid image header", filename.c_str());
+        return false;
+    }
+
+    return ConvertImageData(header.width,
+                            header.height,
+                            content.data() + sizeof(header),
+                            header.width * header.channels,
+                            (header.channels == 4) ? imagewriter::kFormat_RGBA : imagewriter::kFormat_RGB,
+                            header.channels == 4,
+                            image);
+#else
+    GFXRECON_LOG_ERROR("Cannot read zstd image file %s: zstd support is not available in this build",
+                       filename.c_str());
+    return false;
+#endif
+}
+
+bool ConvertImageData(uint32_t                 width,
+                      uint32_t                 height,
+                      const void*              data,
+                      uint32_t                 pitch,
+                      imagewriter::DataFormats format,
+                      bool                     has_alpha,
+                      ImageData*               image)
+{
+    if ((image == nullptr) || (data == nullptr))
+    {
+        return false;
+    }
+
+    uint32_t bpp       = 0;
+    bool     swap_rb   = false;
+    bool     src_alpha = false;
+
+    switch (format)
+    {
+        case imagewriter::kFormat_RGB:
+            bpp = 3;
+            break;
+        case imagewriter::kFormat_BGR:
+            bpp     = 3;
+            swap_rb = true;
+            break;
+        case imagewriter::kFormat_RGBA:
+            bpp       = 4;
+            src_alpha = true;
+            break;
+        case imagewriter::kFormat_BGRA:
+            bpp       = 4;
+            swap_rb   = true;
+            src_alpha = true;
+            break;
+        default:
+            GFXRECON_LOG_ERROR("%s(): Unsupported format %u", __func__, static_cast<uint32_t>(format));
+            return false;
+    }
+
+    size_t row_size    = 0;
+    size_t pixels_size = 0;
+    if (!GetImageByteSize(width, 1, bpp, &row_size) || !GetImageByteSize(width, height, 4, &pixels_size) ||
+        (row_size > std::numeric_limits<uint32_t>::max()) || ((pitch != 0) && (pitch < row_size)))
+    {
+        GFXRECON_LOG_ERROR("%s(): Invalid image dimensions %ux%u with pitch %u", __func__, width, height, pitch);
+        return false;
+    }
+
+    if (pitch == 0)
+    {
+        pitch = static_cast<uint32_t>(row_size);
+    }
+
+    has_alpha = has_alpha && src_alpha;
+
+    InitializeImage(width, height, has_alpha, image);
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const uint8_t* src = bytes + static_cast<size_t>(y) * pitch;
+        uint8_t*       dst = image->pixels.data() + static_cast<size_t>(y) * width * 4;
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            dst[0] = swap_rb ? src[2] : src[0];
+            dst[1] = src[1];
+            dst[2] = swap_rb ? src[0] : src[2];
+            dst[3] = has_alpha ? src[3] : 0xff;
+            src += bpp;
+            dst += 4;
+        }
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(imagereader)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
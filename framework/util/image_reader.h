@@ -0,0 +1,76 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_IMAGE_READER_H
+#define GFXRECON_UTIL_IMAGE_READER_H
+
+#include "util/defines.h"
+#include "util/image_writer.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(imagereader)
+
+// Decoded image, stored as tightly packed, top-down RGBA8 pixels. Images without an alpha channel are expanded with
+// an alpha value of 255.
+struct ImageData
+{
+    uint32_t             width{ 0 };
+    uint32_t             height{ 0 };
+    bool                 has_alpha{ false };
+    std::vector<uint8_t> pixels;
+};
+
+// File extensions, including the leading '.', for the formats that can be read by ReadImage.
+extern const char* const kSupportedImageExtensions[];
+extern const size_t      kSupportedImageExtensionCount;
+
+// Reads the BMP, PNG, QOI and raw + zstd files that are produced by the imagewriter functions. The file format is
+// selected from the file extension.
+bool ReadImage(const std::string& filename, ImageData* image);
+
+bool ReadBmpImage(const std::string& filename, ImageData* image);
+
+bool ReadPngImage(const std::string& filename, ImageData* image);
+
+bool ReadQoiImage(const std::string& filename, ImageData* image);
+
+bool ReadZstdImage(const std::string& filename, ImageData* image);
+
+// Converts in-memory pixel data, such as a screenshot that was read back from the GPU, to the ImageData layout.
+bool ConvertImageData(uint32_t                 width,
+                      uint32_t                 height,
+                      const void*              data,
+                      uint32_t                 pitch,
+                      imagewriter::DataFormats format,
+                      bool                     has_alpha,
+                      ImageData*               image);
+
+GFXRECON_END_NAMESPACE(imagereader)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_IMAGE_READER_H
@@ -26,6 +26,9 @@
 #include "platform.h"
 #include "util/file_path.h"
 #include "util/logging.h"
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+#include "util/zstd_compressor.h"
+#endif
 
 #include <assert.h>
 #include <cstddef>
@@ -39,14 +42,157 @@
 #endif
 
 #if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION) && defined(GFXRECON_ENABLE_PNG_SCREENSHOT)
+#include "util/threadpool.h"
+
 #include <zlib.h>
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Images with less filtered PNG data than this are compressed on the calling thread.
+static constexpr int32_t kMinParallelDeflateSize = 1024 * 1024;
+// Size of the row stripes that are deflated independently when compressing in parallel.
+static constexpr size_t kDeflateStripeSize = 256 * 1024;
+// Size of the deflate window, used to prime each stripe with the tail of the previous stripe.
+static constexpr size_t kDeflateDictionarySize = 32 * 1024;
+
+struct DeflateStripeResult
+{
+    std::vector<uint8_t> data;
+    uLong                adler{ 0 };
+    bool                 success{ false };
+};
+
+// Deflates one stripe of the PNG data as a raw deflate stream. All stripes except the last one end with a sync flush
+// so that the stripes can be concatenated into a single valid deflate stream, as is done by pigz.
+static DeflateStripeResult DeflateStripe(
+    const uint8_t* data, size_t data_len, const uint8_t* dictionary, size_t dictionary_len, bool last, int32_t quality)
+{
+    DeflateStripeResult result;
+    z_stream            stream = {};
+
+    if (Z_OK != deflateInit2(&stream, quality, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY))
+    {
+        return result;
+    }
+
+    if ((dictionary != nullptr) && (dictionary_len > 0))
+    {
+        deflateSetDictionary(&stream, dictionary, static_cast<uInt>(dictionary_len));
+    }
+
+    // Leave room for the sync flush marker, which is not accounted for by deflateBound.
+    result.data.resize(deflateBound(&stream, static_cast<uLong>(data_len)) + 16);
+
+    stream.next_in   = const_cast<Bytef*>(data);
+    stream.avail_in  = static_cast<uInt>(data_len);
+    stream.next_out  = result.data.data();
+    stream.avail_out = static_cast<uInt>(result.data.size());
+
+    int ret = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+    if ((last && (ret == Z_STREAM_END)) || (!last && (ret == Z_OK) && (stream.avail_in == 0)))
+    {
+        result.data.resize(stream.total_out);
+        result.adler   = adler32(adler32(0L, Z_NULL, 0), data, static_cast<uInt>(data_len));
+        result.success = true;
+    }
+
+    deflateEnd(&stream);
+
+    return result;
+}
+
+// Splits the PNG data into stripes that are deflated in parallel, then stitches the results into a single zlib stream.
+static uint8_t* ParallelDeflate(uint8_t* data, int32_t data_len, int32_t* out_len, int32_t quality)
+{
+    static gfxrecon::util::ThreadPool thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+
+    const size_t total_size   = static_cast<size_t>(data_len);
+    const size_t stripe_count = (total_size + kDeflateStripeSize - 1) / kDeflateStripeSize;
+
+    std::vector<std::future<DeflateStripeResult>> stripes;
+    stripes.reserve(stripe_count);
+
+    for (size_t i = 0; i < stripe_count; ++i)
+    {
+        const size_t   offset         = i * kDeflateStripeSize;
+        const size_t   stripe_len     = std::min(kDeflateStripeSize, total_size - offset);
+        const size_t   dictionary_len = std::min(kDeflateDictionarySize, offset);
+        const uint8_t* dictionary     = data + offset - dictionary_len;
+        const bool     last           = (i == (stripe_count - 1));
+
+        stripes.emplace_back(
+            thread_pool.post(DeflateStripe, data + offset, stripe_len, dictionary, dictionary_len, last, quality));
+    }
+
+    std::vector<DeflateStripeResult> results;
+    results.reserve(stripe_count);
+
+    size_t compressed_size = 0;
+    bool   success         = true;
+    for (auto& stripe : stripes)
+    {
+        results.emplace_back(stripe.get());
+        compressed_size += results.back().data.size();
+        success = success && results.back().success;
+    }
+
+    if (!success)
+    {
+        return nullptr;
+    }
+
+    // zlib header (2 bytes) + deflate stream + adler32 checksum (4 bytes).
+    auto* target = reinterpret_cast<uint8_t*>(malloc(compressed_size + 6));
+    if (nullptr == target)
+    {
+        return nullptr;
+    }
+
+    uint8_t* write_ptr = target;
+    *(write_ptr++)     = 0x78;
+    *(write_ptr++)     = 0x9c;
+
+    uLong adler = adler32(0L, Z_NULL, 0);
+    for (size_t i = 0; i < stripe_count; ++i)
+    {
+        const size_t offset     = i * kDeflateStripeSize;
+        const size_t stripe_len = std::min(kDeflateStripeSize, total_size - offset);
+
+        memcpy(write_ptr, results[i].data.data(), results[i].data.size());
+        write_ptr += results[i].data.size();
+        adler = adler32_combine(adler, results[i].adler, static_cast<z_off_t>(stripe_len));
+    }
+
+    *(write_ptr++) = static_cast<uint8_t>((adler >> 24) & 0xff);
+    *(write_ptr++) = static_cast<uint8_t>((adler >> 16) & 0xff);
+    *(write_ptr++) = static_cast<uint8_t>((adler >> 8) & 0xff);
+    *(write_ptr++) = static_cast<uint8_t>(adler & 0xff);
+
+    *out_len = static_cast<int32_t>(write_ptr - target);
+
+    return target;
+}
+
 // This function re-formats the call to the Zlib compress2 function so that we can
 // use it in the STB PNG generation code.  Using the default STB PNG compression
 // resulted in a 20% reduction versus the original image in tests, while using the
 // zlib compress2 function resulted in a 40+% reduction versus the original image.
+// Large images are split into stripes that are compressed on multiple threads.
 uint8_t* GFXRECON_zlib_compress2(uint8_t* data, int32_t data_len, int32_t* out_len, int32_t quality)
 {
+    if (data_len >= kMinParallelDeflateSize)
+    {
+        uint8_t* target = ParallelDeflate(data, data_len, out_len, quality);
+        if (nullptr != target)
+        {
+            return target;
+        }
+    }
+
     unsigned long alloc_len = compressBound(static_cast<uLong>(data_len));
     auto*         target    = reinterpret_cast<uint8_t*>(malloc(alloc_len));
     if (nullptr != target)
@@ -584,6 +730,308 @@ bool WritePngImageSeparateAlpha(const std::string& filename,
     return success;
 }
 
+static const uint8_t kQoiOpIndex = 0x00;
+static const uint8_t kQoiOpDiff  = 0x40;
+static const uint8_t kQoiOpLuma  = 0x80;
+static const uint8_t kQoiOpRun   = 0xc0;
+static const uint8_t kQoiOpRgb   = 0xfe;
+static const uint8_t kQoiOpRgba  = 0xff;
+
+static const uint32_t kQoiHeaderSize = 14;
+static const uint8_t  kQoiPadding[]  = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+static void WriteQoiUint32(uint8_t* dst, uint32_t value)
+{
+    dst[0] = static_cast<uint8_t>((value >> 24) & 0xff);
+    dst[1] = static_cast<uint8_t>((value >> 16) & 0xff);
+    dst[2] = static_cast<uint8_t>((value >> 8) & 0xff);
+    dst[3] = static_cast<uint8_t>(value & 0xff);
+}
+
+// Encodes tightly packed RGB or RGBA pixel data following the QOI specification (https://qoiformat.org).
+static size_t
+EncodeQoi(uint32_t width, uint32_t height, const uint8_t* pixels, uint32_t channels, std::vector<uint8_t>* output)
+{
+    assert((channels == kImageBpp) || (channels == kImageBppNoAlpha));
+    assert(output != nullptr);
+
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+
+    // Worst case is every pixel encoded with a full QOI_OP_RGBA chunk.
+    output->resize(kQoiHeaderSize + pixel_count * (kImageBpp + 1) + sizeof(kQoiPadding));
+
+    uint8_t* bytes = output->data();
+    size_t   pos   = 0;
+
+    memcpy(&bytes[pos], "qoif", 4);
+    pos += 4;
+    WriteQoiUint32(&bytes[pos], width);
+    pos += 4;
+    WriteQoiUint32(&bytes[pos], height);
+    pos += 4;
+    bytes[pos++] = static_cast<uint8_t>(channels);
+    bytes[pos++] = 0; // sRGB with linear alpha.
+
+    uint8_t  index[64][4] = {};
+    uint8_t  prev[4]      = { 0, 0, 0, 255 };
+    uint8_t  px[4]        = { 0, 0, 0, 255 };
+    uint32_t run          = 0;
+
+    for (size_t i = 0; i < pixel_count; ++i)
+    {
+        const uint8_t* src = &pixels[i * channels];
+
+        px[0] = src[0];
+        px[1] = src[1];
+        px[2] = src[2];
+        if (channels == kImageBpp)
+        {
+            px[3] = src[3];
+        }
+
+        if (memcmp(px, prev, sizeof(px)) == 0)
+        {
+            ++run;
+            if ((run == 62) || (i == (pixel_count - 1)))
+            {
+                bytes[pos++] = static_cast<uint8_t>(kQoiOpRun | (run - 1));
+                run          = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            bytes[pos++] = static_cast<uint8_t>(kQoiOpRun | (run - 1));
+            run          = 0;
+        }
+
+        const uint32_t hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+
+        if (memcmp(index[hash], px, sizeof(px)) == 0)
+        {
+            bytes[pos++] = static_cast<uint8_t>(kQoiOpIndex | hash);
+        }
+        else
+        {
+            memcpy(index[hash], px, sizeof(px));
+
+            if (px[3] == prev[3])
+            {
+                const int8_t vr   = static_cast<int8_t>(px[0] - prev[0]);
+                const int8_t vg   = static_cast<int8_t>(px[1] - prev[1]);
+                const int8_t vb   = static_cast<int8_t>(px[2] - prev[2]);
+                const int8_t vg_r = static_cast<int8_t>(vr - vg);
+                const int8_t vg_b = static_cast<int8_t>(vb - vg);
+
+                if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) && (vb < 2))
+                {
+                    bytes[pos++] = static_cast<uint8_t>(kQoiOpDiff | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2));
+                }
+                else if ((vg_r > -9) && (vg_r < 8) && (vg > -33) && (vg < 32) && (vg_b > -9) && (vg_b < 8))
+                {
+                    bytes[pos++] = static_cast<uint8_t>(kQoiOpLuma | (vg + 32));
+                    bytes[pos++] = static_cast<uint8_t>(((vg_r + 8) << 4) | (vg_b + 8));
+                }
+                else
+                {
+                    bytes[pos++] = kQoiOpRgb;
+                    bytes[pos++] = px[0];
+                    bytes[pos++] = px[1];
+                    bytes[pos++] = px[2];
+                }
+            }
+            else
+            {
+                bytes[pos++] = kQoiOpRgba;
+                bytes[pos++] = px[0];
+                bytes[pos++] = px[1];
+                bytes[pos++] = px[2];
+                bytes[pos++] = px[3];
+            }
+        }
+
+        memcpy(prev, px, sizeof(px));
+    }
+
+    memcpy(&bytes[pos], kQoiPadding, sizeof(kQoiPadding));
+    pos += sizeof(kQoiPadding);
+
+    return pos;
+}
+
+static bool WriteFileData(const std::string& filename, const uint8_t* data, size_t size)
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("%s() Failed to open file (%s)", __func__, strerror(errno));
+        return false;
+    }
+
+    bool success = util::platform::FileWrite(data, size, file);
+    CheckFwriteRetVal(success, file);
+
+    util::platform::FileClose(file);
+
+    return true;
+}
+
+bool WriteQoiImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   uint32_t           data_pitch,
+                   DataFormats        format,
+                   bool               write_alpha)
+{
+    GFXRECON_LOG_INFO("%s(): Writing file \"%s\"", __func__, filename.c_str())
+
+    if (data_pitch == 0)
+    {
+        data_pitch = static_cast<uint32_t>(width * DataFormatsSizes(format));
+        if (data_pitch == 0)
+        {
+            GFXRECON_LOG_ERROR("%s() Failed writing file (data_pitch == 0)", __func__);
+            return false;
+        }
+    }
+
+    // QOI shares the PNG requirements for the pixel data: RGB(A) channel order with no row padding.
+    const uint8_t* bytes = ConvertIntoTemporaryBuffer(width, height, data, data_pitch, format, true, write_alpha);
+    if (bytes == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> encoded;
+    const size_t         encoded_size =
+        EncodeQoi(width, height, bytes, write_alpha ? kImageBpp : kImageBppNoAlpha, &encoded);
+
+    return WriteFileData(filename, encoded.data(), encoded_size);
+}
+
+bool WriteQoiImageSeparateAlpha(const std::string& filename,
+                                uint32_t           width,
+                                uint32_t           height,
+                                uint64_t           data_size,
+                                const void*        data,
+                                uint32_t           data_pitch,
+                                DataFormats        format)
+{
+    bool success = WriteQoiImage(filename, width, height, data_size, data, data_pitch, format, false);
+    if (success && DataFormatHasAlpha(format))
+    {
+        const std::string    alpha_filename = util::filepath::InsertFilenamePostfix(filename, "_alpha");
+        const uint8_t*       alpha_channel  = ExtractAlphaChannel(width, height, data, data_pitch, true);
+        std::vector<uint8_t> encoded;
+        const size_t encoded_size = EncodeQoi(width, height, alpha_channel, kImageBppNoAlpha, &encoded);
+
+        success = WriteFileData(alpha_filename, encoded.data(), encoded_size);
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("%s() Failed writing file %s", __func__, alpha_filename.c_str());
+        }
+    }
+
+    return success;
+}
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+static bool WriteZstdImageData(
+    const std::string& filename, uint32_t width, uint32_t height, const uint8_t* pixels, uint32_t channels)
+{
+    const size_t pixel_data_size = static_cast<size_t>(width) * height * channels;
+
+    RawImageHeader header;
+    header.magic    = kRawImageMagic;
+    header.width    = width;
+    header.height   = height;
+    header.channels = channels;
+
+    std::vector<uint8_t> uncompressed(sizeof(header) + pixel_data_size);
+    memcpy(uncompressed.data(), &header, sizeof(header));
+    memcpy(uncompressed.data() + sizeof(header), pixels, pixel_data_size);
+
+    util::ZstdCompressor compressor;
+    std::vector<uint8_t> compressed;
+    const size_t compressed_size = compressor.Compress(uncompressed.size(), uncompressed.data(), &compressed, 0);
+    if (compressed_size == 0)
+    {
+        GFXRECON_LOG_ERROR("%s() Failed to compress image data for file %s", __func__, filename.c_str());
+        return false;
+    }
+
+    return WriteFileData(filename, compressed.data(), compressed_size);
+}
+#endif
+
+bool WriteZstdImage(const std::string& filename,
+                    uint32_t           width,
+                    uint32_t           height,
+                    uint64_t           data_size,
+                    const void*        data,
+                    uint32_t           data_pitch,
+                    DataFormats        format,
+                    bool               write_alpha)
+{
+    bool success = false;
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    GFXRECON_LOG_INFO("%s(): Writing file \"%s\"", __func__, filename.c_str())
+
+    if (data_pitch == 0)
+    {
+        data_pitch = static_cast<uint32_t>(width * DataFormatsSizes(format));
+        if (data_pitch == 0)
+        {
+            GFXRECON_LOG_ERROR("%s() Failed writing file (data_pitch == 0)", __func__);
+            return false;
+        }
+    }
+
+    const uint8_t* bytes = ConvertIntoTemporaryBuffer(width, height, data, data_pitch, format, true, write_alpha);
+    if (bytes != nullptr)
+    {
+        success = WriteZstdImageData(filename, width, height, bytes, write_alpha ? kImageBpp : kImageBppNoAlpha);
+    }
+#else
+    GFXRECON_LOG_ERROR("%s() Zstandard support is not available in this build", __func__);
+#endif
+
+    return success;
+}
+
+bool WriteZstdImageSeparateAlpha(const std::string& filename,
+                                 uint32_t           width,
+                                 uint32_t           height,
+                                 uint64_t           data_size,
+                                 const void*        data,
+                                 uint32_t           data_pitch,
+                                 DataFormats        format)
+{
+    bool success = WriteZstdImage(filename, width, height, data_size, data, data_pitch, format, false);
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    if (success && DataFormatHasAlpha(format))
+    {
+        const std::string alpha_filename = util::filepath::InsertFilenamePostfix(filename, "_alpha");
+        const uint8_t*    alpha_channel  = ExtractAlphaChannel(width, height, data, data_pitch, true);
+
+        success = WriteZstdImageData(alpha_filename, width, height, alpha_channel, kImageBppNoAlpha);
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("%s() Failed writing file %s", __func__, alpha_filename.c_str());
+        }
+    }
+#endif
+
+    return success;
+}
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
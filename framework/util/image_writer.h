@@ -62,8 +62,20 @@ struct BmpInfoHeader
     uint32_t clr_important;
 };
 
+// Header stored at the start of the decompressed content of a raw + zstd image file. The header is followed by
+// width * height * channels bytes of tightly packed, top-down RGB or RGBA pixel data.
+struct RawImageHeader
+{
+    uint32_t magic;
+    uint32_t width;
+    uint32_t height;
+    uint32_t channels;
+};
+
 #pragma pack(pop)
 
+const uint32_t kRawImageMagic = ('I' << 24) | ('R' << 16) | ('X' << 8) | 'G'; // "GXRI" in file byte order.
+
 enum DataFormats
 {
     kFormat_UNSPECIFIED = 0,
@@ -156,6 +168,43 @@ bool WritePngImageSeparateAlpha(const std::string& filename,
                                 uint32_t           pitch,
                                 DataFormats        format);
 
+// Writes a lossless QOI ("Quite OK Image") file. Encoding is a single linear pass over the pixels, which is
+// significantly faster than PNG while typically producing files of comparable size.
+bool WriteQoiImage(const std::string& filename,
+                   uint32_t           width,
+                   uint32_t           height,
+                   uint64_t           data_size,
+                   const void*        data,
+                   uint32_t           pitch       = 0,
+                   DataFormats        format      = kFormat_BGRA,
+                   bool               write_alpha = false);
+
+bool WriteQoiImageSeparateAlpha(const std::string& filename,
+                                uint32_t           width,
+                                uint32_t           height,
+                                uint64_t           data_size,
+                                const void*        data,
+                                uint32_t           pitch,
+                                DataFormats        format);
+
+// Writes the image as a single zstd frame containing a RawImageHeader followed by the raw RGB(A) pixel data.
+bool WriteZstdImage(const std::string& filename,
+                    uint32_t           width,
+                    uint32_t           height,
+                    uint64_t           data_size,
+                    const void*        data,
+                    uint32_t           pitch       = 0,
+                    DataFormats        format      = kFormat_BGRA,
+                    bool               write_alpha = false);
+
+bool WriteZstdImageSeparateAlpha(const std::string& filename,
+                                 uint32_t           width,
+                                 uint32_t           height,
+                                 uint64_t           data_size,
+                                 const void*        data,
+                                 uint32_t           pitch,
+                                 DataFormats        format);
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
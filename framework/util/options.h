@@ -44,8 +44,10 @@ GetUintRanges(const char* args, const char* option_name, bool check_overlap_rang
 
 enum class ScreenshotFormat : uint32_t
 {
-    kBmp = 0,
-    kPng = 1,
+    kBmp  = 0,
+    kPng  = 1,
+    kQoi  = 2,
+    kZstd = 3,
 };
 
 enum class SwapchainOption : uint32_t
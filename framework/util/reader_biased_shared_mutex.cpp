@@ -0,0 +1,136 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/reader_biased_shared_mutex.h"
+
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// The reader and writer paths use the Dekker pattern: a reader increments its slot before checking writer_active_ and a
+// writer sets writer_active_ before checking the slots. Both sides use sequentially consistent operations, so at least
+// one of them is guaranteed to observe the other.
+
+size_t ReaderBiasedSharedMutex::GetThreadSlotIndex()
+{
+    static std::atomic<size_t> next_slot_index{ 0 };
+    static thread_local size_t slot_index = next_slot_index.fetch_add(1, std::memory_order_relaxed) % kReaderSlotCount;
+    return slot_index;
+}
+
+bool ReaderBiasedSharedMutex::HasActiveReaders() const
+{
+    for (const ReaderSlot& slot : reader_slots_)
+    {
+        if (slot.count.load() != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ReaderBiasedSharedMutex::lock()
+{
+    writer_mutex_.lock();
+    writer_active_.store(true);
+
+    // New readers back off once writer_active_ is set, so this only waits for the readers that are already active.
+    for (const ReaderSlot& slot : reader_slots_)
+    {
+        while (slot.count.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool ReaderBiasedSharedMutex::try_lock()
+{
+    if (!writer_mutex_.try_lock())
+    {
+        return false;
+    }
+
+    writer_active_.store(true);
+
+    if (HasActiveReaders())
+    {
+        writer_active_.store(false);
+        writer_mutex_.unlock();
+        return false;
+    }
+
+    return true;
+}
+
+void ReaderBiasedSharedMutex::unlock()
+{
+    writer_active_.store(false);
+    writer_mutex_.unlock();
+}
+
+void ReaderBiasedSharedMutex::lock_shared()
+{
+    std::atomic<uint32_t>& count = reader_slots_[GetThreadSlotIndex()].count;
+
+    for (;;)
+    {
+        count.fetch_add(1);
+
+        if (!writer_active_.load())
+        {
+            return;
+        }
+
+        // A writer holds or is acquiring the lock. Back off and block on the writer mutex, which is held until the
+        // writer releases the lock, instead of spinning.
+        count.fetch_sub(1, std::memory_order_release);
+
+        std::lock_guard<std::mutex> wait_for_writer(writer_mutex_);
+    }
+}
+
+bool ReaderBiasedSharedMutex::try_lock_shared()
+{
+    std::atomic<uint32_t>& count = reader_slots_[GetThreadSlotIndex()].count;
+
+    count.fetch_add(1);
+
+    if (writer_active_.load())
+    {
+        count.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    return true;
+}
+
+void ReaderBiasedSharedMutex::unlock_shared()
+{
+    reader_slots_[GetThreadSlotIndex()].count.fetch_sub(1, std::memory_order_release);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,90 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_READER_BIASED_SHARED_MUTEX_H
+#define GFXRECON_UTIL_READER_BIASED_SHARED_MUTEX_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Shared mutex that is optimized for the case where exclusive locks are rare. Instead of a single shared reader count,
+// readers increment a counter in one of kReaderSlotCount cache line sized slots, which is selected from a per-thread
+// index. Shared lock and unlock operations from different threads therefore do not write to the same cache line, unless
+// more than kReaderSlotCount threads are active. Exclusive lock operations must scan every slot and are more expensive
+// than those of std::shared_mutex.
+//
+// Satisfies the SharedMutex requirements, so it can be used with std::shared_lock and std::unique_lock. A shared lock
+// must be released by the thread that acquired it. Recursive shared locking from the same thread is not supported, and
+// will deadlock when a writer is waiting.
+class ReaderBiasedSharedMutex
+{
+  public:
+    static constexpr size_t kReaderSlotCount = 64;
+    static constexpr size_t kCacheLineSize   = 64;
+
+  public:
+    ReaderBiasedSharedMutex() = default;
+
+    ReaderBiasedSharedMutex(const ReaderBiasedSharedMutex&) = delete;
+
+    ReaderBiasedSharedMutex& operator=(const ReaderBiasedSharedMutex&) = delete;
+
+    void lock();
+
+    bool try_lock();
+
+    void unlock();
+
+    void lock_shared();
+
+    bool try_lock_shared();
+
+    void unlock_shared();
+
+  private:
+    struct alignas(kCacheLineSize) ReaderSlot
+    {
+        std::atomic<uint32_t> count{ 0 };
+    };
+
+  private:
+    static size_t GetThreadSlotIndex();
+
+    bool HasActiveReaders() const;
+
+  private:
+    ReaderSlot        reader_slots_[kReaderSlotCount];
+    std::atomic<bool> writer_active_{ false };
+    std::mutex        writer_mutex_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_READER_BIASED_SHARED_MUTEX_H
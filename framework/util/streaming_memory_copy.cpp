@@ -0,0 +1,114 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/streaming_memory_copy.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_STREAMING_STORE_SSE2
+#elif defined(__aarch64__) && defined(__clang__)
+// Compiles to the STNP instruction.
+#define GFXRECON_STREAMING_STORE_BUILTIN
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+#if defined(GFXRECON_STREAMING_STORE_SSE2) || defined(GFXRECON_STREAMING_STORE_BUILTIN)
+
+// Copies below this size are faster with memcpy, which benefits from the destination being in the cache.
+const size_t kMinStreamingCopySize = 1024;
+
+const size_t kStoreSize = 16;
+
+#if defined(GFXRECON_STREAMING_STORE_BUILTIN)
+typedef uint64_t StoreVector __attribute__((vector_size(kStoreSize)));
+#endif
+
+// Copies kStoreSize bytes from an unaligned source to an aligned destination.
+static inline void StreamingStore(uint8_t* destination, const uint8_t* source)
+{
+#if defined(GFXRECON_STREAMING_STORE_SSE2)
+    _mm_stream_si128(reinterpret_cast<__m128i*>(destination),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+#else
+    StoreVector value;
+    std::memcpy(&value, source, kStoreSize);
+    __builtin_nontemporal_store(value, reinterpret_cast<StoreVector*>(destination));
+#endif
+}
+
+void StreamingMemoryCopy(void* destination, const void* source, size_t size)
+{
+    auto dst = static_cast<uint8_t*>(destination);
+    auto src = static_cast<const uint8_t*>(source);
+
+    if (size >= kMinStreamingCopySize)
+    {
+        // Copy the start of the data with memcpy, to align the destination of the streaming stores.
+        size_t head_size = (kStoreSize - (reinterpret_cast<uintptr_t>(dst) % kStoreSize)) % kStoreSize;
+        std::memcpy(dst, src, head_size);
+        dst += head_size;
+        src += head_size;
+        size -= head_size;
+
+        // Four stores per iteration fill a 64 byte write-combining buffer.
+        const uint8_t* src_end = src + (size - (size % (kStoreSize * 4)));
+        while (src < src_end)
+        {
+            StreamingStore(dst, src);
+            StreamingStore(dst + kStoreSize, src + kStoreSize);
+            StreamingStore(dst + (kStoreSize * 2), src + (kStoreSize * 2));
+            StreamingStore(dst + (kStoreSize * 3), src + (kStoreSize * 3));
+            dst += kStoreSize * 4;
+            src += kStoreSize * 4;
+        }
+
+        size %= kStoreSize * 4;
+
+        // Non-temporal stores are weakly ordered, and must be fenced before the memory is used by the device.
+#if defined(GFXRECON_STREAMING_STORE_SSE2)
+        _mm_sfence();
+#else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    std::memcpy(dst, src, size);
+}
+
+#else
+
+void StreamingMemoryCopy(void* destination, const void* source, size_t size)
+{
+    std::memcpy(destination, source, size);
+}
+
+#endif
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
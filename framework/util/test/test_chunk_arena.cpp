@@ -0,0 +1,169 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/chunk_arena.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using gfxrecon::util::ChunkArena;
+using gfxrecon::util::ChunkedBuffer;
+
+// Returns the data of a buffer by iterating over its chunks.
+static std::vector<uint8_t> GetBufferData(const ChunkedBuffer& buffer)
+{
+    std::vector<uint8_t> data;
+    for (const ChunkArena::Chunk* chunk = buffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        data.insert(data.end(), chunk->GetData(), chunk->GetData() + chunk->size);
+    }
+    return data;
+}
+
+static size_t GetChunkCount(const ChunkedBuffer& buffer)
+{
+    size_t count = 0;
+    for (const ChunkArena::Chunk* chunk = buffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        ++count;
+    }
+    return count;
+}
+
+TEST_CASE("ChunkedBuffer - allocations that reach a chunk boundary", "[]")
+{
+    constexpr size_t kChunkSize = 64;
+
+    ChunkArena    arena(kChunkSize);
+    ChunkedBuffer buffer;
+    buffer.SetArena(&arena);
+
+    std::vector<uint8_t> expected;
+    auto                 append = [&](size_t size) {
+        uint8_t* data = buffer.Allocate(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = static_cast<uint8_t>(expected.size());
+            expected.push_back(data[i]);
+        }
+    };
+
+    // Exactly fills the first chunk.
+    append(40);
+    append(24);
+    REQUIRE(GetChunkCount(buffer) == 1);
+
+    // Does not fit in the remaining space of the second chunk, so it starts a third chunk instead of spanning two.
+    append(48);
+    append(20);
+    REQUIRE(GetChunkCount(buffer) == 3);
+
+    // Larger than the chunk size, so it receives a dedicated chunk.
+    append(kChunkSize * 3);
+    REQUIRE(GetChunkCount(buffer) == 4);
+
+    append(1);
+    REQUIRE(GetChunkCount(buffer) == 5);
+
+    REQUIRE(buffer.GetDataSize() == expected.size());
+    REQUIRE(GetBufferData(buffer) == expected);
+
+    for (const ChunkArena::Chunk* chunk = buffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        REQUIRE(chunk->size <= chunk->capacity);
+    }
+}
+
+TEST_CASE("ChunkedBuffer - cleared chunks are reused", "[]")
+{
+    constexpr size_t kChunkSize = 128;
+
+    ChunkArena    arena(kChunkSize);
+    ChunkedBuffer buffer;
+    buffer.SetArena(&arena);
+
+    std::memset(buffer.Allocate(kChunkSize), 1, kChunkSize);
+    const ChunkArena::Chunk* first_chunk = buffer.GetFirstChunk();
+
+    buffer.Clear();
+    REQUIRE(buffer.GetDataSize() == 0);
+    REQUIRE(buffer.GetFirstChunk() == nullptr);
+
+    // The released chunk is taken from the free list, and is empty.
+    std::memset(buffer.Allocate(16), 2, 16);
+    REQUIRE(buffer.GetFirstChunk() == first_chunk);
+    REQUIRE(buffer.GetFirstChunk()->size == 16);
+    REQUIRE(GetBufferData(buffer) == std::vector<uint8_t>(16, 2));
+
+    buffer.Clear();
+    arena.Trim();
+
+    // Chunks are allocated again after the free list was trimmed.
+    buffer.Allocate(1);
+    REQUIRE(buffer.GetFirstChunk()->capacity == kChunkSize);
+}
+
+TEST_CASE("ChunkedBuffer - destroyed buffers return their chunks to the arena", "[]")
+{
+    constexpr size_t kChunkSize = 32;
+
+    ChunkArena arena(kChunkSize);
+
+    {
+        ChunkedBuffer first;
+        first.SetArena(&arena);
+        first.Allocate(kChunkSize);
+        first.Allocate(kChunkSize);
+        REQUIRE(GetChunkCount(first) == 2);
+    }
+
+    // The chunks of the destroyed buffer are returned to the arena, which hands them out again.
+    ChunkArena::Chunk* first  = arena.AcquireChunk(kChunkSize);
+    ChunkArena::Chunk* second = arena.AcquireChunk(kChunkSize);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    REQUIRE(first != second);
+    REQUIRE(first->size == 0);
+    REQUIRE(first->next == nullptr);
+
+    first->next = second;
+    arena.ReleaseChunks(first);
+}
+
+TEST_CASE("ChunkedBuffer - allocation without an arena", "[]")
+{
+    ChunkedBuffer buffer;
+
+    std::memset(buffer.Allocate(8), 3, 8);
+    REQUIRE(buffer.GetFirstChunk()->capacity == ChunkArena::kDefaultChunkSize);
+
+    std::memset(buffer.Allocate(ChunkArena::kDefaultChunkSize), 4, ChunkArena::kDefaultChunkSize);
+    REQUIRE(GetChunkCount(buffer) == 2);
+    REQUIRE(buffer.GetDataSize() == (8 + ChunkArena::kDefaultChunkSize));
+
+    std::vector<uint8_t> expected(8, 3);
+    expected.insert(expected.end(), ChunkArena::kDefaultChunkSize, 4);
+    REQUIRE(GetBufferData(buffer) == expected);
+}
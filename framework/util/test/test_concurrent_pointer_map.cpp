@@ -0,0 +1,166 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/concurrent_pointer_map.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ConcurrentPointerMap - find in empty map", "[]")
+{
+    gfxrecon::util::ConcurrentPointerMap<uint32_t> map;
+
+    REQUIRE(map.Find(1) == nullptr);
+    REQUIRE_FALSE(map.Remove(1));
+    REQUIRE_FALSE(map.HasRetiredTables());
+}
+
+TEST_CASE("ConcurrentPointerMap - insert, remove, and reinsert", "[]")
+{
+    gfxrecon::util::ConcurrentPointerMap<uint32_t> map;
+    uint32_t                                       first  = 1;
+    uint32_t                                       second = 2;
+
+    REQUIRE(map.Insert(0x1000, &first));
+    REQUIRE(map.Find(0x1000) == &first);
+    REQUIRE(map.Find(0x2000) == nullptr);
+
+    // A key can only be inserted again after it was removed.
+    REQUIRE_FALSE(map.Insert(0x1000, &second));
+    REQUIRE(map.Find(0x1000) == &first);
+
+    REQUIRE(map.Remove(0x1000));
+    REQUIRE(map.Find(0x1000) == nullptr);
+    REQUIRE_FALSE(map.Remove(0x1000));
+
+    // Reinserting a removed key reuses its tombstone, as is done for handle values recycled by the driver.
+    REQUIRE(map.Insert(0x1000, &second));
+    REQUIRE(map.Find(0x1000) == &second);
+}
+
+TEST_CASE("ConcurrentPointerMap - repeated reinsertion does not fill the table", "[]")
+{
+    constexpr uint64_t kKeyCount = 1000;
+
+    gfxrecon::util::ConcurrentPointerMap<uint64_t> map;
+    std::vector<uint64_t>                          values(kKeyCount);
+
+    // Each round inserts new keys and removes them again, which leaves tombstones that force the table to be rebuilt.
+    for (uint64_t round = 0; round < 4; ++round)
+    {
+        for (uint64_t i = 0; i < kKeyCount; ++i)
+        {
+            values[i] = i;
+            REQUIRE(map.Insert((round * kKeyCount) + i + 1, &values[i]));
+        }
+
+        for (uint64_t i = 0; i < kKeyCount; ++i)
+        {
+            REQUIRE(map.Find((round * kKeyCount) + i + 1) == &values[i]);
+            REQUIRE(map.Remove((round * kKeyCount) + i + 1));
+        }
+    }
+
+    for (uint64_t key = 1; key <= (4 * kKeyCount); ++key)
+    {
+        REQUIRE(map.Find(key) == nullptr);
+    }
+
+    REQUIRE(map.HasRetiredTables());
+    map.ReclaimRetiredTables();
+    REQUIRE_FALSE(map.HasRetiredTables());
+}
+
+TEST_CASE("ConcurrentPointerMap - growth while readers are active", "[]")
+{
+    constexpr uint32_t kReaderCount      = 4;
+    constexpr uint64_t kInitialKeyCount  = 256;
+    constexpr uint64_t kInsertedKeyCount = 64 * 1024;
+
+    gfxrecon::util::ConcurrentPointerMap<uint64_t> map;
+    std::vector<uint64_t>                          values(kInitialKeyCount + kInsertedKeyCount);
+
+    for (uint64_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = i + 1;
+    }
+
+    for (uint64_t i = 0; i < kInitialKeyCount; ++i)
+    {
+        REQUIRE(map.Insert(values[i], &values[i]));
+    }
+
+    std::atomic<bool>        stop{ false };
+    std::atomic<uint32_t>    failed_reads{ 0 };
+    std::vector<std::thread> readers;
+
+    // The readers look up the keys that were present before the writer started, which must remain visible while the
+    // writer grows the table. Retired tables are only reclaimed after the readers have stopped.
+    for (uint32_t i = 0; i < kReaderCount; ++i)
+    {
+        readers.emplace_back([&]() {
+            while (!stop.load())
+            {
+                for (uint64_t j = 0; j < kInitialKeyCount; ++j)
+                {
+                    const uint64_t* value = map.Find(values[j]);
+                    if ((value == nullptr) || (*value != values[j]))
+                    {
+                        ++failed_reads;
+                    }
+                }
+            }
+        });
+    }
+
+    for (uint64_t i = kInitialKeyCount; i < values.size(); ++i)
+    {
+        map.Insert(values[i], &values[i]);
+
+        // Remove and reinsert some of the new keys, so that tombstones are created and reused during growth.
+        if ((i % 8) == 0)
+        {
+            map.Remove(values[i]);
+            map.Insert(values[i], &values[i]);
+        }
+    }
+
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    REQUIRE(failed_reads.load() == 0);
+    REQUIRE(map.HasRetiredTables());
+
+    map.ReclaimRetiredTables();
+
+    for (uint64_t i = 0; i < values.size(); ++i)
+    {
+        REQUIRE(map.Find(values[i]) == &values[i]);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/direct_file_output_stream.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using gfxrecon::util::DirectFileOutputStream;
+
+#if !defined(WIN32)
+
+// The stream rounds the buffer size up to the 4 KiB direct I/O alignment.
+const size_t kBufferSize = 8192;
+
+static std::string GetTestFilename(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / ("gfxrecon_direct_file_test_" + name + ".bin")).string();
+}
+
+static std::vector<uint8_t> ReadFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static std::vector<uint8_t> MakeData(size_t size, size_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(((i + seed) * 131) % 251);
+    }
+    return data;
+}
+
+TEST_CASE("DirectFileOutputStream - unaligned writes are read back exactly", "[]")
+{
+    const std::string filename = GetTestFilename("unaligned");
+
+    // Sizes that end inside a block, on a block boundary, and across both write buffers.
+    const size_t sizes[] = { 1, 13, 4095, 1, 4096, 4097, 8191, 3, 20000, 7 };
+
+    std::vector<uint8_t> expected;
+
+    {
+        DirectFileOutputStream stream(filename, kBufferSize);
+        REQUIRE(stream.IsValid());
+
+        for (size_t i = 0; i < std::size(sizes); ++i)
+        {
+            std::vector<uint8_t> data = MakeData(sizes[i], i);
+            REQUIRE(stream.Write(data.data(), data.size()));
+            expected.insert(expected.end(), data.begin(), data.end());
+
+            REQUIRE(stream.GetOffset() == static_cast<int64_t>(expected.size()));
+
+            // Flushes between writes hand whole blocks to the background thread and keep the partial block buffered.
+            if ((i % 3) == 0)
+            {
+                stream.Flush();
+            }
+        }
+    }
+
+    // The padded last block is truncated when the stream is closed.
+    std::vector<uint8_t> contents = ReadFile(filename);
+    REQUIRE(contents.size() == expected.size());
+    REQUIRE(contents == expected);
+
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+}
+
+TEST_CASE("DirectFileOutputStream - partial blocks are written by forced flushes", "[]")
+{
+    const std::string filename = GetTestFilename("flush");
+
+    DirectFileOutputStream stream(filename, kBufferSize, true);
+    REQUIRE(stream.IsValid());
+
+    std::vector<uint8_t> expected = MakeData(5000, 0);
+    REQUIRE(stream.Write(expected.data(), expected.size()));
+    stream.Flush();
+
+    std::vector<uint8_t> contents = ReadFile(filename);
+    REQUIRE(contents == expected);
+
+    // The partial block is rewritten in place when more data follows it.
+    std::vector<uint8_t> data = MakeData(9001, 1);
+    REQUIRE(stream.Write(data.data(), data.size()));
+    expected.insert(expected.end(), data.begin(), data.end());
+    stream.Flush();
+
+    contents = ReadFile(filename);
+    REQUIRE(contents == expected);
+
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+}
+
+TEST_CASE("DirectFileOutputStream - empty file", "[]")
+{
+    const std::string filename = GetTestFilename("empty");
+
+    {
+        DirectFileOutputStream stream(filename, kBufferSize);
+        REQUIRE(stream.IsValid());
+        stream.Flush();
+        REQUIRE(stream.GetOffset() == 0);
+    }
+
+    REQUIRE(std::filesystem::file_size(filename) == 0);
+
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+}
+
+#endif
@@ -0,0 +1,225 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/image_compare.h"
+#include "util/image_reader.h"
+#include "util/image_writer.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+using gfxrecon::util::imagecompare::CompareImages;
+using gfxrecon::util::imagecompare::CompareResult;
+using gfxrecon::util::imagereader::ImageData;
+
+namespace imagereader = gfxrecon::util::imagereader;
+namespace imagewriter = gfxrecon::util::imagewriter;
+
+// The size is not a multiple of the tile size, so that the partial tiles at the right and bottom edges are compared.
+const uint32_t kImageWidth  = 100;
+const uint32_t kImageHeight = 70;
+const uint32_t kImagePitch  = kImageWidth * 4;
+
+using WriteImageFunction = std::function<bool(
+    const std::string&, uint32_t, uint32_t, uint64_t, const void*, uint32_t, imagewriter::DataFormats, bool)>;
+
+struct ImageFormat
+{
+    const char*        extension;
+    WriteImageFunction write;
+};
+
+static std::vector<ImageFormat> GetImageFormats()
+{
+    std::vector<ImageFormat> formats = { { ".bmp", imagewriter::WriteBmpImage },
+                                         { ".qoi", imagewriter::WriteQoiImage } };
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION) && defined(GFXRECON_ENABLE_PNG_SCREENSHOT)
+    formats.push_back({ ".png", imagewriter::WritePngImage });
+#endif
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    formats.push_back({ ".zst", imagewriter::WriteZstdImage });
+#endif
+    return formats;
+}
+
+// Returns BGRA pixels with a gradient in each channel, which exercises the run, index and difference encodings.
+static std::vector<uint8_t> CreateTestPixels()
+{
+    std::vector<uint8_t> pixels(static_cast<size_t>(kImagePitch) * kImageHeight);
+
+    for (uint32_t y = 0; y < kImageHeight; ++y)
+    {
+        for (uint32_t x = 0; x < kImageWidth; ++x)
+        {
+            uint8_t* pixel = &pixels[(static_cast<size_t>(y) * kImagePitch) + (x * 4)];
+            pixel[0]       = static_cast<uint8_t>(x * 2);
+            pixel[1]       = static_cast<uint8_t>(y * 3);
+            pixel[2]       = static_cast<uint8_t>((x / 8) * 16);
+            pixel[3]       = static_cast<uint8_t>(255 - (y / 10));
+        }
+    }
+
+    return pixels;
+}
+
+static std::string GetTestFilename(const std::string& name, const char* extension)
+{
+    return (std::filesystem::temp_directory_path() / ("gfxrecon_image_test_" + name + extension)).string();
+}
+
+// Writes the pixels with the specified format and reads the file back.
+static bool WriteAndReadImage(const ImageFormat&          format,
+                              const std::string&          name,
+                              const std::vector<uint8_t>& pixels,
+                              bool                        write_alpha,
+                              ImageData*                  image)
+{
+    const std::string filename = GetTestFilename(name, format.extension);
+
+    bool success = format.write(filename,
+                                kImageWidth,
+                                kImageHeight,
+                                pixels.size(),
+                                pixels.data(),
+                                kImagePitch,
+                                imagewriter::kFormat_BGRA,
+                                write_alpha) &&
+                   imagereader::ReadImage(filename, image);
+
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+
+    return success;
+}
+
+TEST_CASE("Image reader - written images are read back unchanged", "[image]")
+{
+    const std::vector<uint8_t> pixels = CreateTestPixels();
+
+    for (bool write_alpha : { false, true })
+    {
+        ImageData expected;
+        REQUIRE(imagereader::ConvertImageData(kImageWidth,
+                                              kImageHeight,
+                                              pixels.data(),
+                                              kImagePitch,
+                                              imagewriter::kFormat_BGRA,
+                                              write_alpha,
+                                              &expected));
+
+        for (const ImageFormat& format : GetImageFormats())
+        {
+            INFO("Format " << format.extension << (write_alpha ? " with alpha" : " without alpha"));
+
+            ImageData image;
+            REQUIRE(WriteAndReadImage(format, "round_trip", pixels, write_alpha, &image));
+
+            REQUIRE(image.width == kImageWidth);
+            REQUIRE(image.height == kImageHeight);
+            REQUIRE(image.has_alpha == write_alpha);
+            REQUIRE(image.pixels == expected.pixels);
+
+            CompareResult result;
+            REQUIRE(CompareImages(expected, image, &result));
+            REQUIRE(result.IsIdentical());
+            REQUIRE(result.mismatched_tiles == 0);
+            REQUIRE(result.tile_count == 4);
+        }
+    }
+}
+
+TEST_CASE("Image compare - perturbed images are reported as different", "[image]")
+{
+    constexpr uint32_t kChangedX     = 80;
+    constexpr uint32_t kChangedY     = 65;
+    constexpr uint8_t  kChangedDelta = 7;
+
+    const std::vector<uint8_t> pixels    = CreateTestPixels();
+    std::vector<uint8_t>       perturbed = pixels;
+
+    // Changes the red channel of a single pixel in the bottom right tile.
+    perturbed[(static_cast<size_t>(kChangedY) * kImagePitch) + (kChangedX * 4) + 2] += kChangedDelta;
+
+    for (const ImageFormat& format : GetImageFormats())
+    {
+        INFO("Format " << format.extension);
+
+        ImageData reference;
+        ImageData test;
+        REQUIRE(WriteAndReadImage(format, "reference", pixels, true, &reference));
+        REQUIRE(WriteAndReadImage(format, "perturbed", perturbed, true, &test));
+
+        CompareResult result;
+        REQUIRE(CompareImages(reference, test, &result));
+        REQUIRE(result.size_match);
+        REQUIRE_FALSE(result.IsIdentical());
+        REQUIRE(result.tile_count == 4);
+        REQUIRE(result.mismatched_tiles == 1);
+        REQUIRE(result.mismatched_pixels == 1);
+        REQUIRE(result.max_error == kChangedDelta);
+        REQUIRE(result.mean_squared_error > 0.0);
+        REQUIRE(result.psnr > 0.0);
+    }
+}
+
+TEST_CASE("Image compare - alpha is only compared when both images have it", "[image]")
+{
+    const std::vector<uint8_t> pixels = CreateTestPixels();
+
+    ImageData with_alpha;
+    ImageData without_alpha;
+    REQUIRE(imagereader::ConvertImageData(
+        kImageWidth, kImageHeight, pixels.data(), kImagePitch, imagewriter::kFormat_BGRA, true, &with_alpha));
+    REQUIRE(imagereader::ConvertImageData(
+        kImageWidth, kImageHeight, pixels.data(), kImagePitch, imagewriter::kFormat_BGRA, false, &without_alpha));
+
+    CompareResult result;
+    REQUIRE(CompareImages(with_alpha, without_alpha, &result));
+    REQUIRE(result.IsIdentical());
+
+    // The alpha channel of the test pattern is not opaque, so the images differ when alpha is compared.
+    without_alpha.has_alpha = true;
+    REQUIRE(CompareImages(with_alpha, without_alpha, &result));
+    REQUIRE_FALSE(result.IsIdentical());
+}
+
+TEST_CASE("Image compare - images with different sizes do not match", "[image]")
+{
+    const std::vector<uint8_t> pixels = CreateTestPixels();
+
+    ImageData reference;
+    ImageData test;
+    REQUIRE(imagereader::ConvertImageData(
+        kImageWidth, kImageHeight, pixels.data(), kImagePitch, imagewriter::kFormat_BGRA, true, &reference));
+    REQUIRE(imagereader::ConvertImageData(
+        kImageWidth, kImageHeight - 1, pixels.data(), kImagePitch, imagewriter::kFormat_BGRA, true, &test));
+
+    CompareResult result;
+    REQUIRE(CompareImages(reference, test, &result));
+    REQUIRE_FALSE(result.size_match);
+    REQUIRE_FALSE(result.IsIdentical());
+}
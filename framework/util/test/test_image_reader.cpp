@@ -0,0 +1,267 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+#include "util/image_reader.h"
+#include "util/image_writer.h"
+
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+#include <zlib.h>
+#endif
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+#include "zstd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+using gfxrecon::util::imagereader::ImageData;
+
+namespace imagereader = gfxrecon::util::imagereader;
+namespace imagewriter = gfxrecon::util::imagewriter;
+
+namespace
+{
+
+void AppendBigEndianUint32(uint32_t value, std::vector<uint8_t>* data)
+{
+    data->push_back(static_cast<uint8_t>(value >> 24));
+    data->push_back(static_cast<uint8_t>(value >> 16));
+    data->push_back(static_cast<uint8_t>(value >> 8));
+    data->push_back(static_cast<uint8_t>(value));
+}
+
+// Writes the file data to a temporary file with the specified extension and reads it back as an image.
+bool ReadImageData(const std::string& name, const char* extension, const std::vector<uint8_t>& data, ImageData* image)
+{
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / ("gfxrecon_image_reader_test_" + name + extension)).string();
+
+    FILE* file = fopen(filename.c_str(), "wb");
+    REQUIRE(file != nullptr);
+    REQUIRE(fwrite(data.data(), 1, data.size(), file) == data.size());
+    fclose(file);
+
+    const bool success = imagereader::ReadImage(filename, image);
+
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+
+    return success;
+}
+
+// Creates a 32 bit BMP file with the specified header dimensions, followed by pixel_data_size bytes of pixel data.
+std::vector<uint8_t> CreateBmpData(int32_t width, int32_t height, size_t pixel_data_size)
+{
+    imagewriter::BmpFileHeader file_header = {};
+    imagewriter::BmpInfoHeader info_header = {};
+
+    file_header.type     = ('M' << 8) | 'B';
+    file_header.off_bits = sizeof(file_header) + sizeof(info_header);
+    file_header.size     = static_cast<uint32_t>(file_header.off_bits + pixel_data_size);
+
+    info_header.size      = sizeof(info_header);
+    info_header.width     = width;
+    info_header.height    = height;
+    info_header.planes    = 1;
+    info_header.bit_count = 32;
+
+    std::vector<uint8_t> data(file_header.off_bits + pixel_data_size, 0);
+    memcpy(data.data(), &file_header, sizeof(file_header));
+    memcpy(data.data() + sizeof(file_header), &info_header, sizeof(info_header));
+    return data;
+}
+
+// Creates a QOI file with the specified header dimensions, encoding the pixels with a single run of run_length pixels.
+std::vector<uint8_t> CreateQoiData(uint32_t width, uint32_t height, uint8_t run_length)
+{
+    std::vector<uint8_t> data = { 'q', 'o', 'i', 'f' };
+    AppendBigEndianUint32(width, &data);
+    AppendBigEndianUint32(height, &data);
+    data.push_back(4);
+    data.push_back(0);
+    data.push_back(static_cast<uint8_t>(0xc0 | (run_length - 1)));
+    data.insert(data.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+    return data;
+}
+
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+void AppendPngChunk(const char* type, const std::vector<uint8_t>& chunk_data, std::vector<uint8_t>* data)
+{
+    // The reader does not validate the CRC, so it is left as zero.
+    AppendBigEndianUint32(static_cast<uint32_t>(chunk_data.size()), data);
+    data->insert(data->end(), type, type + 4);
+    data->insert(data->end(), chunk_data.begin(), chunk_data.end());
+    AppendBigEndianUint32(0, data);
+}
+
+std::vector<uint8_t> CreatePngHeader(uint32_t width, uint32_t height, size_t length)
+{
+    std::vector<uint8_t> header;
+    AppendBigEndianUint32(width, &header);
+    AppendBigEndianUint32(height, &header);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });
+    header.resize(length, 0);
+    return header;
+}
+
+// Creates an RGBA PNG file with the specified header, followed by enough compressed zero bytes for a 1x1 image.
+std::vector<uint8_t> CreatePngData(const std::vector<uint8_t>& header, bool header_first = true)
+{
+    std::vector<uint8_t> filtered(5, 0);
+    std::vector<uint8_t> compressed(compressBound(static_cast<uLong>(filtered.size())));
+    uLongf               compressed_size = static_cast<uLongf>(compressed.size());
+    REQUIRE(compress(compressed.data(), &compressed_size, filtered.data(), static_cast<uLong>(filtered.size())) == Z_OK);
+    compressed.resize(compressed_size);
+
+    std::vector<uint8_t> data = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    if (header_first)
+    {
+        AppendPngChunk("IHDR", header, &data);
+        AppendPngChunk("IDAT", compressed, &data);
+    }
+    else
+    {
+        AppendPngChunk("IDAT", compressed, &data);
+        AppendPngChunk("IHDR", header, &data);
+    }
+    AppendPngChunk("IEND", {}, &data);
+    return data;
+}
+#endif
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+// Creates a raw + zstd file with the specified header dimensions, followed by pixel_data_size bytes of pixel data.
+std::vector<uint8_t> CreateZstdData(uint32_t width, uint32_t height, size_t pixel_data_size)
+{
+    imagewriter::RawImageHeader header = { imagewriter::kRawImageMagic, width, height, 4 };
+
+    std::vector<uint8_t> content(sizeof(header) + pixel_data_size, 0);
+    memcpy(content.data(), &header, sizeof(header));
+
+    std::vector<uint8_t> data(ZSTD_compressBound(content.size()));
+    const size_t         size = ZSTD_compress(data.data(), data.size(), content.data(), content.size(), 1);
+    REQUIRE(!ZSTD_isError(size));
+    data.resize(size);
+    return data;
+}
+#endif
+
+} // namespace
+
+TEST_CASE("Image reader - BMP files with invalid dimensions are rejected", "[image]")
+{
+    ImageData image;
+
+    REQUIRE(ReadImageData("bmp_valid", ".bmp", CreateBmpData(2, -2, 16), &image));
+    REQUIRE(image.width == 2);
+    REQUIRE(image.height == 2);
+
+    REQUIRE_FALSE(ReadImageData("bmp_truncated", ".bmp", CreateBmpData(2, 2, 12), &image));
+    REQUIRE_FALSE(ReadImageData("bmp_zero_width", ".bmp", CreateBmpData(0, 2, 16), &image));
+    REQUIRE_FALSE(ReadImageData("bmp_negative_width", ".bmp", CreateBmpData(-2, 2, 16), &image));
+    REQUIRE_FALSE(ReadImageData("bmp_zero_height", ".bmp", CreateBmpData(2, 0, 16), &image));
+    REQUIRE_FALSE(ReadImageData(
+        "bmp_min_height", ".bmp", CreateBmpData(2, std::numeric_limits<int32_t>::min(), 16), &image));
+
+    // The pixel data size overflows 32 bits, so it must not wrap around to a size that fits in the file.
+    REQUIRE_FALSE(ReadImageData("bmp_overflow", ".bmp", CreateBmpData(0x40000000, 0x40000001, 16), &image));
+
+    // The pixel data offset points past the end of the file.
+    std::vector<uint8_t> data     = CreateBmpData(2, 2, 16);
+    const uint32_t       off_bits = 0xfffffff0;
+    memcpy(data.data() + offsetof(imagewriter::BmpFileHeader, off_bits), &off_bits, sizeof(off_bits));
+    REQUIRE_FALSE(ReadImageData("bmp_offset", ".bmp", data, &image));
+}
+
+TEST_CASE("Image reader - QOI files with invalid dimensions are rejected", "[image]")
+{
+    ImageData image;
+
+    REQUIRE(ReadImageData("qoi_valid", ".qoi", CreateQoiData(4, 2, 8), &image));
+    REQUIRE(image.width == 4);
+    REQUIRE(image.height == 2);
+
+    REQUIRE_FALSE(ReadImageData("qoi_zero", ".qoi", CreateQoiData(0, 2, 8), &image));
+    REQUIRE_FALSE(ReadImageData("qoi_large", ".qoi", CreateQoiData(65536, 65536, 8), &image));
+    REQUIRE_FALSE(ReadImageData("qoi_max", ".qoi", CreateQoiData(0xffffffff, 0xffffffff, 8), &image));
+}
+
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+TEST_CASE("Image reader - PNG files with invalid headers are rejected", "[image]")
+{
+    ImageData image;
+
+    REQUIRE(ReadImageData("png_valid", ".png", CreatePngData(CreatePngHeader(1, 1, 13)), &image));
+    REQUIRE(image.width == 1);
+    REQUIRE(image.height == 1);
+
+    REQUIRE_FALSE(ReadImageData("png_short_header", ".png", CreatePngData(CreatePngHeader(1, 1, 12)), &image));
+    REQUIRE_FALSE(ReadImageData("png_long_header", ".png", CreatePngData(CreatePngHeader(1, 1, 14)), &image));
+    REQUIRE_FALSE(ReadImageData("png_header_order", ".png", CreatePngData(CreatePngHeader(1, 1, 13), false), &image));
+    REQUIRE_FALSE(ReadImageData("png_zero", ".png", CreatePngData(CreatePngHeader(0, 1, 13)), &image));
+    REQUIRE_FALSE(ReadImageData("png_large", ".png", CreatePngData(CreatePngHeader(65536, 65536, 13)), &image));
+    REQUIRE_FALSE(
+        ReadImageData("png_max", ".png", CreatePngData(CreatePngHeader(0xffffffff, 0xffffffff, 13)), &image));
+
+    // The chunk length extends past the end of the file.
+    std::vector<uint8_t> data = CreatePngData(CreatePngHeader(1, 1, 13));
+    data[8]                   = 0xff;
+    REQUIRE_FALSE(ReadImageData("png_chunk_length", ".png", data, &image));
+}
+#endif
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+TEST_CASE("Image reader - zstd files with invalid dimensions are rejected", "[image]")
+{
+    ImageData image;
+
+    REQUIRE(ReadImageData("zst_valid", ".zst", CreateZstdData(2, 2, 16), &image));
+    REQUIRE(image.width == 2);
+    REQUIRE(image.height == 2);
+
+    REQUIRE_FALSE(ReadImageData("zst_truncated", ".zst", CreateZstdData(2, 2, 12), &image));
+    REQUIRE_FALSE(ReadImageData("zst_zero", ".zst", CreateZstdData(0, 2, 16), &image));
+
+    // The pixel data size overflows 64 bits, so it must not wrap around to a size that fits in the content.
+    REQUIRE_FALSE(ReadImageData("zst_overflow", ".zst", CreateZstdData(0x80000000, 0x80000000, 16), &image));
+}
+#endif
+
+TEST_CASE("Image reader - converted images with invalid dimensions are rejected", "[image]")
+{
+    ImageData                  image;
+    const std::vector<uint8_t> pixels(16, 0);
+
+    REQUIRE(imagereader::ConvertImageData(2, 2, pixels.data(), 8, imagewriter::kFormat_BGRA, true, &image));
+    REQUIRE_FALSE(imagereader::ConvertImageData(0, 2, pixels.data(), 8, imagewriter::kFormat_BGRA, true, &image));
+    REQUIRE_FALSE(imagereader::ConvertImageData(2, 2, pixels.data(), 4, imagewriter::kFormat_BGRA, true, &image));
+    REQUIRE_FALSE(
+        imagereader::ConvertImageData(0x40000000, 1, pixels.data(), 0, imagewriter::kFormat_BGRA, true, &image));
+}
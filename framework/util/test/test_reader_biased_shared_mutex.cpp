@@ -0,0 +1,173 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/reader_biased_shared_mutex.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ReaderBiasedSharedMutex - shared and exclusive locking", "[]")
+{
+    gfxrecon::util::ReaderBiasedSharedMutex mutex;
+
+    {
+        std::shared_lock<gfxrecon::util::ReaderBiasedSharedMutex> shared_lock(mutex);
+        REQUIRE(shared_lock.owns_lock());
+        REQUIRE_FALSE(mutex.try_lock());
+    }
+
+    {
+        std::unique_lock<gfxrecon::util::ReaderBiasedSharedMutex> exclusive_lock(mutex);
+        REQUIRE(exclusive_lock.owns_lock());
+        REQUIRE_FALSE(mutex.try_lock_shared());
+    }
+
+    REQUIRE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST_CASE("ReaderBiasedSharedMutex - exclusive lock excludes readers", "[]")
+{
+    constexpr uint32_t kReaderCount     = 8;
+    constexpr uint32_t kIterationCount  = 20000;
+    constexpr uint32_t kWriterIncrement = 2;
+
+    gfxrecon::util::ReaderBiasedSharedMutex mutex;
+    std::atomic<bool>                       stop{ false };
+    std::atomic<uint32_t>                   torn_reads{ 0 };
+    uint64_t                                values[2] = { 0, 0 };
+
+    std::vector<std::thread> readers;
+    for (uint32_t i = 0; i < kReaderCount; ++i)
+    {
+        readers.emplace_back([&]() {
+            while (!stop.load())
+            {
+                std::shared_lock<gfxrecon::util::ReaderBiasedSharedMutex> lock(mutex);
+                if (values[0] != values[1])
+                {
+                    ++torn_reads;
+                }
+            }
+        });
+    }
+
+    for (uint32_t i = 0; i < kIterationCount; ++i)
+    {
+        std::unique_lock<gfxrecon::util::ReaderBiasedSharedMutex> lock(mutex);
+        values[0] += kWriterIncrement;
+        values[1] += kWriterIncrement;
+    }
+
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    REQUIRE(torn_reads.load() == 0);
+    REQUIRE(values[0] == static_cast<uint64_t>(kIterationCount) * kWriterIncrement);
+}
+
+// Measures the cost of the shared API call lock when multiple threads record commands concurrently. Each simulated
+// call acquires the shared lock and encodes a CmdDraw sized parameter block into a per-thread buffer, which matches the
+// work done by a generated encoder when capture is active. Hidden by default; run with the [benchmark] tag.
+template <typename MutexT>
+static double RunApiCallLockBenchmark(uint32_t thread_count, uint32_t calls_per_thread)
+{
+    constexpr size_t kParameterSize = 32;
+
+    MutexT                   mutex;
+    std::atomic<uint32_t>    ready_count{ 0 };
+    std::atomic<bool>        start{ false };
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]() {
+            std::vector<uint8_t> buffer;
+            uint8_t              parameters[kParameterSize] = {};
+
+            buffer.reserve(kParameterSize * 1024);
+
+            ++ready_count;
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            for (uint32_t call = 0; call < calls_per_thread; ++call)
+            {
+                std::shared_lock<MutexT> lock(mutex);
+
+                std::memcpy(parameters, &call, sizeof(call));
+                if ((buffer.size() + kParameterSize) > buffer.capacity())
+                {
+                    buffer.clear();
+                }
+                buffer.insert(buffer.end(), parameters, parameters + kParameterSize);
+            }
+        });
+    }
+
+    while (ready_count.load() != thread_count)
+    {
+        std::this_thread::yield();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    return (static_cast<double>(thread_count) * calls_per_thread) / elapsed.count();
+}
+
+TEST_CASE("ReaderBiasedSharedMutex - API call lock scaling", "[.][benchmark]")
+{
+    using BiasedMutexT                 = gfxrecon::util::ReaderBiasedSharedMutex;
+    constexpr uint32_t kCallsPerThread = 1000000;
+
+    std::printf("threads  std::shared_mutex (calls/s)  ReaderBiasedSharedMutex (calls/s)\n");
+
+    for (uint32_t thread_count = 1; thread_count <= 32; thread_count *= 2)
+    {
+        double baseline = RunApiCallLockBenchmark<std::shared_mutex>(thread_count, kCallsPerThread);
+        double biased   = RunApiCallLockBenchmark<BiasedMutexT>(thread_count, kCallsPerThread);
+
+        std::printf("%7u  %27.0f  %33.0f\n", thread_count, baseline, biased);
+    }
+}
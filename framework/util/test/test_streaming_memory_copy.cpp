@@ -0,0 +1,106 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/streaming_memory_copy.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+const uint8_t kGuardByte  = 0xcd;
+const size_t  kGuardSize  = 64;
+const size_t  kAlignment  = 64;
+const size_t  kOffsetSpan = 16;
+
+// Returns a pointer into the buffer that is aligned to kAlignment.
+static uint8_t* AlignPointer(std::vector<uint8_t>* buffer)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(buffer->data());
+    return buffer->data() + ((kAlignment - (address % kAlignment)) % kAlignment);
+}
+
+// Copies size bytes between buffers whose start addresses are offset from a 64 byte boundary, and checks that the copy
+// is exact and that the bytes around the destination are not written.
+static bool CheckCopy(size_t size, size_t dst_offset, size_t src_offset)
+{
+    std::vector<uint8_t> source_buffer(size + kAlignment + kOffsetSpan);
+    std::vector<uint8_t> destination_buffer(size + kAlignment + kOffsetSpan + (kGuardSize * 2), kGuardByte);
+
+    uint8_t* src = AlignPointer(&source_buffer) + src_offset;
+    uint8_t* dst = AlignPointer(&destination_buffer) + kGuardSize + dst_offset;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        // The pattern never matches the guard byte, so a copy to the wrong location is detected.
+        src[i] = static_cast<uint8_t>((i % 251) + 1);
+    }
+
+    gfxrecon::util::StreamingMemoryCopy(dst, src, size);
+
+    if ((size > 0) && (std::memcmp(dst, src, size) != 0))
+    {
+        return false;
+    }
+
+    for (size_t i = 1; i <= kGuardSize; ++i)
+    {
+        if ((dst[-static_cast<ptrdiff_t>(i)] != kGuardByte) || (dst[size + i - 1] != kGuardByte))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("StreamingMemoryCopy - sizes around the streaming threshold", "[]")
+{
+    // Sizes below, at, and above the 1 KiB threshold for streaming stores, with tails before and after the 64 byte
+    // blocks that are written with streaming stores.
+    const size_t sizes[] = { 0,    1,    15,   16,   63,   64,   65,   1000, 1023, 1024,
+                             1025, 1039, 1040, 1087, 1088, 1089, 2047, 2048, 4103, 65536 + 17 };
+
+    for (size_t size : sizes)
+    {
+        INFO("Size " << size);
+        REQUIRE(CheckCopy(size, 0, 0));
+    }
+}
+
+TEST_CASE("StreamingMemoryCopy - unaligned destination and source", "[]")
+{
+    const size_t sizes[] = { 63, 64, 65, 1023, 1024, 1025, 1024 + 63, 1024 + 64, 1024 + 65, 4096 + 7 };
+
+    for (size_t size : sizes)
+    {
+        for (size_t dst_offset = 0; dst_offset < kOffsetSpan; ++dst_offset)
+        {
+            for (size_t src_offset : { 0, 1, 3, 8, 15 })
+            {
+                INFO("Size " << size << ", destination offset " << dst_offset << ", source offset " << src_offset);
+                REQUIRE(CheckCopy(size, dst_offset, src_offset));
+            }
+        }
+    }
+}
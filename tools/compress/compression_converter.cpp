@@ -237,6 +237,10 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteFillMemoryResourceValueMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kCommandBufferRecording)
+    {
+        return WriteCommandBufferRecordingMetaData(block_header, meta_data_id);
+    }
     else
     {
         // The current block should not be compressed.  If it is compressed, it is most likely a new block type that is
@@ -924,6 +928,88 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
     return true;
 }
 
+bool CompressionConverter::WriteCommandBufferRecordingMetaData(const format::BlockHeader& block_header,
+                                                               format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kCommandBufferRecording);
+
+    format::CommandBufferRecording recording_cmd;
+
+    bool success = ReadBytes(&recording_cmd.thread_id, sizeof(recording_cmd.thread_id));
+    success      = success && ReadBytes(&recording_cmd.command_buffer_id, sizeof(recording_cmd.command_buffer_id));
+    success      = success && ReadBytes(&recording_cmd.recording_index, sizeof(recording_cmd.recording_index));
+    success      = success && ReadBytes(&recording_cmd.recording_size, sizeof(recording_cmd.recording_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, recording_cmd.recording_size);
+
+        size_t data_size = static_cast<size_t>(recording_cmd.recording_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(recording_cmd));
+
+            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                     "Failed to read command buffer recording meta-data block");
+                return false;
+            }
+
+            assert(uncompressed_size == data_size);
+        }
+        else if (data_size > 0)
+        {
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read command buffer recording meta-data block");
+                return false;
+            }
+        }
+
+        const auto&    buffer       = GetParameterBuffer();
+        const uint8_t* data_address = buffer.data();
+
+        if (data_size > 0)
+        {
+            PrepMetadataBlock(recording_cmd.meta_header, meta_data_id, data_address, data_size);
+        }
+        else
+        {
+            // A reference to an earlier recording has no data to compress.
+            recording_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+            recording_cmd.meta_header.meta_data_id      = meta_data_id;
+        }
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        recording_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(recording_cmd) + data_size;
+
+        if (!WriteBytes(&recording_cmd, sizeof(recording_cmd)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader,
+                                  "Failed to write command buffer recording meta-data block header");
+            return false;
+        }
+
+        if ((data_size > 0) && !WriteBytes(data_address, data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write command buffer recording meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader,
+                             "Failed to read command buffer recording meta-data block header");
+        return false;
+    }
+
+    return true;
+}
+
 void CompressionConverter::PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
                                              format::MetaDataId      meta_data_id,
                                              const uint8_t*&         data_address,
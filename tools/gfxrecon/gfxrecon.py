@@ -25,7 +25,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|convert|extract|info|optimize|replay] [<args>]
+#     gfxrecon.py [capture|compress|convert|extract|image-diff|info|optimize|replay] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -48,6 +48,7 @@ valid_commands = [
     'compress',
     'convert',
     'extract',
+    'image-diff',
     'info',
     'optimize',
     'replay'
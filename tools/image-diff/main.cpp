@@ -0,0 +1,329 @@
+/*
+** Copyright (c) 2025 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include PROJECT_VERSION_HEADER_FILE
+
+#include "util/argument_parser.h"
+#include "util/file_path.h"
+#include "util/image_compare.h"
+#include "util/image_reader.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[]   = "-h";
+const char kHelpLongOption[]    = "--help";
+const char kVersionOption[]     = "--version";
+const char kNoDebugPopup[]      = "--no-debug-popup";
+const char kReportArgument[]    = "--report";
+const char kTileSizeArgument[]  = "--tile-size";
+const char kDefaultReportFile[] = "image_diff.json";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--report,--tile-size";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Compare GFXReconstruct screenshots and resource dumps.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--report <file>] [--tile-size <N>]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t<reference> <test>\n");
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <reference>\t\tReference image file or directory of reference images.");
+    GFXRECON_WRITE_CONSOLE("  <test>\t\tImage file or directory of images to compare with the reference.");
+    GFXRECON_WRITE_CONSOLE("        \t\tWhen directories are specified, images are paired by file name");
+    GFXRECON_WRITE_CONSOLE("        \t\twithout extension, so images in different formats can be compared.");
+    GFXRECON_WRITE_CONSOLE("        \t\tSupported formats are BMP, PNG, QOI and ZSTD.");
+    GFXRECON_WRITE_CONSOLE("Optional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --report <file>\tWrite the comparison results as JSON to <file>.");
+    GFXRECON_WRITE_CONSOLE("                 \tDefault is %s.", kDefaultReportFile);
+    GFXRECON_WRITE_CONSOLE("  --tile-size <N>\tSize in pixels of the square tiles that are hashed to find");
+    GFXRECON_WRITE_CONSOLE("                 \tthe regions that differ. Default is %u.",
+                           gfxrecon::util::imagecompare::kDefaultTileSize);
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+    GFXRECON_WRITE_CONSOLE("\nThe exit code is 0 when all images are identical and 1 when any image differs or");
+    GFXRECON_WRITE_CONSOLE("is missing.");
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool IsSupportedImage(const std::filesystem::path& path)
+{
+    const std::string extension = path.extension().string();
+
+    for (size_t i = 0; i < gfxrecon::util::imagereader::kSupportedImageExtensionCount; ++i)
+    {
+        if (extension == gfxrecon::util::imagereader::kSupportedImageExtensions[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Maps file names without extension to the image files in a directory. When the same name exists in more than one
+// format, the first format in kSupportedImageExtensions order is used.
+static std::map<std::string, std::string> ListImages(const std::string& directory)
+{
+    std::map<std::string, std::string> images;
+    std::error_code                    error;
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (entry.is_regular_file() && IsSupportedImage(entry.path()))
+        {
+            const std::string name = entry.path().stem().string();
+            if (images.find(name) == images.end())
+            {
+                images[name] = gfxrecon::util::imagecompare::FindImageFile(directory, name);
+            }
+        }
+    }
+
+    if (error)
+    {
+        GFXRECON_LOG_ERROR("Failed to read directory %s: %s", directory.c_str(), error.message().c_str());
+    }
+
+    return images;
+}
+
+static void CompareImagePair(gfxrecon::util::imagecompare::CompareEntry* entry, uint32_t tile_size)
+{
+    gfxrecon::util::imagereader::ImageData reference;
+    gfxrecon::util::imagereader::ImageData test;
+
+    if (entry->reference_found && !gfxrecon::util::imagereader::ReadImage(entry->reference_file, &reference))
+    {
+        GFXRECON_LOG_ERROR("Failed to read image %s", entry->reference_file.c_str());
+        entry->reference_found = false;
+    }
+
+    if (entry->test_found && !gfxrecon::util::imagereader::ReadImage(entry->test_file, &test))
+    {
+        GFXRECON_LOG_ERROR("Failed to read image %s", entry->test_file.c_str());
+        entry->test_found = false;
+    }
+
+    if (entry->reference_found && entry->test_found)
+    {
+        gfxrecon::util::imagecompare::CompareImages(reference, test, &entry->result, tile_size);
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 2))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+    const std::string&              reference_path       = positional_arguments[0];
+    const std::string&              test_path            = positional_arguments[1];
+    std::string                     report_file          = arg_parser.GetArgumentValue(kReportArgument);
+    uint32_t                        tile_size            = gfxrecon::util::imagecompare::kDefaultTileSize;
+
+    if (report_file.empty())
+    {
+        report_file = kDefaultReportFile;
+    }
+
+    const std::string& tile_size_value = arg_parser.GetArgumentValue(kTileSizeArgument);
+    if (!tile_size_value.empty())
+    {
+        tile_size = static_cast<uint32_t>(std::strtoul(tile_size_value.c_str(), nullptr, 10));
+        if (tile_size == 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid tile size %s", tile_size_value.c_str());
+            tile_size = gfxrecon::util::imagecompare::kDefaultTileSize;
+        }
+    }
+
+    std::vector<gfxrecon::util::imagecompare::CompareEntry> entries;
+
+    const bool reference_is_dir = gfxrecon::util::filepath::IsDirectory(reference_path);
+    const bool test_is_dir      = gfxrecon::util::filepath::IsDirectory(test_path);
+
+    if (reference_is_dir != test_is_dir)
+    {
+        GFXRECON_WRITE_CONSOLE("The reference and test arguments must both be files or both be directories");
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    if (reference_is_dir)
+    {
+        const std::map<std::string, std::string> reference_images = ListImages(reference_path);
+        const std::map<std::string, std::string> test_images      = ListImages(test_path);
+
+        for (const auto& reference_image : reference_images)
+        {
+            gfxrecon::util::imagecompare::CompareEntry entry;
+            entry.name            = reference_image.first;
+            entry.reference_file  = reference_image.second;
+            entry.reference_found = true;
+
+            auto test_image = test_images.find(reference_image.first);
+            if (test_image != test_images.end())
+            {
+                entry.test_file  = test_image->second;
+                entry.test_found = true;
+            }
+
+            entries.emplace_back(std::move(entry));
+        }
+
+        for (const auto& test_image : test_images)
+        {
+            if (reference_images.find(test_image.first) == reference_images.end())
+            {
+                gfxrecon::util::imagecompare::CompareEntry entry;
+                entry.name       = test_image.first;
+                entry.test_file  = test_image.second;
+                entry.test_found = true;
+
+                entries.emplace_back(std::move(entry));
+            }
+        }
+    }
+    else
+    {
+        gfxrecon::util::imagecompare::CompareEntry entry;
+        entry.name            = gfxrecon::util::filepath::GetFilenameStem(test_path);
+        entry.reference_file  = reference_path;
+        entry.reference_found = gfxrecon::util::filepath::IsFile(reference_path);
+        entry.test_file       = test_path;
+        entry.test_found      = gfxrecon::util::filepath::IsFile(test_path);
+
+        entries.emplace_back(std::move(entry));
+    }
+
+    size_t different_count = 0;
+
+    for (auto& entry : entries)
+    {
+        CompareImagePair(&entry, tile_size);
+
+        if (!entry.reference_found || !entry.test_found)
+        {
+            GFXRECON_WRITE_CONSOLE("%s: missing", entry.name.c_str());
+            ++different_count;
+        }
+        else if (!entry.result.IsIdentical())
+        {
+            if (entry.result.size_match)
+            {
+                GFXRECON_WRITE_CONSOLE("%s: different (%" PRIu64 " pixels in %u of %u tiles, max error %u, "
+                                       "PSNR %.2f dB)",
+                                       entry.name.c_str(),
+                                       entry.result.mismatched_pixels,
+                                       entry.result.mismatched_tiles,
+                                       entry.result.tile_count,
+                                       entry.result.max_error,
+                                       entry.result.psnr);
+            }
+            else
+            {
+                GFXRECON_WRITE_CONSOLE("%s: different (image sizes do not match)", entry.name.c_str());
+            }
+            ++different_count;
+        }
+    }
+
+    GFXRECON_WRITE_CONSOLE(
+        "%" PRIuPTR " of %" PRIuPTR " images match", entries.size() - different_count, entries.size());
+
+    bool report_written = gfxrecon::util::imagecompare::WriteJsonReport(report_file, entries);
+
+    gfxrecon::util::Log::Release();
+
+    return ((different_count == 0) && report_written) ? 0 : 1;
+}
@@ -104,6 +104,33 @@ class AnnotationRecorder : public gfxrecon::decode::AnnotationHandler
     uint64_t                 annotation_count_{ 0 };
 };
 
+// Vulkan decoder for the calls that are processed by the Vulkan detection and stats consumers.  The file processor skips
+// the data of all other Vulkan calls and of the resource data meta-data blocks without reading or decompressing it.
+class VulkanInfoDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsApiCall(gfxrecon::format::ApiCallId call_id) override
+    {
+        switch (call_id)
+        {
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateInstance:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateDevice:
+            case gfxrecon::format::ApiCallId::ApiCall_vkAllocateMemory:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    virtual bool SupportsMetaDataId(gfxrecon::format::MetaDataId meta_data_id) override { return false; }
+};
+
 struct ApiAgnosticStats
 {
     gfxrecon::format::CompressionType      compression_type;
@@ -346,6 +373,7 @@ void GatherAndPrintExeInfo(const std::string& input_filename)
 {
     gfxrecon::decode::InfoConsumer  info_consumer(true);
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.EnableUnsupportedBlockSkipping();
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::InfoDecoder info_decoder;
@@ -739,6 +767,7 @@ void PrintEnvironmentVariableInfo(gfxrecon::decode::InfoConsumer& info_consumer)
 void GatherAndPrintEnvVars(const std::string& input_filename)
 {
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.EnableUnsupportedBlockSkipping();
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::InfoConsumer info_consumer;
@@ -760,6 +789,7 @@ void GatherAndPrintEnvVars(const std::string& input_filename)
 void GatherAndPrintAllInfo(const std::string& input_filename)
 {
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.EnableUnsupportedBlockSkipping();
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::StatDecoderBase stat_decoder;
@@ -778,7 +808,7 @@ void GatherAndPrintAllInfo(const std::string& input_filename)
         gfxrecon::decode::VulkanDetectionConsumer vulkan_detection_consumer(
             gfxrecon::decode::VulkanDetectionConsumer::kNoBlockLimit);
         gfxrecon::decode::VulkanStatsConsumer vulkan_stats_consumer;
-        gfxrecon::decode::VulkanDecoder       vulkan_decoder;
+        VulkanInfoDecoder                     vulkan_decoder;
         vulkan_decoder.AddConsumer(&vulkan_detection_consumer);
         vulkan_decoder.AddConsumer(&vulkan_stats_consumer);
         file_processor.AddDecoder(&vulkan_decoder);
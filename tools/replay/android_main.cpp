@@ -27,6 +27,7 @@
 #include "application/android_window.h"
 #include "decode/file_processor.h"
 #include "decode/preload_file_processor.h"
+#include "decode/vulkan_pipeline_precompiler.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "format/format.h"
@@ -121,6 +122,11 @@ void android_main(struct android_app* app)
                                  ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>()
                                  : std::make_unique<gfxrecon::decode::FileProcessor>();
 
+            if (arg_parser.IsOptionSet(kReadAheadOption) && !arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+            {
+                file_processor->EnableReadAhead();
+            }
+
             if (!file_processor->Initialize(filename))
             {
                 GFXRECON_WRITE_CONSOLE("Failed to load file %s.", filename.c_str());
@@ -147,6 +153,19 @@ void android_main(struct android_app* app)
                     return;
                 }
 
+                file_processor->EnableParallelRecording(GetRecordingThreadCount(arg_parser, replay_options));
+
+                if (replay_options.detailed_frame_timing)
+                {
+                    file_processor->EnableReadTimeMeasurement();
+                }
+
+                if (replay_options.precompile_pipelines)
+                {
+                    gfxrecon::decode::VulkanPipelinePrecompiler precompiler(application, replay_options);
+                    precompiler.Process(filename);
+                }
+
                 gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, replay_options);
                 gfxrecon::decode::VulkanDecoder        vulkan_decoder;
                 uint32_t                               start_frame, end_frame;
@@ -176,7 +195,9 @@ void android_main(struct android_app* app)
                                                      replay_options.preload_measurement_range,
                                                      measurement_file_name,
                                                      quit_after_frame,
-                                                     quit_frame);
+                                                     quit_frame,
+                                                     replay_options.measurement_range_loop_count,
+                                                     replay_options.detailed_frame_timing);
 
                 vulkan_replay_consumer.SetFatalErrorHandler(
                     [](const char* message) { throw std::runtime_error(message); });
@@ -27,6 +27,7 @@
 #include "application/application.h"
 #include "decode/file_processor.h"
 #include "decode/preload_file_processor.h"
+#include "decode/vulkan_pipeline_precompiler.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -159,6 +160,11 @@ int main(int argc, const char** argv)
         else
         {
             file_processor = std::make_unique<gfxrecon::decode::FileProcessor>();
+
+            if (arg_parser.IsOptionSet(kReadAheadOption))
+            {
+                file_processor->EnableReadAhead();
+            }
         }
 
         if (!file_processor->Initialize(filename))
@@ -183,6 +189,8 @@ int main(int argc, const char** argv)
                 return -1;
             }
 
+            file_processor->EnableParallelRecording(GetRecordingThreadCount(arg_parser, vulkan_replay_options));
+
             uint32_t start_frame = 0;
             uint32_t end_frame   = 0;
 
@@ -194,6 +202,8 @@ int main(int argc, const char** argv)
             bool        flush_measurement_frame_range      = false;
             bool        flush_inside_measurement_range     = false;
             bool        preload_measurement_frame_range    = false;
+            uint32_t    measurement_range_loop_count       = 1;
+            bool        detailed_frame_timing              = false;
             std::string measurement_file_name;
 
             if (vulkan_replay_options.enable_vulkan)
@@ -203,6 +213,8 @@ int main(int argc, const char** argv)
                 flush_measurement_frame_range      = vulkan_replay_options.flush_measurement_frame_range;
                 flush_inside_measurement_range     = vulkan_replay_options.flush_inside_measurement_range;
                 preload_measurement_frame_range    = vulkan_replay_options.preload_measurement_range;
+                measurement_range_loop_count       = vulkan_replay_options.measurement_range_loop_count;
+                detailed_frame_timing              = vulkan_replay_options.detailed_frame_timing;
 
                 if (vulkan_replay_options.quit_after_frame)
                 {
@@ -225,7 +237,20 @@ int main(int argc, const char** argv)
                                                  preload_measurement_frame_range,
                                                  measurement_file_name,
                                                  quit_after_frame,
-                                                 quit_frame);
+                                                 quit_frame,
+                                                 measurement_range_loop_count,
+                                                 detailed_frame_timing);
+
+            if (detailed_frame_timing)
+            {
+                file_processor->EnableReadTimeMeasurement();
+            }
+
+            if (vulkan_replay_options.enable_vulkan && vulkan_replay_options.precompile_pipelines)
+            {
+                gfxrecon::decode::VulkanPipelinePrecompiler precompiler(application, vulkan_replay_options);
+                precompiler.Process(filename);
+            }
 
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
             gfxrecon::decode::VulkanDecoder        vulkan_decoder;
@@ -36,16 +36,18 @@ const char kOptions[] =
     "--dump-resources-dump-depth-attachment,--dump-"
     "resources-dump-vertex-index-buffers,--dump-resources-json-output-per-command,--dump-resources-dump-immutable-"
     "resources,--dump-resources-dump-all-image-subresources,--dump-resources-dump-raw-images,--dump-resources-dump-"
-    "separate-alpha,--pbi-all,--preload-measurement-range, --add-new-pipeline-caches";
+    "separate-alpha,--pbi-all,--preload-measurement-range, --add-new-pipeline-caches,--read-ahead,"
+    "--precompile-pipelines,--detailed-frame-timing,--deduplicate-pipelines";
 const char kArguments[] =
     "--log-level,--log-file,--gpu,--gpu-group,--pause-frame,--wsi,--surface-index,-m|--memory-translation,"
     "--replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
-    "screenshot-dir,--screenshot-prefix,--screenshot-size,--screenshot-scale,--mfr|--measurement-frame-range,--fw|--"
+    "screenshot-dir,--screenshot-prefix,--screenshot-size,--screenshot-scale,--screenshot-compare-dir,--screenshot-"
+    "compare-report,--mfr|--measurement-frame-range,--fw|--"
     "force-windowed,--fwo|--force-windowed-origin,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-"
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
     "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs,--save-pipeline-cache,--load-"
-    "pipeline-cache,--quit-after-frame";
+    "pipeline-cache,--quit-after-frame,--recording-threads,--loop-measurement-range,--pipeline-cache-dir";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -65,6 +67,7 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-dir <dir>] [--screenshot-prefix <file-prefix>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-size <width>x<height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-scale <scale>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-compare-dir <dir>] [--screenshot-compare-report <file>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sfa | --skip-failed-allocations] [--replace-shaders <dir>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--wsi <platform>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--use-cached-psos] [--surface-index <N>]");
@@ -79,10 +82,13 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--mfr|--measurement-frame-range <start-frame>-<end-frame>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--quit-after-measurement-range]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--loop-measurement-range <count>] [--detailed-frame-timing]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fw <width,height> | --force-windowed <width,height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>] [--read-ahead]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--recording-threads <num_threads>] [--precompile-pipelines]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--deduplicate-pipelines] [--pipeline-cache-dir <dir>]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources <submit-index,command-index,drawcall-index>]");
 #endif
@@ -141,6 +147,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tBitmap file format.  This is the default format.",
                            kScreenshotFormatBmp);
     GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tPortable Network Graphics file format.", kScreenshotFormatPng);
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tQuite OK Image file format.  Lossless and much faster",
+                           kScreenshotFormatQoi);
+    GFXRECON_WRITE_CONSOLE("          \t\t       \t\tto encode than PNG.");
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tRaw RGB(A) pixel data compressed with Zstandard.",
+                           kScreenshotFormatZstd);
     GFXRECON_WRITE_CONSOLE("  --screenshot-dir <dir>");
     GFXRECON_WRITE_CONSOLE("          \t\tDirectory to write screenshots.  Default is the current");
     GFXRECON_WRITE_CONSOLE("          \t\tworking directory.");
@@ -156,6 +167,15 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tSpecify desired screenshot dimensions. Leaving this unspecified");
     GFXRECON_WRITE_CONSOLE("          \t\tscreenshots will use the swapchain images dimensions. If ");
     GFXRECON_WRITE_CONSOLE("          \t\t--screenshot-scale is also specified then this option is ignored.");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-compare-dir <dir>");
+    GFXRECON_WRITE_CONSOLE("          \t\tCompare screenshots against the reference images with the same");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile name in <dir> (any of the bmp, png, qoi or zstd formats).");
+    GFXRECON_WRITE_CONSOLE("          \t\tScreenshots are compared in memory and are only written to");
+    GFXRECON_WRITE_CONSOLE("          \t\tdisk when they differ from the reference or it is missing.");
+    GFXRECON_WRITE_CONSOLE("          \t\tVulkan only.");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-compare-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tJSON file to receive the results of --screenshot-compare-dir.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is screenshot_compare.json.");
     GFXRECON_WRITE_CONSOLE("  --validate\t\tEnable the Khronos Vulkan validation layer when replaying a");
     GFXRECON_WRITE_CONSOLE("            \t\tVulkan capture or the Direct3D debug layer when replaying a");
     GFXRECON_WRITE_CONSOLE("            \t\tDirect3D 12 capture.");
@@ -167,6 +187,26 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --pbi-all\t\tPrint all block information.");
     GFXRECON_WRITE_CONSOLE(
         "  --pbis <index1,index2>\t\tPrint block information between block index1 and block index2.");
+    GFXRECON_WRITE_CONSOLE("  --read-ahead\t\tRead and decompress the capture file on a separate thread, ahead");
+    GFXRECON_WRITE_CONSOLE("          \t\tof replay. Ignored with --preload-measurement-range.");
+    GFXRECON_WRITE_CONSOLE("  --recording-threads <num_threads>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRecord command buffers on <num_threads> threads. The command buffers");
+    GFXRECON_WRITE_CONSOLE("          \t\tof each command pool are recorded by one of the replay threads, chosen");
+    GFXRECON_WRITE_CONSOLE("          \t\tby the capture thread that first recorded to the pool, so that command");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffers that were recorded concurrently during capture are also");
+    GFXRECON_WRITE_CONSOLE("          \t\trecorded concurrently during replay.");
+    GFXRECON_WRITE_CONSOLE("          \t\tAll other calls wait for the recorded commands to complete.");
+    GFXRECON_WRITE_CONSOLE("          \t\tIgnored with --preload-measurement-range, --dump-resources and");
+    GFXRECON_WRITE_CONSOLE("          \t\t--pipeline-creation-jobs. Default: 0 (record on the replay thread).");
+    GFXRECON_WRITE_CONSOLE("  --precompile-pipelines\tBefore replay, create the shader modules and pipelines of the");
+    GFXRECON_WRITE_CONSOLE("          \t\tcapture file on all CPU cores in a separate pass, so that the driver");
+    GFXRECON_WRITE_CONSOLE("          \t\tpipeline cache is populated before the frames are replayed. The");
+    GFXRECON_WRITE_CONSOLE("          \t\tslowest pipeline creation calls are reported.");
+    GFXRECON_WRITE_CONSOLE("  --deduplicate-pipelines\tCreate a single shader module or graphics/compute pipeline");
+    GFXRECON_WRITE_CONSOLE("          \t\tfor captured creation calls with identical create infos,");
+    GFXRECON_WRITE_CONSOLE("          \t\tincluding SPIR-V code and pNext chains. The driver object is");
+    GFXRECON_WRITE_CONSOLE("          \t\tdestroyed with its last captured handle. Ignored with");
+    GFXRECON_WRITE_CONSOLE("          \t\t--dump-resources and --replace-shaders.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("Windows only:")
@@ -267,6 +307,22 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will flush")
     GFXRECON_WRITE_CONSOLE("          \t\tand wait for all current GPU work to finish at the");
     GFXRECON_WRITE_CONSOLE("          \t\tend of each frame inside the measurement range.");
+    GFXRECON_WRITE_CONSOLE("  --loop-measurement-range <count>");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the measurement range <count> times. The content of the");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffers and images that can be written by the GPU is saved at the");
+    GFXRECON_WRITE_CONSOLE("          \t\tstart of the range and restored before each loop, and the time of");
+    GFXRECON_WRITE_CONSOLE("          \t\teach loop is reported. A range that creates objects that it does");
+    GFXRECON_WRITE_CONSOLE("          \t\tnot destroy, or that destroys objects created before the range,");
+    GFXRECON_WRITE_CONSOLE("          \t\tis not replayed again: a warning is logged and the measurement");
+    GFXRECON_WRITE_CONSOLE("          \t\tends with the loops that were completed. Requires");
+    GFXRECON_WRITE_CONSOLE("          \t\t--measurement-frame-range and --preload-measurement-range.");
+    GFXRECON_WRITE_CONSOLE("  --detailed-frame-timing");
+    GFXRECON_WRITE_CONSOLE("          \t\tAdd the time spent reading the capture file and the GPU time");
+    GFXRECON_WRITE_CONSOLE("          \t\tof each frame of the measurement range to the measurements. The");
+    GFXRECON_WRITE_CONSOLE("          \t\tGPU time is measured with timestamp queries around each queue");
+    GFXRECON_WRITE_CONSOLE("          \t\tsubmission. The p50/p95/p99 frame times are reported, and the");
+    GFXRECON_WRITE_CONSOLE("          \t\tmeasurement file is written as CSV when its name ends with");
+    GFXRECON_WRITE_CONSOLE("          \t\t'.csv'. Requires --measurement-frame-range.");
     GFXRECON_WRITE_CONSOLE("  --gpu-group <index>\tUse the specified device group for replay, where index");
     GFXRECON_WRITE_CONSOLE("          \t\tis the zero-based index to the array of physical device group");
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDeviceGroups.  Replay may fail");
@@ -310,7 +366,7 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tDefault is the current working directory.");
     GFXRECON_WRITE_CONSOLE("  --dump-resources-image-format <format>");
     GFXRECON_WRITE_CONSOLE("          \t\tImage file format to use when dumping image resources.");
-    GFXRECON_WRITE_CONSOLE("          \t\tAvailable formats are: bmp, png");
+    GFXRECON_WRITE_CONSOLE("          \t\tAvailable formats are: bmp, png, qoi, zstd");
     GFXRECON_WRITE_CONSOLE("  --dump-resources-dump-depth-attachment");
     GFXRECON_WRITE_CONSOLE("          \t\tConfigures whether to dump the depth attachment of draw calls.");
     GFXRECON_WRITE_CONSOLE("          \t\tDefault is false.");
@@ -345,6 +401,14 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\twhen it encounters a pipeline created without cache. This option can");
     GFXRECON_WRITE_CONSOLE("          \t\tbe used in coordination with `--save-pipeline-cache` and");
     GFXRECON_WRITE_CONSOLE("          \t\t`--load-pipeline-cache`.");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-cache-dir <dir>");
+    GFXRECON_WRITE_CONSOLE("          \t\tCreate all pipelines with pipeline caches that are loaded from and");
+    GFXRECON_WRITE_CONSOLE("          \t\tsaved to <dir>. The cache file is selected by the hash of the capture");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile and the pipeline cache UUID of the replay device, so repeated");
+    GFXRECON_WRITE_CONSOLE("          \t\treplays of a capture reuse the pipelines compiled by earlier replays.");
+    GFXRECON_WRITE_CONSOLE("          \t\tCan be used with --pipeline-creation-jobs. Ignored with");
+    GFXRECON_WRITE_CONSOLE("          \t\t`--save-pipeline-cache`, `--load-pipeline-cache` and");
+    GFXRECON_WRITE_CONSOLE("          \t\t`--add-new-pipeline-caches`.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("D3D12 only:")
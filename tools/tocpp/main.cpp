@@ -91,7 +91,8 @@ CommandLineArgument g_command_limit_argument = {
     "<number>\t\t\t",
     " (Defaults to 1000)",
     "Maximum number of API commands recorded per C++ file.  The intent is to"
-    " adjust compilation load per file."
+    " adjust compilation load per file.  Consecutive small frames are grouped"
+    " into the same file until the limit is reached."
 };
 
 CommandLineArgument g_captured_swapchain_argument = {
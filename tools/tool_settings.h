@@ -96,6 +96,8 @@ const char kScreenshotDirArgument[]              = "--screenshot-dir";
 const char kScreenshotFilePrefixArgument[]       = "--screenshot-prefix";
 const char kScreenshotSizeArgument[]             = "--screenshot-size";
 const char kScreenshotScaleArgument[]            = "--screenshot-scale";
+const char kScreenshotCompareDirArgument[]       = "--screenshot-compare-dir";
+const char kScreenshotCompareReportArgument[]    = "--screenshot-compare-report";
 const char kForceWindowedShortArgument[]         = "--fw";
 const char kForceWindowedLongArgument[]          = "--force-windowed";
 const char kForceWindowWithOriginShortArgument[] = "--fwo";
@@ -128,6 +130,13 @@ const char kPreloadMeasurementRangeOption[]       = "--preload-measurement-range
 const char kSavePipelineCacheArgument[]           = "--save-pipeline-cache";
 const char kLoadPipelineCacheArgument[]           = "--load-pipeline-cache";
 const char kCreateNewPipelineCacheOption[]        = "--add-new-pipeline-caches";
+const char kReadAheadOption[]                     = "--read-ahead";
+const char kRecordingThreadsArgument[]            = "--recording-threads";
+const char kPrecompilePipelinesOption[]           = "--precompile-pipelines";
+const char kLoopMeasurementRangeArgument[]        = "--loop-measurement-range";
+const char kDetailedFrameTimingOption[]           = "--detailed-frame-timing";
+const char kDeduplicatePipelinesOption[]          = "--deduplicate-pipelines";
+const char kPipelineCacheDirArgument[]            = "--pipeline-cache-dir";
 #if defined(WIN32)
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
 const char kDxOverrideObjectNames[]       = "--dx12-override-object-names";
@@ -185,7 +194,9 @@ const char kApiFamilyAll[]    = "all";
 #endif
 
 const char kScreenshotFormatBmp[] = "bmp";
-const char kScreenshotFormatPng[] = "png";
+const char kScreenshotFormatPng[]  = "png";
+const char kScreenshotFormatQoi[]  = "qoi";
+const char kScreenshotFormatZstd[] = "zstd";
 
 #if defined(__ANDROID__)
 const char kDefaultScreenshotDir[]    = "/sdcard";
@@ -525,6 +536,14 @@ static gfxrecon::util::ScreenshotFormat GetScreenshotFormat(const gfxrecon::util
         {
             format = gfxrecon::util::ScreenshotFormat::kPng;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatQoi, value.c_str()) == 0)
+        {
+            format = gfxrecon::util::ScreenshotFormat::kQoi;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatZstd, value.c_str()) == 0)
+        {
+            format = gfxrecon::util::ScreenshotFormat::kZstd;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized screenshot format option \"%s\"", value.c_str());
@@ -549,6 +568,14 @@ static gfxrecon::util::ScreenshotFormat GetDumpresourcesImageFormat(const gfxrec
         {
             format = gfxrecon::util::ScreenshotFormat::kPng;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatQoi, value.c_str()) == 0)
+        {
+            format = gfxrecon::util::ScreenshotFormat::kQoi;
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatZstd, value.c_str()) == 0)
+        {
+            format = gfxrecon::util::ScreenshotFormat::kZstd;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized dump resources image format option \"%s\"", value.c_str());
@@ -719,6 +746,33 @@ static bool GetQuitAfterFrame(const gfxrecon::util::ArgumentParser& arg_parser,
     return false;
 }
 
+static uint32_t GetMeasurementRangeLoopCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const std::string& value = arg_parser.GetArgumentValue(kLoopMeasurementRangeArgument);
+    if (!value.empty())
+    {
+        if ((std::count_if(value.begin(), value.end(), ::isdigit) != value.length()) || (std::stoi(value) == 0))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid measurement range loop count \"%s\"", value.c_str());
+        }
+        else if (arg_parser.GetArgumentValue(kMeasurementRangeArgument).empty() ||
+                 !arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+        {
+            // The frames of the measurement range are replayed again from the preload buffer.
+            GFXRECON_LOG_WARNING("Ignoring %s, which requires %s and %s",
+                                 kLoopMeasurementRangeArgument,
+                                 kMeasurementRangeArgument,
+                                 kPreloadMeasurementRangeOption);
+        }
+        else
+        {
+            return static_cast<uint32_t>(std::stoi(value));
+        }
+    }
+
+    return 1;
+}
+
 static bool
 GetMeasurementFrameRange(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t& start_frame, uint32_t& end_frame)
 {
@@ -1057,7 +1111,14 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     replay_options.screenshot_dir         = GetScreenshotDir(arg_parser);
     replay_options.screenshot_file_prefix = arg_parser.GetArgumentValue(kScreenshotFilePrefixArgument);
     GetScreenshotSize(arg_parser, replay_options.screenshot_width, replay_options.screenshot_height);
-    replay_options.screenshot_scale = GetScreenshotScale(arg_parser);
+    replay_options.screenshot_scale       = GetScreenshotScale(arg_parser);
+    replay_options.screenshot_compare_dir = arg_parser.GetArgumentValue(kScreenshotCompareDirArgument);
+
+    const std::string& screenshot_compare_report = arg_parser.GetArgumentValue(kScreenshotCompareReportArgument);
+    if (!screenshot_compare_report.empty())
+    {
+        replay_options.screenshot_compare_report = screenshot_compare_report;
+    }
 
     if (arg_parser.IsOptionSet(kQuitAfterMeasurementRangeOption))
     {
@@ -1113,6 +1174,11 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     {
         replay_options.preload_measurement_range = true;
     }
+    replay_options.measurement_range_loop_count = GetMeasurementRangeLoopCount(arg_parser);
+    if (arg_parser.IsOptionSet(kPrecompilePipelinesOption))
+    {
+        replay_options.precompile_pipelines = true;
+    }
 
     replay_options.dump_resources              = arg_parser.GetArgumentValue(kDumpResourcesArgument);
     replay_options.dump_resources_before       = arg_parser.IsOptionSet(kDumpResourcesBeforeDrawOption);
@@ -1131,6 +1197,36 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     replay_options.dump_resources_dump_raw_images     = arg_parser.IsOptionSet(kDumpResourcesDumpRawImages);
     replay_options.dump_resources_dump_separate_alpha = arg_parser.IsOptionSet(kDumpResourcesDumpSeparateAlpha);
 
+    if (arg_parser.IsOptionSet(kDetailedFrameTimingOption))
+    {
+        if (arg_parser.GetArgumentValue(kMeasurementRangeArgument).empty() || replay_options.dumping_resources)
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which requires %s and cannot be used with %s",
+                                 kDetailedFrameTimingOption,
+                                 kMeasurementRangeArgument,
+                                 kDumpResourcesArgument);
+        }
+        else
+        {
+            replay_options.detailed_frame_timing = true;
+        }
+    }
+
+    if (arg_parser.IsOptionSet(kDeduplicatePipelinesOption))
+    {
+        if (replay_options.dumping_resources || !replay_options.replace_shader_dir.empty())
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which cannot be used with %s or %s",
+                                 kDeduplicatePipelinesOption,
+                                 kDumpResourcesArgument,
+                                 kShaderReplaceArgument);
+        }
+        else
+        {
+            replay_options.deduplicate_pipelines = true;
+        }
+    }
+
     std::string dr_color_att_idx = arg_parser.GetArgumentValue(kDumpResourcesColorAttIdxArg);
     if (!dr_color_att_idx.empty())
     {
@@ -1140,10 +1236,60 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     replay_options.save_pipeline_cache_filename = arg_parser.GetArgumentValue(kSavePipelineCacheArgument);
     replay_options.load_pipeline_cache_filename = arg_parser.GetArgumentValue(kLoadPipelineCacheArgument);
     replay_options.add_new_pipeline_caches      = arg_parser.IsOptionSet(kCreateNewPipelineCacheOption);
+    replay_options.pipeline_cache_dir           = arg_parser.GetArgumentValue(kPipelineCacheDirArgument);
+
+    if (!replay_options.pipeline_cache_dir.empty() &&
+        (replay_options.add_new_pipeline_caches || !replay_options.save_pipeline_cache_filename.empty() ||
+         !replay_options.load_pipeline_cache_filename.empty()))
+    {
+        GFXRECON_LOG_WARNING("Ignoring %s, which cannot be used with %s, %s or %s",
+                             kPipelineCacheDirArgument,
+                             kSavePipelineCacheArgument,
+                             kLoadPipelineCacheArgument,
+                             kCreateNewPipelineCacheOption);
+        replay_options.pipeline_cache_dir.clear();
+    }
 
     return replay_options;
 }
 
+static uint32_t GetRecordingThreadCount(const gfxrecon::util::ArgumentParser&        arg_parser,
+                                        const gfxrecon::decode::VulkanReplayOptions& replay_options)
+{
+    uint32_t    thread_count = 0;
+    const auto& value        = arg_parser.GetArgumentValue(kRecordingThreadsArgument);
+
+    if (!value.empty())
+    {
+        int32_t requested_count = std::stoi(value);
+
+        if (requested_count <= 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid recording thread count \"%s\"", value.c_str());
+        }
+        else if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which is not supported with %s",
+                                 kRecordingThreadsArgument,
+                                 kPreloadMeasurementRangeOption);
+        }
+        else if (replay_options.dumping_resources || (replay_options.num_pipeline_creation_jobs != 0))
+        {
+            // Resource dumping and asynchronous pipeline creation access replay state that is shared by all command
+            // buffers while commands are recorded.
+            GFXRECON_LOG_WARNING("Ignoring %s, which is not supported with resource dumping or %s",
+                                 kRecordingThreadsArgument,
+                                 kNumPipelineCreationJobs);
+        }
+        else
+        {
+            thread_count = static_cast<uint32_t>(requested_count);
+        }
+    }
+
+    return thread_count;
+}
+
 #if defined(D3D12_SUPPORT)
 static gfxrecon::decode::DxReplayOptions GetDxReplayOptions(const gfxrecon::util::ArgumentParser& arg_parser,
                                                             const std::string&                    filename)